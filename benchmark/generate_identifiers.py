@@ -0,0 +1,38 @@
+#!/usr/bin/env python
+"""Generate a translation unit declaring many identifiers.
+
+The identifiers are spread over nested namespaces, classes and functions so
+that the identifier related checkers (rules 2-10-x) have to deal with deep
+scope stacks as well as with wide scopes.
+
+Usage: generate_identifiers.py [NUMBER_OF_IDENTIFIERS] > identifiers.cpp
+"""
+
+import sys
+
+
+def main():
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+    perScope = 100
+    lines = []
+    declared = 0
+    scope = 0
+    while declared < count:
+        lines.append("namespace ns%d {" % scope)
+        lines.append("struct S%d {" % scope)
+        for i in range(perScope // 2):
+            lines.append("  int member_%d_%d;" % (scope, i))
+        lines.append("  void method%d();" % scope)
+        lines.append("};")
+        lines.append("void function%d(int parameter%d) {" % (scope, scope))
+        for i in range(perScope // 2):
+            lines.append("  int local_%d_%d = parameter%d;" % (scope, i, scope))
+        lines.append("}")
+        lines.append("}")
+        declared += perScope + 4
+        scope += 1
+    sys.stdout.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
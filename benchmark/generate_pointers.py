@@ -0,0 +1,49 @@
+#!/usr/bin/env python
+"""Generate a translation unit with long chains of pointer assignments.
+
+Each function copies pointers into arrays along a chain of local variables
+whose assignments come in the reverse order of the flow, inside a loop, so
+that an iterative dataflow analysis would need one pass per variable of the
+chain. Timing the pointer checkers (rules 5-0-15 to 5-0-18 and 5-2-12) over
+growing numbers of statements and chain lengths shows how their cost scales.
+
+Usage: generate_pointers.py [STATEMENTS] [CHAIN_LENGTH] > pointers.cpp
+"""
+
+import sys
+
+
+def main():
+    count = int(sys.argv[1]) if len(sys.argv) > 1 else 100000
+    chain = int(sys.argv[2]) if len(sys.argv) > 2 else 200
+    lines = ["void consume(const int *p);", ""]
+    generated = 0
+    function = 0
+    while generated < count:
+        lines.append("int function%d(int n) {" % function)
+        lines.append("  int a[%d];" % chain)
+        lines.append("  int b[%d];" % chain)
+        for i in range(chain + 1):
+            lines.append("  int *p%d = a;" % i)
+        lines.append("  for (int i = 0; i < n; ++i) {")
+        for i in range(chain):
+            if i % 2 == 0:
+                lines.append("    p%d = p%d;" % (i, i + 1))
+            else:
+                lines.append("    p%d = p%d + 1;" % (i, i + 1))
+        lines.append("    p%d = &a[1];" % chain)
+        lines.append("  }")
+        for i in range(0, chain, 4):
+            lines.append("  if (p%d < b) {" % i)
+            lines.append("    consume(a);")
+            lines.append("  }")
+            lines.append("  n += p%d - &a[%d];" % (i + 1, i))
+        lines.append("  return n;")
+        lines.append("}")
+        generated += 2 * chain + 2
+        function += 1
+    sys.stdout.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,99 @@
+//===-  MisraCpp2008Fuzzer.cpp - libFuzzer target for the checkers---------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements a libFuzzer target which feeds its input as C++ source
+// code to Clang with all MISRA C++ 2008 checkers enabled. Besides crashes and
+// failed assertions, inputs which take longer than a given time limit to be
+// checked are treated as findings. The limit defaults to 1000 milliseconds and
+// can be changed using the environment variable
+// MISRACPP2008_FUZZ_TIME_LIMIT_MS.
+//
+//===----------------------------------------------------------------------===//
+
+#include "clang/Basic/Diagnostic.h"
+#include "clang/Basic/FileManager.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "clang/Frontend/FrontendAction.h"
+#include "clang/Frontend/FrontendPluginRegistry.h"
+#include "clang/Tooling/Tooling.h"
+#include "llvm/ADT/IntrusiveRefCntPtr.h"
+#include "llvm/Support/raw_ostream.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace clang;
+
+namespace {
+
+const char *const pluginName = "misra.cpp.2008";
+const char *const inputFileName = "fuzz-input.cpp";
+
+std::unique_ptr<PluginASTAction> createPluginAction() {
+  for (FrontendPluginRegistry::iterator it = FrontendPluginRegistry::begin(),
+                                        ie = FrontendPluginRegistry::end();
+       it != ie; ++it) {
+    if (it->getName() == pluginName) {
+      return it->instantiate();
+    }
+  }
+  return nullptr;
+}
+
+/// \brief Enable all the checkers. The set of enabled checkers is global state
+/// of the plugin, therefore this has to be done just once.
+/// \return Time limit per input in milliseconds.
+long initialize() {
+  std::unique_ptr<PluginASTAction> action = createPluginAction();
+  CompilerInstance CI;
+  if (!action || !action->ParseArgs(CI, {"all"})) {
+    llvm::errs() << "Failed to enable the MISRA C++ 2008 checkers.\n";
+    std::abort();
+  }
+
+  long timeLimitMs = 1000;
+  if (const char *limit = std::getenv("MISRACPP2008_FUZZ_TIME_LIMIT_MS")) {
+    timeLimitMs = std::atol(limit);
+  }
+  return timeLimitMs;
+}
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  static const long timeLimitMs = initialize();
+
+  const std::string code(reinterpret_cast<const char *>(data), size);
+  const std::vector<std::string> args = {"misracpp2008-fuzzer",
+                                         "-fsyntax-only", "-ferror-limit=0",
+                                         inputFileName};
+  llvm::IntrusiveRefCntPtr<FileManager> files(
+      new FileManager(FileSystemOptions()));
+  IgnoringDiagConsumer diagConsumer;
+
+  // The invocation takes ownership of the action.
+  tooling::ToolInvocation invocation(args, createPluginAction().release(),
+                                     files.get());
+  invocation.setDiagnosticConsumer(&diagConsumer);
+  invocation.mapVirtualFile(inputFileName, code);
+
+  const auto start = std::chrono::steady_clock::now();
+  invocation.run();
+  const auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+
+  // Report slow inputs the same way as crashes so libFuzzer saves them.
+  if (elapsedMs > timeLimitMs) {
+    llvm::errs() << "Checking the input took " << elapsedMs
+                 << " ms, the limit is " << timeLimitMs << " ms.\n";
+    std::abort();
+  }
+  return 0;
+}
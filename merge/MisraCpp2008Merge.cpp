@@ -0,0 +1,147 @@
+//===-  MisraCpp2008Merge.cpp - Checker for the project wide rules---------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file implements a tool which merges the data written by the plugin for
+// each translation unit of a project when run with --project-data=DIR. It
+// reports the violations of the rules which can only be checked with all the
+// translation units at hand:
+//   - 2-10-3, 2-10-4, 2-10-5: identifiers reused across translation units
+//   - 7-5-4: recursion through functions of several translation units
+//
+// The exit code is 1 if any violation has been found.
+//
+//===----------------------------------------------------------------------===//
+
+#include "RuleHeadlineTexts.h"
+#include "project/CallGraphRecords.h"
+#include "project/IdentifierRecords.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/CommandLine.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <vector>
+
+using namespace llvm;
+using namespace misracpp2008;
+
+static cl::list<std::string>
+    InputPaths(cl::Positional, cl::OneOrMore,
+               cl::desc("<project data files or directories>"));
+
+/// \brief Add \c path to \c files if it is a data file, or the data files
+/// within \c path if it is a directory.
+static std::error_code collectDataFiles(StringRef path,
+                                        std::vector<std::string> &files) {
+  if (!sys::fs::is_directory(path)) {
+    files.push_back(path.str());
+    return std::error_code();
+  }
+  std::error_code EC;
+  for (sys::fs::directory_iterator it(path, EC), ie; it != ie && !EC;
+       it.increment(EC)) {
+    const StringRef extension = sys::path::extension(it->path());
+    if (extension == ".misra-ids" || extension == ".misra-calls") {
+      files.push_back(it->path());
+    }
+  }
+  return EC;
+}
+
+static void reportCollision(const IdentifierCollision &collision) {
+  outs() << collision.offending.location << ": warning: "
+         << ruleHeadlines.at(collision.rule) << " (MISRA C++ 2008 rule "
+         << collision.rule << ")\n";
+  outs() << collision.previous.location
+         << ": note: Previous occurence of identifier '"
+         << collision.previous.name << "'\n";
+}
+
+static void reportCycle(const CallGraphRecords &records,
+                        const RecursiveCycle &cycle) {
+  outs() << records.calls[cycle.calls.front()].location << ": warning: "
+         << ruleHeadlines.at("7-5-4") << " (MISRA C++ 2008 rule 7-5-4)\n";
+  for (unsigned call : makeArrayRef(cycle.calls).slice(1)) {
+    outs() << records.calls[call].location << ": note: Call of '"
+           << records.calls[call].calleeName
+           << "' continuing the recursion\n";
+  }
+}
+
+int main(int argc, char **argv) {
+  cl::ParseCommandLineOptions(argc, argv,
+                              "MISRA C++ 2008 project wide rules checker\n");
+
+  std::vector<std::string> files;
+  for (const std::string &path : InputPaths) {
+    if (std::error_code EC = collectDataFiles(path, files)) {
+      errs() << "error: unable to read '" << path << "': " << EC.message()
+             << "\n";
+      return 2;
+    }
+  }
+  // Directory iteration order is unspecified, report in a stable order.
+  std::sort(files.begin(), files.end());
+
+  // The records refer to the contents of the files, keep them alive.
+  std::vector<std::unique_ptr<MemoryBuffer>> buffers;
+  std::vector<IdentifierRecord> records;
+  CallGraphRecords callGraphRecords;
+  for (const std::string &file : files) {
+    ErrorOr<std::unique_ptr<MemoryBuffer>> buffer = MemoryBuffer::getFile(file);
+    if (!buffer) {
+      errs() << "error: unable to read '" << file
+             << "': " << buffer.getError().message() << "\n";
+      return 2;
+    }
+    const bool isCallGraph = sys::path::extension(file) == ".misra-calls";
+    StringRef contents = (*buffer)->getBuffer();
+    unsigned lineNumber = 0;
+    while (!contents.empty()) {
+      StringRef line;
+      std::tie(line, contents) = contents.split('\n');
+      ++lineNumber;
+      if (isCallGraph) {
+        if (!parseCallGraphRecord(line, callGraphRecords)) {
+          errs() << file << ":" << lineNumber
+                 << ": error: malformed call graph record\n";
+          return 2;
+        }
+        continue;
+      }
+      IdentifierRecord record;
+      if (!parseIdentifierRecord(line, record)) {
+        errs() << file << ":" << lineNumber
+               << ": error: malformed identifier record\n";
+        return 2;
+      }
+      record.order = records.size();
+      records.push_back(record);
+    }
+    buffers.push_back(std::move(*buffer));
+  }
+
+  std::vector<IdentifierCollision> collisions;
+  findIdentifierCollisions(records, collisions);
+  for (const IdentifierCollision &collision : collisions) {
+    reportCollision(collision);
+  }
+
+  std::vector<RecursiveCycle> cycles;
+  findRecursiveCycles(callGraphRecords, cycles);
+  for (const RecursiveCycle &cycle : cycles) {
+    reportCycle(callGraphRecords, cycle);
+  }
+  return collisions.empty() && cycles.empty() ? 0 : 1;
+}
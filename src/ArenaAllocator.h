@@ -0,0 +1,88 @@
+//===-  ArenaAllocator.h - Arena-backed containers for checker state-------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ARENA_ALLOCATOR_H
+#define ARENA_ALLOCATOR_H
+
+#include "llvm/Support/Allocator.h"
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <new>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace misracpp2008 {
+
+/// \brief Standard library compatible allocator which hands out memory from a
+/// llvm::BumpPtrAllocator.
+///
+/// Deallocation is a no-op. All the memory gets released in one shot as soon
+/// as the underlying arena is destroyed, which happens when the owning checker
+/// is done with the translation unit.
+template <typename T> class ArenaAllocator {
+public:
+  using value_type = T;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  template <typename U> struct rebind { using other = ArenaAllocator<U>; };
+
+  explicit ArenaAllocator(llvm::BumpPtrAllocator &arena) : arena(&arena) {}
+
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U> &other)
+      : arena(&other.getArena()) {}
+
+  pointer allocate(size_type n, const void * = nullptr) {
+    return static_cast<pointer>(arena->Allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(pointer, size_type) {}
+
+  size_type max_size() const { return ~size_type(0) / sizeof(T); }
+
+  template <typename U, typename... Args> void construct(U *p, Args &&... args) {
+    ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...);
+  }
+
+  template <typename U> void destroy(U *p) { p->~U(); }
+
+  llvm::BumpPtrAllocator &getArena() const { return *arena; }
+
+private:
+  llvm::BumpPtrAllocator *arena;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) {
+  return &lhs.getArena() == &rhs.getArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) {
+  return !(lhs == rhs);
+}
+
+/// \brief std::vector whose storage lives in a checker arena.
+template <typename T> using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+/// \brief std::set whose nodes live in a checker arena.
+template <typename T>
+using ArenaSet = std::set<T, std::less<T>, ArenaAllocator<T>>;
+
+/// \brief std::multimap whose nodes live in a checker arena.
+template <typename K, typename V>
+using ArenaMultimap =
+    std::multimap<K, V, std::less<K>, ArenaAllocator<std::pair<const K, V>>>;
+}
+
+#endif
@@ -11,14 +11,23 @@
 //===----------------------------------------------------------------------===//
 
 #include "misracpp2008.h"
+#include "BannedSymbols.h"
+#include "ControlFlowCache.h"
+#include "EvaluationCache.h"
 #include "clang/AST/ASTConsumer.h"
 #include "clang/AST/AST.h"
 #include "clang/Frontend/CompilerInstance.h"
 #include "clang/Frontend/FrontendPluginRegistry.h"
+#include "clang/Basic/SourceManager.h"
 #include "clang/Lex/Preprocessor.h"
+#include "llvm/ADT/Hashing.h"
+#include "llvm/ADT/SmallString.h"
 #include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Support/Regex.h"
+#include <algorithm>
 #include <cassert>
 #include <list>
 #include <map>
@@ -26,7 +35,9 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <system_error>
 #include <utility>
+#include <vector>
 
 using namespace clang;
 using namespace llvm;
@@ -34,14 +45,18 @@ using namespace llvm;
 namespace misracpp2008 {
 
 using DiagLevelMap = std::map<std::string, clang::DiagnosticsEngine::Level>;
+using ArenaUsage = std::vector<std::pair<std::string, size_t>>;
 DiagLevelMap &getDiagnosticLevels();
 std::set<std::string> &getEnabledCheckers();
 std::set<std::string> &getRegisteredCheckerNames();
 std::list<llvm::Regex> &getIgnoredPaths();
+bool &getPrintStatistics();
 bool enableChecker(const std::string &name,
                    clang::DiagnosticsEngine::Level diagLevel);
 void dumpRegisteredCheckers(llvm::raw_ostream &OS);
 void dumpActiveCheckers(llvm::raw_ostream &OS);
+void dumpArenaUsage(llvm::raw_ostream &OS, llvm::StringRef fileName,
+                    const ArenaUsage &arenaUsage);
 
 void RuleChecker::setDiagLevel(DiagnosticsEngine::Level diagLevel) {
   this->diagLevel = diagLevel;
@@ -54,6 +69,26 @@ void RuleChecker::setName(const std::string &name) {
 
 void RuleChecker::setCompilerInstance(CompilerInstance &ci) { this->CI = &ci; }
 
+void RuleChecker::setSharedAnalyses(SharedAnalyses &sharedAnalyses) {
+  this->sharedAnalyses = &sharedAnalyses;
+}
+
+void SharedAnalyses::printStatistics(raw_ostream &OS) const {
+  for (const auto &analysis : analyses) {
+    analysis.second->printStatistics(OS);
+  }
+}
+
+size_t RuleChecker::getArenaBytesAllocated() const {
+  return arena.getBytesAllocated();
+}
+
+StringRef RuleChecker::copyToArena(StringRef str) {
+  char *buffer = arena.Allocate<char>(str.size());
+  std::copy(str.begin(), str.end(), buffer);
+  return StringRef(buffer, str.size());
+}
+
 bool RuleChecker::isInSystemHeader(clang::SourceLocation loc) {
   const SourceManager &sourceManager = CI->getSourceManager();
   return sourceManager.isInSystemHeader(loc);
@@ -123,6 +158,49 @@ std::list<llvm::Regex> &getIgnoredPaths() {
   return ignoredPaths;
 }
 
+bool &getPrintStatistics() {
+  static bool printStatistics = false;
+  return printStatistics;
+}
+
+std::string &getProjectDataDirectory() {
+  static std::string projectDataDirectory;
+  return projectDataDirectory;
+}
+
+std::string normalizeFileName(StringRef fileName) {
+  SmallString<256> path(fileName);
+  sys::fs::make_absolute(path);
+  sys::path::remove_dots(path, true);
+  return path.str();
+}
+
+std::unique_ptr<raw_fd_ostream> openProjectDataFile(CompilerInstance &CI,
+                                                    StringRef extension) {
+  const SourceManager &SM = CI.getSourceManager();
+  const FileEntry *mainFile = SM.getFileEntryForID(SM.getMainFileID());
+  const std::string mainFileName =
+      normalizeFileName(mainFile ? mainFile->getName() : "stdin");
+
+  // The hash keeps main files of the same name in different directories
+  // apart.
+  SmallString<256> path(getProjectDataDirectory());
+  sys::path::append(path, sys::path::filename(mainFileName) + "-" +
+                              utohexstr(hash_value(mainFileName)) + extension);
+
+  std::error_code EC;
+  std::unique_ptr<raw_fd_ostream> OS(
+      new raw_fd_ostream(path, EC, sys::fs::F_Text));
+  if (EC) {
+    DiagnosticsEngine &diags = CI.getDiagnostics();
+    diags.Report(diags.getCustomDiagID(DiagnosticsEngine::Error,
+                                       "unable to write '%0': %1"))
+        << path.str() << EC.message();
+    return nullptr;
+  }
+  return OS;
+}
+
 bool enableChecker(const std::string &checkerName,
                    clang::DiagnosticsEngine::Level diagLevel) {
   if (getRegisteredCheckerNames().count(checkerName) == 0) {
@@ -146,13 +224,37 @@ void dumpActiveCheckers(raw_ostream &OS) {
                                         std::end(checkers), ", ") << "\n";
 }
 
+void dumpArenaUsage(raw_ostream &OS, StringRef fileName,
+                    const ArenaUsage &arenaUsage) {
+  OS << "Checker arena usage for '" << fileName << "':\n";
+  size_t totalBytes = 0;
+  for (const auto &checkerUsage : arenaUsage) {
+    OS << "  " << checkerUsage.first << ": " << checkerUsage.second
+       << " bytes\n";
+    totalBytes += checkerUsage.second;
+  }
+  OS << "  total: " << totalBytes << " bytes\n";
+}
+
+using PPCheckerList =
+    std::vector<std::pair<std::string, const RuleCheckerPPCallback *>>;
+
 class Consumer : public clang::ASTConsumer {
 private:
   clang::CompilerInstance &CI;
+  /// Active preprocessor checkers. They are owned by the preprocessor.
+  const PPCheckerList ppCheckers;
+  /// Analyses shared by all the checkers of the translation unit.
+  std::unique_ptr<SharedAnalyses> sharedAnalyses;
 
 public:
-  Consumer(clang::CompilerInstance &CI) : CI(CI) {}
+  Consumer(clang::CompilerInstance &CI, const PPCheckerList &ppCheckers,
+           std::unique_ptr<SharedAnalyses> sharedAnalyses)
+      : CI(CI), ppCheckers(ppCheckers),
+        sharedAnalyses(std::move(sharedAnalyses)) {}
   virtual void HandleTranslationUnit(clang::ASTContext &ctx) override {
+    ArenaUsage arenaUsage;
+
     // Iterate over registered ASTContext checkers and execute the ones active
     const auto &enabledCheckers = getEnabledCheckers();
     for (RuleCheckerASTContextRegistry::iterator
@@ -166,10 +268,25 @@ public:
         auto instance = it->instantiate();
         instance->setCompilerInstance(CI);
         instance->setContext(ctx);
+        instance->setSharedAnalyses(*sharedAnalyses);
         instance->setDiagLevel(diagLevel);
         instance->setName(checkerName);
         instance->doWork();
+        arenaUsage.emplace_back(checkerName,
+                                instance->getArenaBytesAllocated());
+      }
+    }
+
+    if (getPrintStatistics()) {
+      for (const auto &ppChecker : ppCheckers) {
+        arenaUsage.emplace_back(ppChecker.first + " (preprocessor)",
+                                ppChecker.second->getArenaBytesAllocated());
       }
+      const SourceManager &sm = ctx.getSourceManager();
+      const FileEntry *mainFile = sm.getFileEntryForID(sm.getMainFileID());
+      dumpArenaUsage(llvm::outs(), mainFile ? mainFile->getName() : "<stdin>",
+                     arenaUsage);
+      sharedAnalyses->printStatistics(llvm::outs());
     }
   }
 };
@@ -182,7 +299,10 @@ protected:
     dumpRegisteredCheckers(llvm::outs());
     dumpActiveCheckers(llvm::outs());
 
+    std::unique_ptr<SharedAnalyses> sharedAnalyses(new SharedAnalyses(CI));
+
     // Iterate over registered preprocessor checkers and execute the ones active
+    PPCheckerList ppCheckers;
     const auto &enabledCheckers = getEnabledCheckers();
     for (RuleCheckerPreprocessorRegistry::iterator
              it = RuleCheckerPreprocessorRegistry::begin(),
@@ -198,11 +318,14 @@ protected:
         ppCallback->setDiagLevel(diagLevel);
         ppCallback->setCompilerInstance(CI);
         ppCallback->setName(checkerName);
+        ppCallback->setSharedAnalyses(*sharedAnalyses);
+        ppCheckers.emplace_back(checkerName, ppCallback.get());
         CI.getPreprocessor().addPPCallbacks(
             std::unique_ptr<PPCallbacks>(ppCallback.release()));
       }
     }
-    return std::unique_ptr<ASTConsumer>(new Consumer(CI));
+    return std::unique_ptr<ASTConsumer>(
+        new Consumer(CI, ppCheckers, std::move(sharedAnalyses)));
   }
 
   virtual bool ParseArgs(const clang::CompilerInstance &CI,
@@ -213,6 +336,28 @@ protected:
         PrintHelp(llvm::outs());
         return true;
       }
+      // Handle statistics request
+      if (currentString == "--print-stats") {
+        getPrintStatistics() = true;
+        continue;
+      }
+      // Handle --project-data arguments
+      const std::string projectDataArgument = "--project-data=";
+      if (currentString.find(projectDataArgument) == 0) {
+        getProjectDataDirectory() =
+            currentString.substr(projectDataArgument.length());
+        continue;
+      }
+      // Handle --banned-api arguments
+      const std::string bannedApiArgument = "--banned-api=";
+      if (currentString.find(bannedApiArgument) == 0) {
+        if (BannedSymbols::loadProjectList(
+                currentString.substr(bannedApiArgument.length()),
+                llvm::errs()) == false) {
+          return false;
+        }
+        continue;
+      }
       // Handle --exclude-path arguments
       const std::string excludeArgument = "--exclude-path=";
       if (auto pos = currentString.find(excludeArgument) != std::string::npos) {
@@ -256,7 +401,13 @@ protected:
   void PrintHelp(llvm::raw_ostream &ros) {
     ros << "Available plugin parameters:\n";
     ros << "[--help] - show this text\n";
+    ros << "[--banned-api=FILE] - additionally report the functions and macros "
+           "listed in FILE\n";
     ros << "[--exclude-path=PATH] - do not check files matching PATH\n";
+    ros << "[--print-stats] - print checker statistics for each translation "
+           "unit\n";
+    ros << "[--project-data=DIR] - write the data needed by the project wide "
+           "rules to DIR\n";
     ros << "[all|-all|--all] - report all rule violations as "
            "error/warning/remark\n";
     ros << "[RULE|-RULE|--RULE] - report rule RULE violations as "
@@ -291,6 +442,16 @@ bool RuleCheckerASTContext::isInMainFile(const clang::SourceLocation loc) {
          (fullSrcLoc.getFileID() == sm.getMainFileID());
 }
 
+const APValue *
+RuleCheckerASTContext::evaluateConstant(const Expr *expr,
+                                        bool allowSideEffects) {
+  return getSharedAnalysis<EvaluationCache>().evaluate(expr, allowSideEffects);
+}
+
+const CFG *RuleCheckerASTContext::getCFG(const FunctionDecl *function) {
+  return getSharedAnalysis<ControlFlowCache>().getCFG(function);
+}
+
 void RuleCheckerASTContext::doWork() {
   assert(context && "The context has to be set before calling this function.");
   assert(CI);
@@ -10,21 +10,98 @@
 #include "clang/Basic/Diagnostic.h"
 #include "clang/Frontend/CompilerInstance.h"
 #include "clang/Lex/PPCallbacks.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Allocator.h"
 #include "llvm/Support/Registry.h"
+#include "ArenaAllocator.h"
 #include "RuleHeadlineTexts.h"
+#include <cassert>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace clang {
+class APValue;
+class CFG;
 class CompilerInstance;
+class Expr;
+class FunctionDecl;
 class IdentifierTable;
 class ASTContext;
 }
 
 namespace llvm {
+class raw_fd_ostream;
 class raw_ostream;
 }
 
 namespace misracpp2008 {
 
+/// \brief Directory the per translation unit data of the project wide rules
+/// gets written to.
+/// \return Path of the directory, empty if no data should be written.
+std::string &getProjectDataDirectory();
+
+/// \brief Make \c fileName absolute and remove the dots from it, so a file
+/// included by several translation units is written the same way by all of
+/// them.
+std::string normalizeFileName(llvm::StringRef fileName);
+
+/// \brief Open the file the project data of the current translation unit
+/// gets written to. There is one file per translation unit and kind of data,
+/// named after the main file.
+/// \param CI Compiler instance of the translation unit.
+/// \param extension Extension telling the kind of data, e.g. ".misra-ids".
+/// \return The opened file, nullptr if it could not be opened. The error has
+/// been reported then.
+std::unique_ptr<llvm::raw_fd_ostream>
+openProjectDataFile(clang::CompilerInstance &CI, llvm::StringRef extension);
+
+/// \brief Base class for analyses whose results are shared by all the
+/// checkers of a translation unit.
+///
+/// Derived classes declare a <tt>static char ID</tt> to be identified by and
+/// a constructor taking the clang::CompilerInstance. They are created on the
+/// first request and live until the translation unit has been checked.
+class SharedAnalysis {
+public:
+  virtual ~SharedAnalysis() {}
+
+  /// \brief Print statistics about the work done for the current translation
+  /// unit. Called if the user asked for statistics.
+  /// \param OS Stream to print to.
+  virtual void printStatistics(llvm::raw_ostream &OS) const {}
+};
+
+/// \brief Owner of the shared analyses of a translation unit.
+class SharedAnalyses {
+public:
+  explicit SharedAnalyses(clang::CompilerInstance &CI) : CI(CI) {}
+
+  /// \brief Get the analysis \c T, creating it if this is the first request.
+  template <typename T> T &get() {
+    for (const auto &analysis : analyses) {
+      if (analysis.first == &T::ID) {
+        return static_cast<T &>(*analysis.second);
+      }
+    }
+    T *analysis = new T(CI);
+    analyses.emplace_back(&T::ID, std::unique_ptr<SharedAnalysis>(analysis));
+    return *analysis;
+  }
+
+  /// \brief Print the statistics of all the analyses created so far.
+  void printStatistics(llvm::raw_ostream &OS) const;
+
+private:
+  clang::CompilerInstance &CI;
+  /// Analyses in the order of their creation, keyed by the address of their
+  /// ID. There are only a handful of them, so a linear search is fine.
+  std::vector<std::pair<const void *, std::unique_ptr<SharedAnalysis>>>
+      analyses;
+};
+
 /// \brief Base class for all rule checker implementations.
 class RuleChecker {
 protected:
@@ -37,6 +114,30 @@ protected:
   ///  violation.
   bool doIgnoreSystemHeaders = true; ///< Should we skip the system headers?
   std::string name = "?";            ///< Name of rule this checker enforces.
+  SharedAnalyses *sharedAnalyses = nullptr; ///< Analyses shared with the
+                                            /// other checkers.
+  llvm::BumpPtrAllocator arena; ///< Memory for the checker state. Released in
+                                /// one shot along with the checker at the end
+                                /// of the translation unit.
+
+  /// \brief Get an allocator for containers holding checker state.
+  /// \return Allocator handing out memory from the arena of this checker.
+  template <typename T> ArenaAllocator<T> getArenaAllocator() {
+    return ArenaAllocator<T>(arena);
+  }
+
+  /// \brief Copy \c str into the arena of this checker.
+  /// \param str String to be copied.
+  /// \return Reference to the copy, valid as long as this checker lives.
+  llvm::StringRef copyToArena(llvm::StringRef str);
+
+  /// \brief Get an analysis shared with the other checkers of the translation
+  /// unit.
+  /// \return The analysis \c T, computed at most once per translation unit.
+  template <typename T> T &getSharedAnalysis() {
+    assert(sharedAnalyses && "Shared analyses have to be set.");
+    return sharedAnalyses->get<T>();
+  }
 
   /// \brief Check whether or not \c loc is within a system header.
   /// \param loc Location within the translation unit to be tested.
@@ -106,6 +207,14 @@ public:
   /// reported.
   /// \param CI Compiler instance to be used by the checker.
   void setCompilerInstance(clang::CompilerInstance &CI);
+
+  /// \brief Set the shared analyses of the translation unit to be checked.
+  /// \param sharedAnalyses Analyses shared by all the active checkers.
+  void setSharedAnalyses(SharedAnalyses &sharedAnalyses);
+
+  /// \brief Number of bytes this checker has allocated from its arena.
+  /// \return Allocated bytes, not including slab overhead.
+  size_t getArenaBytesAllocated() const;
 };
 
 /// \brief Base class for all rule checkers that work on the AST.
@@ -126,6 +235,20 @@ protected:
   /// \return True if \c loc is located in the main source file.
   bool isInMainFile(const clang::SourceLocation loc);
 
+  /// \brief Evaluate \c expr at compile time. The result is shared with the
+  /// other checkers, every expression gets evaluated at most once.
+  /// \param expr Expression to evaluate.
+  /// \param allowSideEffects Also accept expressions with side effects.
+  /// \return The value of \c expr, or nullptr if it is no constant.
+  const clang::APValue *evaluateConstant(const clang::Expr *expr,
+                                         bool allowSideEffects = false);
+
+  /// \brief Get the control flow graph of \c function. The graph is shared
+  /// with the other checkers, it gets built at most once per function.
+  /// \param function Function to get the graph of.
+  /// \return The graph, nullptr if \c function has no body or is a template.
+  const clang::CFG *getCFG(const clang::FunctionDecl *function);
+
 public:
   /// \brief Set the AST context to be working on when calling doWork().
   /// \param context New AST context to be used by this instance.
@@ -0,0 +1,276 @@
+//===-  CallGraphRecords.cpp - Calls between the functions of a project----===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "CallGraphRecords.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+#include <deque>
+
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+namespace {
+
+const unsigned none = ~0u;
+
+/// \brief The call graph in compressed sparse row form: the edges leaving
+/// node N are the ones in [edgeBegin[N], edgeBegin[N + 1]).
+struct CallGraph {
+  std::vector<unsigned> edgeBegin;
+  std::vector<unsigned> sources;
+  std::vector<unsigned> targets;
+  /// Index of the call record of each edge, none for the edges of the
+  /// virtual dispatch.
+  std::vector<unsigned> calls;
+
+  unsigned getNodeCount() const {
+    return static_cast<unsigned>(edgeBegin.size() - 1);
+  }
+};
+
+unsigned getBodyNode(unsigned function) { return 2 * function; }
+unsigned getDispatchNode(unsigned function) { return 2 * function + 1; }
+
+void buildGraph(const CallGraphRecords &records, CallGraph &graph) {
+  struct Edge {
+    unsigned source;
+    unsigned target;
+    unsigned call;
+  };
+
+  llvm::StringMap<unsigned> functions;
+  auto getFunction = [&functions](StringRef key) {
+    return functions.insert(std::make_pair(key, functions.size()))
+        .first->second;
+  };
+  std::vector<Edge> edges;
+  edges.reserve(records.calls.size() + records.overrides.size());
+  for (unsigned call = 0, e = records.calls.size(); call != e; ++call) {
+    const CallRecord &record = records.calls[call];
+    const unsigned caller = getFunction(record.caller);
+    const unsigned callee = getFunction(record.callee);
+    edges.push_back(Edge{getBodyNode(caller),
+                         record.kind == CallKind::Virtual
+                             ? getDispatchNode(callee)
+                             : getBodyNode(callee),
+                         call});
+  }
+  for (const OverrideRecord &record : records.overrides) {
+    edges.push_back(Edge{getDispatchNode(getFunction(record.overridden)),
+                         getDispatchNode(getFunction(record.overrider)),
+                         none});
+  }
+  const unsigned functionCount = functions.size();
+  for (unsigned function = 0; function != functionCount; ++function) {
+    edges.push_back(
+        Edge{getDispatchNode(function), getBodyNode(function), none});
+  }
+
+  // Counting sort of the edges by their source.
+  const unsigned nodeCount = 2 * functionCount;
+  graph.edgeBegin.assign(nodeCount + 1, 0);
+  for (const Edge &edge : edges) {
+    ++graph.edgeBegin[edge.source + 1];
+  }
+  for (unsigned node = 0; node != nodeCount; ++node) {
+    graph.edgeBegin[node + 1] += graph.edgeBegin[node];
+  }
+  std::vector<unsigned> position(graph.edgeBegin.begin(),
+                                 graph.edgeBegin.end() - 1);
+  graph.sources.resize(edges.size());
+  graph.targets.resize(edges.size());
+  graph.calls.resize(edges.size());
+  for (const Edge &edge : edges) {
+    const unsigned slot = position[edge.source]++;
+    graph.sources[slot] = edge.source;
+    graph.targets[slot] = edge.target;
+    graph.calls[slot] = edge.call;
+  }
+}
+
+/// \brief Tarjan's algorithm with an explicit stack, so deep call chains do
+/// not exhaust the stack of the tool.
+/// \param component Output for the strongly connected component of each
+/// node.
+void findComponents(const CallGraph &graph, std::vector<unsigned> &component) {
+  struct Frame {
+    unsigned node;
+    unsigned nextEdge;
+  };
+
+  const unsigned nodeCount = graph.getNodeCount();
+  std::vector<unsigned> index(nodeCount, none);
+  std::vector<unsigned> lowLink(nodeCount);
+  std::vector<bool> isOnStack(nodeCount);
+  std::vector<unsigned> stack;
+  std::vector<Frame> frames;
+  component.assign(nodeCount, none);
+  unsigned nextIndex = 0;
+  unsigned componentCount = 0;
+
+  auto enter = [&](unsigned node) {
+    index[node] = lowLink[node] = nextIndex++;
+    stack.push_back(node);
+    isOnStack[node] = true;
+    frames.push_back(Frame{node, graph.edgeBegin[node]});
+  };
+
+  for (unsigned root = 0; root != nodeCount; ++root) {
+    if (index[root] != none) {
+      continue;
+    }
+    enter(root);
+    while (!frames.empty()) {
+      const unsigned node = frames.back().node;
+      if (frames.back().nextEdge != graph.edgeBegin[node + 1]) {
+        const unsigned target = graph.targets[frames.back().nextEdge++];
+        if (index[target] == none) {
+          enter(target);
+        } else if (isOnStack[target]) {
+          lowLink[node] = std::min(lowLink[node], index[target]);
+        }
+        continue;
+      }
+
+      if (lowLink[node] == index[node]) {
+        unsigned member;
+        do {
+          member = stack.back();
+          stack.pop_back();
+          isOnStack[member] = false;
+          component[member] = componentCount;
+        } while (member != node);
+        ++componentCount;
+      }
+      frames.pop_back();
+      if (!frames.empty()) {
+        const unsigned parent = frames.back().node;
+        lowLink[parent] = std::min(lowLink[parent], lowLink[node]);
+      }
+    }
+  }
+}
+}
+
+void writeCallRecord(llvm::raw_ostream &OS, const CallRecord &record) {
+  OS << 'c' << '\t' << static_cast<char>(record.kind) << '\t' << record.caller
+     << '\t' << record.callee << '\t' << record.calleeName << '\t'
+     << record.location << '\n';
+}
+
+void writeOverrideRecord(llvm::raw_ostream &OS, const OverrideRecord &record) {
+  OS << 'o' << '\t' << record.overridden << '\t' << record.overrider << '\n';
+}
+
+bool parseCallGraphRecord(StringRef line, CallGraphRecords &records) {
+  llvm::SmallVector<StringRef, 6> fields;
+  line.split(fields, "\t");
+  if (fields[0] == "o") {
+    if (fields.size() != 3 || fields[1].empty() || fields[2].empty()) {
+      return false;
+    }
+    records.overrides.push_back(OverrideRecord{fields[1], fields[2]});
+    return true;
+  }
+  if (fields[0] != "c" || fields.size() != 6 || fields[1].size() != 1 ||
+      fields[2].empty() || fields[3].empty()) {
+    return false;
+  }
+
+  CallRecord record;
+  switch (fields[1][0]) {
+  case 'd':
+  case 'v':
+    record.kind = static_cast<CallKind>(fields[1][0]);
+    break;
+  default:
+    return false;
+  }
+  record.caller = fields[2];
+  record.callee = fields[3];
+  record.calleeName = fields[4];
+  record.location = fields[5];
+  record.order = records.calls.size();
+  records.calls.push_back(record);
+  return true;
+}
+
+void findRecursiveCycles(const CallGraphRecords &records,
+                         std::vector<RecursiveCycle> &cycles) {
+  CallGraph graph;
+  buildGraph(records, graph);
+  std::vector<unsigned> component;
+  findComponents(graph, component);
+
+  // The first call of a cycle is the first call recorded within its
+  // component, so the cycle reported does not depend on the order the
+  // components are found in.
+  const unsigned nodeCount = graph.getNodeCount();
+  std::vector<unsigned> firstCallEdge(nodeCount, none);
+  for (unsigned node = 0; node != nodeCount; ++node) {
+    for (unsigned edge = graph.edgeBegin[node];
+         edge != graph.edgeBegin[node + 1]; ++edge) {
+      const unsigned call = graph.calls[edge];
+      unsigned &first = firstCallEdge[component[node]];
+      if (call == none || component[graph.targets[edge]] != component[node] ||
+          (first != none && graph.calls[first] <= call)) {
+        continue;
+      }
+      first = edge;
+    }
+  }
+
+  // Close each cycle with a breadth first search from the callee of its
+  // first call back to the caller, within the component. Every node belongs
+  // to one component, so the marks need no reset between the searches.
+  std::vector<unsigned> reachedBy(nodeCount, none);
+  std::deque<unsigned> worklist;
+  for (unsigned first : firstCallEdge) {
+    if (first == none) {
+      continue;
+    }
+    const unsigned start = graph.sources[first];
+    const unsigned restart = graph.targets[first];
+    worklist.assign(1, restart);
+    reachedBy[restart] = first;
+    while (reachedBy[start] == none) {
+      const unsigned node = worklist.front();
+      worklist.pop_front();
+      for (unsigned edge = graph.edgeBegin[node];
+           edge != graph.edgeBegin[node + 1]; ++edge) {
+        const unsigned target = graph.targets[edge];
+        if (component[target] == component[start] &&
+            reachedBy[target] == none) {
+          reachedBy[target] = edge;
+          worklist.push_back(target);
+        }
+      }
+    }
+
+    RecursiveCycle cycle;
+    for (unsigned node = start; node != restart;) {
+      const unsigned edge = reachedBy[node];
+      if (graph.calls[edge] != none) {
+        cycle.calls.push_back(graph.calls[edge]);
+      }
+      node = graph.sources[edge];
+    }
+    cycle.calls.push_back(graph.calls[first]);
+    std::reverse(cycle.calls.begin(), cycle.calls.end());
+    cycles.push_back(std::move(cycle));
+  }
+
+  std::sort(cycles.begin(), cycles.end(),
+            [&records](const RecursiveCycle &lhs, const RecursiveCycle &rhs) {
+              return records.calls[lhs.calls.front()].order <
+                     records.calls[rhs.calls.front()].order;
+            });
+}
+}
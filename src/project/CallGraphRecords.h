@@ -0,0 +1,89 @@
+//===-  CallGraphRecords.h - Calls between the functions of a project------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the records describing the calls made by a translation
+// unit, their text format and the detection of recursion against rule 7-5-4.
+// The code does not depend on Clang, it is shared by the plugin and the tool
+// merging the records of all the translation units of a project.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MISRA_CPP_2008_CALL_GRAPH_RECORDS_H
+#define MISRA_CPP_2008_CALL_GRAPH_RECORDS_H
+
+#include "llvm/ADT/StringRef.h"
+#include <vector>
+
+namespace llvm {
+class raw_ostream;
+}
+
+namespace misracpp2008 {
+
+/// \brief How a call reaches its callee.
+enum class CallKind : char {
+  Direct = 'd', ///< Calls the body of the callee.
+  Virtual = 'v' ///< Calls the callee or any of its overriders.
+};
+
+/// \brief A call of a function. Functions are identified by a key which names
+/// the same function in all the translation units of a project.
+struct CallRecord {
+  llvm::StringRef caller;     ///< Key of the calling function.
+  llvm::StringRef callee;     ///< Key of the called function.
+  llvm::StringRef calleeName; ///< Qualified name of the called function.
+  llvm::StringRef location;   ///< "file:line:column" of the call.
+  CallKind kind;
+  /// Position of the record in its input, used to report in a stable order.
+  unsigned order;
+};
+
+/// \brief A virtual function overriding another one.
+struct OverrideRecord {
+  llvm::StringRef overridden; ///< Key of the overridden function.
+  llvm::StringRef overrider;  ///< Key of the overriding function.
+};
+
+/// \brief The records of a translation unit or of a whole project.
+struct CallGraphRecords {
+  std::vector<CallRecord> calls;
+  std::vector<OverrideRecord> overrides;
+};
+
+/// \brief A cycle of calls against rule 7-5-4.
+struct RecursiveCycle {
+  /// Indices of the calls making up the cycle, in the order they are made.
+  /// The callee of the last call is the caller of the first one.
+  std::vector<unsigned> calls;
+};
+
+/// \brief Write \c record as a single line of tab separated values.
+void writeCallRecord(llvm::raw_ostream &OS, const CallRecord &record);
+
+/// \brief Write \c record as a single line of tab separated values.
+void writeOverrideRecord(llvm::raw_ostream &OS, const OverrideRecord &record);
+
+/// \brief Parse a line written by writeCallRecord() or writeOverrideRecord()
+/// and add it to \c records.
+/// \param line Line to be parsed. The record refers to its memory.
+/// \param records Records to add to. The order of a call record is its index.
+/// \return False if \c line is malformed.
+bool parseCallGraphRecord(llvm::StringRef line, CallGraphRecords &records);
+
+/// \brief Find the cycles of calls against rule 7-5-4.
+///
+/// Each function gets a node for its body and one for the virtual dispatch
+/// to it. A virtual call leads to the dispatch node, which leads to the body
+/// and to the dispatch nodes of the overriders. The strongly connected
+/// components of the graph are found in linear time, one representative
+/// cycle is reported per component.
+/// \param records Records of the translation unit or the project.
+/// \param cycles Output for the cycles found, ordered by their first call.
+void findRecursiveCycles(const CallGraphRecords &records,
+                         std::vector<RecursiveCycle> &cycles);
+}
+
+#endif
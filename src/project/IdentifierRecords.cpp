@@ -0,0 +1,201 @@
+//===-  IdentifierRecords.cpp - Identifiers declared in a project----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IdentifierRecords.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+namespace {
+
+bool isExternal(const IdentifierRecord &record) {
+  return record.linkage == IdentifierLinkage::External;
+}
+
+/// \brief Strict weak ordering grouping the records by name first and by the
+/// entity they name second. The records of an entity are ordered by their
+/// position in the input.
+bool recordLess(const IdentifierRecord &lhs, const IdentifierRecord &rhs) {
+  if (lhs.name != rhs.name) {
+    return lhs.name < rhs.name;
+  }
+  if (isExternal(lhs) != isExternal(rhs)) {
+    return isExternal(lhs);
+  }
+  if (isExternal(lhs)) {
+    if (lhs.kind != rhs.kind) {
+      return lhs.kind < rhs.kind;
+    }
+    if (lhs.scope != rhs.scope) {
+      return lhs.scope < rhs.scope;
+    }
+  } else if (lhs.location != rhs.location) {
+    return lhs.location < rhs.location;
+  }
+  return lhs.order < rhs.order;
+}
+
+bool orderLess(const IdentifierRecord *lhs, const IdentifierRecord *rhs) {
+  return lhs->order < rhs->order;
+}
+
+StringRef getFileName(StringRef location) {
+  return location.rsplit(':').first.rsplit(':').first;
+}
+
+bool isTypeName(const IdentifierRecord &record) {
+  return record.kind == IdentifierKind::Typedef ||
+         record.kind == IdentifierKind::Tag;
+}
+
+/// \brief Tell whether two distinct entities sharing a name are fine as far
+/// as the uniqueness rules are concerned. Both have to be declared in the same
+/// scope of the same file.
+bool isAllowedReuse(const IdentifierRecord &lhs, const IdentifierRecord &rhs) {
+  if (lhs.scope != rhs.scope ||
+      getFileName(lhs.location) != getFileName(rhs.location)) {
+    return false;
+  }
+  // typedef struct S { } S; In C++ a typedef and a class of the same name in
+  // the same scope necessarily denote the same type.
+  if (isTypeName(lhs) && isTypeName(rhs) && lhs.kind != rhs.kind) {
+    return true;
+  }
+  // Overloads of a function with internal linkage.
+  return lhs.kind == IdentifierKind::Function &&
+         rhs.kind == IdentifierKind::Function;
+}
+
+/// \brief Report all the entities in \c entities against the first one
+/// matching \c isUnique.
+template <typename Predicate>
+void findReuses(const char *rule,
+                llvm::ArrayRef<const IdentifierRecord *> entities,
+                Predicate isUnique,
+                std::vector<IdentifierCollision> &collisions) {
+  auto anchorIt = std::find_if(
+      entities.begin(), entities.end(),
+      [&isUnique](const IdentifierRecord *entity) { return isUnique(*entity); });
+  if (anchorIt == entities.end()) {
+    return;
+  }
+  const IdentifierRecord &anchor = **anchorIt;
+  for (const IdentifierRecord *entity : entities) {
+    if (entity == &anchor || isAllowedReuse(anchor, *entity)) {
+      continue;
+    }
+    // Report at the later one of both declarations.
+    if (entity->order < anchor.order) {
+      collisions.push_back(IdentifierCollision{rule, anchor, *entity});
+    } else {
+      collisions.push_back(IdentifierCollision{rule, *entity, anchor});
+    }
+  }
+}
+}
+
+bool isSameEntity(const IdentifierRecord &lhs, const IdentifierRecord &rhs) {
+  if (lhs.name != rhs.name || isExternal(lhs) != isExternal(rhs)) {
+    return false;
+  }
+  if (isExternal(lhs)) {
+    return lhs.kind == rhs.kind && lhs.scope == rhs.scope;
+  }
+  return lhs.location == rhs.location;
+}
+
+void writeIdentifierRecord(llvm::raw_ostream &OS,
+                           const IdentifierRecord &record) {
+  OS << static_cast<char>(record.kind) << '\t'
+     << static_cast<char>(record.linkage) << '\t'
+     << (record.isStatic ? '1' : '0') << '\t' << record.scope << '\t'
+     << record.name << '\t' << record.location << '\n';
+}
+
+bool parseIdentifierRecord(StringRef line, IdentifierRecord &record) {
+  llvm::SmallVector<StringRef, 6> fields;
+  line.split(fields, "\t");
+  if (fields.size() != 6 || fields[0].size() != 1 || fields[1].size() != 1 ||
+      fields[2].size() != 1 || fields[4].empty()) {
+    return false;
+  }
+
+  switch (fields[0][0]) {
+  case 't':
+  case 'c':
+  case 'o':
+  case 'f':
+  case 'm':
+  case 'x':
+    record.kind = static_cast<IdentifierKind>(fields[0][0]);
+    break;
+  default:
+    return false;
+  }
+  switch (fields[1][0]) {
+  case 'e':
+  case 'i':
+  case 'n':
+    record.linkage = static_cast<IdentifierLinkage>(fields[1][0]);
+    break;
+  default:
+    return false;
+  }
+  record.isStatic = fields[2] == "1";
+  record.scope = fields[3];
+  record.name = fields[4];
+  record.location = fields[5];
+  return true;
+}
+
+void findIdentifierCollisions(std::vector<IdentifierRecord> &records,
+                              std::vector<IdentifierCollision> &collisions) {
+  std::sort(records.begin(), records.end(), recordLess);
+
+  llvm::SmallVector<const IdentifierRecord *, 8> entities;
+  for (size_t I = 0, E = records.size(), J; I != E; I = J) {
+    // All the records of the name are in [I, J). Keep the first record of
+    // every entity, the ones of an entity are adjacent.
+    entities.clear();
+    entities.push_back(&records[I]);
+    for (J = I + 1; J != E && records[J].name == records[I].name; ++J) {
+      if (!isSameEntity(*entities.back(), records[J])) {
+        entities.push_back(&records[J]);
+      }
+    }
+    if (entities.size() < 2) {
+      continue;
+    }
+
+    std::sort(entities.begin(), entities.end(), orderLess);
+    findReuses("2-10-3", entities,
+               [](const IdentifierRecord &record) {
+                 return record.kind == IdentifierKind::Typedef;
+               },
+               collisions);
+    findReuses("2-10-4", entities,
+               [](const IdentifierRecord &record) {
+                 return record.kind == IdentifierKind::Tag;
+               },
+               collisions);
+    findReuses("2-10-5", entities,
+               [](const IdentifierRecord &record) { return record.isStatic; },
+               collisions);
+  }
+
+  std::stable_sort(collisions.begin(), collisions.end(),
+                   [](const IdentifierCollision &lhs,
+                      const IdentifierCollision &rhs) {
+                     return lhs.offending.order < rhs.offending.order;
+                   });
+}
+}
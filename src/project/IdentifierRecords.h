@@ -0,0 +1,96 @@
+//===-  IdentifierRecords.h - Identifiers declared in a project------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+//
+// This file declares the records describing the identifiers declared by a
+// translation unit, their text format and the detection of identifiers being
+// reused against rules 2-10-3, 2-10-4 and 2-10-5. The code does not depend on
+// Clang, it is shared by the plugin and the tool merging the records of all
+// the translation units of a project.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MISRA_CPP_2008_IDENTIFIER_RECORDS_H
+#define MISRA_CPP_2008_IDENTIFIER_RECORDS_H
+
+#include "llvm/ADT/StringRef.h"
+#include <vector>
+
+namespace llvm {
+class raw_ostream;
+}
+
+namespace misracpp2008 {
+
+/// \brief Kind of a declared identifier, as far as the identifier uniqueness
+/// rules are concerned.
+enum class IdentifierKind : char {
+  Typedef = 't',  ///< Typedef or alias declaration.
+  Tag = 'c',      ///< Class, struct, union or enum.
+  Object = 'o',   ///< Non-member variable or parameter.
+  Function = 'f', ///< Non-member function.
+  Member = 'm',   ///< Data member or member function.
+  Other = 'x'     ///< Anything else, e.g. enumerators or template parameters.
+};
+
+/// \brief Linkage of a declared identifier.
+enum class IdentifierLinkage : char {
+  External = 'e', ///< Names the same entity in all translation units.
+  Internal = 'i', ///< Internal linkage, including unnamed namespaces.
+  None = 'n'      ///< No linkage, e.g. local variables and typedefs.
+};
+
+/// \brief A declared identifier.
+struct IdentifierRecord {
+  llvm::StringRef name;
+  llvm::StringRef scope;    ///< Qualified name of the declaring scope.
+  llvm::StringRef location; ///< "file:line:column" of the declaration.
+  IdentifierKind kind;
+  IdentifierLinkage linkage;
+  /// True for non-member objects with static storage duration and without
+  /// external linkage and for non-member functions with internal linkage.
+  bool isStatic;
+  /// Position of the record in its input, used to report in a stable order.
+  unsigned order;
+};
+
+/// \brief An identifier being reused against one of the rules 2-10-3, 2-10-4
+/// or 2-10-5.
+struct IdentifierCollision {
+  const char *rule; ///< Name of the violated rule, e.g. "2-10-3".
+  IdentifierRecord offending;
+  IdentifierRecord previous;
+};
+
+/// \brief Tell whether two records name the same entity. Entities with
+/// external linkage are identified by their kind, scope and name, all the
+/// other ones by the location of their declaration.
+bool isSameEntity(const IdentifierRecord &lhs, const IdentifierRecord &rhs);
+
+/// \brief Write \c record as a single line of tab separated values.
+void writeIdentifierRecord(llvm::raw_ostream &OS,
+                           const IdentifierRecord &record);
+
+/// \brief Parse a line written by writeIdentifierRecord().
+/// \param line Line to be parsed. The record refers to its memory.
+/// \param record Record to be filled in. The order is left untouched.
+/// \return False if \c line is malformed.
+bool parseIdentifierRecord(llvm::StringRef line, IdentifierRecord &record);
+
+/// \brief Find the identifiers being reused against rules 2-10-3, 2-10-4 and
+/// 2-10-5.
+///
+/// The records get sorted by name and entity, so all the declarations of a
+/// name end up next to each other and a single scan over them finds the
+/// collisions. Each offending entity is reported once per rule, at its first
+/// declaration.
+/// \param records Records of the project, reordered in place.
+/// \param collisions Output for the collisions found, ordered by the position
+/// of the offending record.
+void findIdentifierCollisions(std::vector<IdentifierRecord> &records,
+                              std::vector<IdentifierCollision> &collisions);
+}
+
+#endif
@@ -0,0 +1,722 @@
+//===-  AddressEscapes.cpp - Addresses outliving their objects-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AddressEscapes.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char AddressEscapes::ID = 0;
+
+namespace {
+
+/// \brief An object whose address an expression may yield.
+struct Origin {
+  enum Kind : uint8_t {
+    /// An automatic variable or a parameter passed by value.
+    Automatic,
+    /// The object bound to a reference parameter, or pointed to by a pointer
+    /// parameter.
+    Parameter
+  };
+
+  const VarDecl *var;
+  Kind kind;
+};
+
+typedef llvm::SmallVector<Origin, 2> Origins;
+
+/// \brief An object an address is stored in.
+struct Target {
+  enum Kind : uint8_t {
+    /// Not known, e.g. the object a local pointer points to.
+    Unknown,
+    /// A local variable, of the block at \c depth.
+    Local,
+    /// An object reached through a parameter or \c this.
+    Outside,
+    /// An object with static storage duration.
+    Static
+  };
+
+  Kind kind;
+  unsigned depth;
+};
+
+/// \brief A store of an address into an object.
+struct Store {
+  const Expr *value;
+  /// Whether \c value is bound to a reference rather than a pointer.
+  bool isReference;
+  Target target;
+  SourceLocation loc;
+};
+
+void addIndex(std::vector<unsigned> &indices, unsigned index) {
+  if (std::find(indices.begin(), indices.end(), index) == indices.end()) {
+    indices.push_back(index);
+  }
+}
+
+bool isLocalPointer(const VarDecl *var) {
+  return var != nullptr && var->hasLocalStorage() &&
+         var->getType()->isPointerType();
+}
+
+const VarDecl *getVariable(const Expr *expr) {
+  const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(expr->IgnoreParens());
+  return ref ? dyn_cast<VarDecl>(ref->getDecl()) : nullptr;
+}
+
+bool isInstanceMethod(const FunctionDecl *function) {
+  const CXXMethodDecl *method = dyn_cast_or_null<CXXMethodDecl>(function);
+  return method != nullptr && method->isInstance();
+}
+
+/// \brief Tell whether \c kind converts a pointer, or designates an object,
+/// without changing the object it refers to.
+bool isSameObjectCast(CastKind kind) {
+  switch (kind) {
+  case CK_NoOp:
+  case CK_BitCast:
+  case CK_LValueBitCast:
+  case CK_DerivedToBase:
+  case CK_UncheckedDerivedToBase:
+  case CK_BaseToDerived:
+  case CK_Dynamic:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/// \brief Analyzes a function: walks its body once, then resolves the
+/// origins of the addresses returned and stored. If \c callees is given, the
+/// functions called are collected instead, and nothing is resolved.
+class EscapeWalker {
+public:
+  EscapeWalker(AddressEscapes &escapes, const FunctionDecl &definition,
+               EscapeSummary &summary,
+               std::vector<EscapeViolation> *violations,
+               std::vector<const FunctionDecl *> *callees = nullptr)
+      : escapes(escapes), definition(definition), summary(summary),
+        violations(violations), callees(callees) {}
+
+  /// \return The number of stores of addresses found.
+  unsigned build() {
+    if (const CXXConstructorDecl *ctor =
+            dyn_cast<CXXConstructorDecl>(&definition)) {
+      for (const CXXCtorInitializer *init : ctor->inits()) {
+        const FieldDecl *field = init->getMember();
+        if (field != nullptr && (field->getType()->isPointerType() ||
+                                 field->getType()->isReferenceType())) {
+          stores.push_back(Store{init->getInit(),
+                                 field->getType()->isReferenceType(),
+                                 Target{Target::Outside, 0},
+                                 init->getSourceLocation()});
+        }
+        visit(init->getInit());
+      }
+    }
+    visit(definition.getBody());
+    if (callees != nullptr) {
+      return 0;
+    }
+    check();
+    return static_cast<unsigned>(stores.size());
+  }
+
+private:
+  AddressEscapes &escapes;
+  const FunctionDecl &definition;
+  EscapeSummary &summary;
+  /// Where to report the violations, nullptr if the function is not checked.
+  std::vector<EscapeViolation> *violations;
+  std::vector<const FunctionDecl *> *callees;
+  /// Depth of the current block, the parameters are at depth 0.
+  unsigned depth = 0;
+  llvm::DenseMap<const VarDecl *, unsigned> depths;
+  /// Values assigned to the local pointer variables and parameters.
+  llvm::DenseMap<const VarDecl *, std::vector<const Expr *>> values;
+  llvm::DenseMap<const VarDecl *, Origins> resolved;
+  /// Variables being resolved, the ones of a cycle of copies stay until the
+  /// first of them is resolved.
+  std::vector<const VarDecl *> resolving;
+  llvm::DenseMap<const VarDecl *, unsigned> resolvingPositions;
+  /// Lowest position in \c resolving of a variable the values collected so
+  /// far depend on.
+  unsigned lowestDependency = 0;
+  std::vector<const ReturnStmt *> returns;
+  std::vector<Store> stores;
+
+  void visit(const Stmt *stmt) {
+    if (stmt == nullptr) {
+      return;
+    }
+    // The condition and init variables of the selection and iteration
+    // statements live in a block of their own, enclosing the body.
+    if (isa<CompoundStmt>(stmt) || isa<IfStmt>(stmt) || isa<SwitchStmt>(stmt) ||
+        isa<ForStmt>(stmt) || isa<WhileStmt>(stmt) ||
+        isa<CXXForRangeStmt>(stmt)) {
+      ++depth;
+      for (const Stmt *child : stmt->children()) {
+        visit(child);
+      }
+      --depth;
+      return;
+    }
+    if (const LambdaExpr *lambda = dyn_cast<LambdaExpr>(stmt)) {
+      // The body is the one of the call operator, analyzed on its own.
+      for (const Expr *init : lambda->capture_inits()) {
+        visit(init);
+      }
+      return;
+    }
+
+    for (const Stmt *child : stmt->children()) {
+      visit(child);
+    }
+
+    if (const DeclStmt *declStmt = dyn_cast<DeclStmt>(stmt)) {
+      for (const Decl *decl : declStmt->decls()) {
+        if (const VarDecl *var = dyn_cast<VarDecl>(decl)) {
+          visitVariable(var);
+        }
+      }
+    } else if (const BinaryOperator *op = dyn_cast<BinaryOperator>(stmt)) {
+      if (op->getOpcode() == BO_Assign &&
+          op->getLHS()->getType()->isPointerType()) {
+        const VarDecl *var = getVariable(op->getLHS());
+        if (isLocalPointer(var)) {
+          values[var].push_back(op->getRHS());
+        }
+        stores.push_back(Store{op->getRHS(), false, classify(op->getLHS()),
+                               op->getOperatorLoc()});
+      }
+    } else if (const ReturnStmt *returnStmt = dyn_cast<ReturnStmt>(stmt)) {
+      if (returnStmt->getRetValue() != nullptr) {
+        returns.push_back(returnStmt);
+      }
+    } else if (const CallExpr *call = dyn_cast<CallExpr>(stmt)) {
+      visitCall(call->getDirectCallee(), getArguments(call));
+    } else if (const CXXConstructExpr *construct =
+                   dyn_cast<CXXConstructExpr>(stmt)) {
+      visitCall(construct->getConstructor(),
+                llvm::makeArrayRef(construct->getArgs(),
+                                   construct->getNumArgs()));
+    }
+  }
+
+  void visitVariable(const VarDecl *var) {
+    if (var->hasLocalStorage()) {
+      depths[var] = depth;
+      if (isLocalPointer(var) && var->getInit() != nullptr) {
+        values[var].push_back(var->getInit());
+      }
+      return;
+    }
+    // Static local variables are initialized once, with the addresses of
+    // the first call.
+    const QualType type = var->getType();
+    if (var->isStaticLocal() && var->getInit() != nullptr &&
+        (type->isPointerType() || type->isReferenceType())) {
+      stores.push_back(Store{var->getInit(), type->isReferenceType(),
+                             Target{Target::Static, 0}, var->getLocation()});
+    }
+  }
+
+  /// \brief Record the stores of the arguments \c callee keeps.
+  void visitCall(const FunctionDecl *callee,
+                 llvm::ArrayRef<const Expr *> arguments) {
+    if (callee == nullptr) {
+      return;
+    }
+    // Every call of the body is visited, including the ones whose result
+    // is resolved by collectReturned.
+    if (callees != nullptr) {
+      callees->push_back(callee);
+      return;
+    }
+    for (unsigned index : escapes.getSummary(callee).storedParameters) {
+      if (index < arguments.size() && index < callee->getNumParams()) {
+        stores.push_back(Store{
+            arguments[index],
+            callee->getParamDecl(index)->getType()->isReferenceType(),
+            Target{Target::Static, 0}, arguments[index]->getLocStart()});
+      }
+    }
+  }
+
+  /// \brief The arguments of \c call matching the parameters of the callee,
+  /// without the object of a member operator.
+  static llvm::ArrayRef<const Expr *> getArguments(const CallExpr *call) {
+    llvm::ArrayRef<const Expr *> arguments =
+        llvm::makeArrayRef(call->getArgs(), call->getNumArgs());
+    if (isa<CXXOperatorCallExpr>(call) && !arguments.empty() &&
+        isInstanceMethod(call->getDirectCallee())) {
+      return arguments.slice(1);
+    }
+    return arguments;
+  }
+
+  /// \brief Tell which object \c lhs, the left operand of an assignment,
+  /// designates.
+  Target classify(const Expr *lhs) const {
+    lhs = lhs->IgnoreParens();
+    if (const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(lhs)) {
+      const VarDecl *var = dyn_cast<VarDecl>(ref->getDecl());
+      if (var == nullptr) {
+        return Target{Target::Unknown, 0};
+      }
+      if (var->getType()->isReferenceType()) {
+        if (isa<ParmVarDecl>(var)) {
+          return Target{Target::Outside, 0};
+        }
+        return var->hasLocalStorage() && var->getInit() != nullptr
+                   ? classify(var->getInit())
+                   : Target{Target::Static, 0};
+      }
+      if (!var->hasLocalStorage()) {
+        return Target{Target::Static, 0};
+      }
+      auto it = depths.find(var);
+      return Target{Target::Local, it == depths.end() ? 0 : it->second};
+    }
+    if (const MemberExpr *member = dyn_cast<MemberExpr>(lhs)) {
+      if (isa<VarDecl>(member->getMemberDecl())) {
+        return Target{Target::Static, 0};
+      }
+      return member->isArrow() ? classifyPointee(member->getBase())
+                               : classify(member->getBase());
+    }
+    if (const UnaryOperator *op = dyn_cast<UnaryOperator>(lhs)) {
+      return op->getOpcode() == UO_Deref ? classifyPointee(op->getSubExpr())
+                                         : Target{Target::Unknown, 0};
+    }
+    if (const ArraySubscriptExpr *subscript =
+            dyn_cast<ArraySubscriptExpr>(lhs)) {
+      return classifyPointee(subscript->getBase());
+    }
+    return Target{Target::Unknown, 0};
+  }
+
+  /// \brief Tell which object the pointer \c expr points to.
+  Target classifyPointee(const Expr *expr) const {
+    expr = expr->IgnoreParens();
+    if (isa<CXXThisExpr>(expr)) {
+      return Target{Target::Outside, 0};
+    }
+    if (const ImplicitCastExpr *cast = dyn_cast<ImplicitCastExpr>(expr)) {
+      if (cast->getCastKind() == CK_ArrayToPointerDecay) {
+        return classify(cast->getSubExpr());
+      }
+      const VarDecl *var = getVariable(cast->getSubExpr());
+      if (cast->getCastKind() == CK_LValueToRValue && var != nullptr &&
+          !var->getType()->isReferenceType()) {
+        // The object a local pointer points to may be a local one.
+        if (isa<ParmVarDecl>(var)) {
+          return Target{Target::Outside, 0};
+        }
+        return var->hasLocalStorage() ? Target{Target::Unknown, 0}
+                                      : Target{Target::Static, 0};
+      }
+    }
+    return Target{Target::Unknown, 0};
+  }
+
+  /// \brief Tell whether \c var is a variable or a parameter of the function
+  /// analyzed, rather than of an enclosing function of a lambda.
+  bool isOwn(const VarDecl *var) const {
+    return var->getParentFunctionOrMethod() == &definition;
+  }
+
+  /// \brief Collect the objects the glvalue \c expr may designate.
+  void collectReferent(const Expr *expr, Origins &origins) {
+    expr = expr->IgnoreParens();
+    if (const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(expr)) {
+      const VarDecl *var = dyn_cast<VarDecl>(ref->getDecl());
+      if (var == nullptr || !var->hasLocalStorage() || !isOwn(var)) {
+        return;
+      }
+      if (!var->getType()->isReferenceType()) {
+        origins.push_back(Origin{var, Origin::Automatic});
+      } else if (isa<ParmVarDecl>(var)) {
+        origins.push_back(Origin{var, Origin::Parameter});
+      } else if (var->getInit() != nullptr) {
+        collectReferent(var->getInit(), origins);
+      }
+      return;
+    }
+    if (const MemberExpr *member = dyn_cast<MemberExpr>(expr)) {
+      const FieldDecl *field = dyn_cast<FieldDecl>(member->getMemberDecl());
+      if (field == nullptr || field->getType()->isReferenceType()) {
+        return;
+      }
+      if (member->isArrow()) {
+        collectPointee(member->getBase(), origins);
+      } else {
+        collectReferent(member->getBase(), origins);
+      }
+      return;
+    }
+    if (const ArraySubscriptExpr *subscript =
+            dyn_cast<ArraySubscriptExpr>(expr)) {
+      collectPointee(subscript->getBase(), origins);
+      return;
+    }
+    if (const UnaryOperator *op = dyn_cast<UnaryOperator>(expr)) {
+      if (op->getOpcode() == UO_Deref) {
+        collectPointee(op->getSubExpr(), origins);
+      }
+      return;
+    }
+    if (const CastExpr *cast = dyn_cast<CastExpr>(expr)) {
+      if (isSameObjectCast(cast->getCastKind())) {
+        collectReferent(cast->getSubExpr(), origins);
+      }
+      return;
+    }
+    if (const BinaryOperator *op = dyn_cast<BinaryOperator>(expr)) {
+      if (op->isAssignmentOp()) {
+        collectReferent(op->getLHS(), origins);
+      } else if (op->getOpcode() == BO_Comma) {
+        collectReferent(op->getRHS(), origins);
+      }
+      return;
+    }
+    if (const ConditionalOperator *op = dyn_cast<ConditionalOperator>(expr)) {
+      collectReferent(op->getTrueExpr(), origins);
+      collectReferent(op->getFalseExpr(), origins);
+      return;
+    }
+    if (const CallExpr *call = dyn_cast<CallExpr>(expr)) {
+      collectReturned(call, origins);
+    }
+  }
+
+  /// \brief Collect the objects the pointer \c expr may point to.
+  void collectPointee(const Expr *expr, Origins &origins) {
+    expr = expr->IgnoreParens();
+    if (const CastExpr *cast = dyn_cast<CastExpr>(expr)) {
+      switch (cast->getCastKind()) {
+      case CK_ArrayToPointerDecay:
+        collectReferent(cast->getSubExpr(), origins);
+        return;
+      case CK_LValueToRValue: {
+        const VarDecl *var = getVariable(cast->getSubExpr());
+        if (var != nullptr && isOwn(var) && isLocalPointer(var)) {
+          collectVariable(var, origins);
+        }
+        return;
+      }
+      default:
+        if (isSameObjectCast(cast->getCastKind())) {
+          collectPointee(cast->getSubExpr(), origins);
+        }
+        return;
+      }
+    }
+    if (const UnaryOperator *op = dyn_cast<UnaryOperator>(expr)) {
+      if (op->getOpcode() == UO_AddrOf) {
+        collectReferent(op->getSubExpr(), origins);
+      }
+      return;
+    }
+    if (const BinaryOperator *op = dyn_cast<BinaryOperator>(expr)) {
+      switch (op->getOpcode()) {
+      case BO_Add:
+      case BO_Sub:
+        if (op->getLHS()->getType()->isPointerType()) {
+          collectPointee(op->getLHS(), origins);
+        } else if (op->getRHS()->getType()->isPointerType()) {
+          collectPointee(op->getRHS(), origins);
+        }
+        return;
+      case BO_Assign:
+      case BO_Comma:
+        collectPointee(op->getRHS(), origins);
+        return;
+      default:
+        return;
+      }
+    }
+    if (const ConditionalOperator *op = dyn_cast<ConditionalOperator>(expr)) {
+      collectPointee(op->getTrueExpr(), origins);
+      collectPointee(op->getFalseExpr(), origins);
+      return;
+    }
+    if (const CallExpr *call = dyn_cast<CallExpr>(expr)) {
+      collectReturned(call, origins);
+    }
+  }
+
+  /// \brief Collect the objects the local pointer variable or parameter
+  /// \c var may point to, from all the values assigned to it.
+  ///
+  /// The variables copied into each other in a cycle may point to the same
+  /// objects. Their origins are only complete once the first variable of the
+  /// cycle to be resolved is, so they are cached for all of them at that
+  /// point, as the strongly connected components of Tarjan's algorithm.
+  void collectVariable(const VarDecl *var, Origins &origins) {
+    auto it = resolved.find(var);
+    if (it != resolved.end()) {
+      origins.append(it->second.begin(), it->second.end());
+      return;
+    }
+    auto position = resolvingPositions.find(var);
+    if (position != resolvingPositions.end()) {
+      // Its values are collected by the variable still being resolved.
+      lowestDependency = std::min(lowestDependency, position->second);
+      return;
+    }
+
+    const unsigned ownPosition = static_cast<unsigned>(resolving.size());
+    resolving.push_back(var);
+    resolvingPositions[var] = ownPosition;
+    const unsigned outerDependency = lowestDependency;
+    lowestDependency = ownPosition;
+
+    Origins pointees;
+    if (isa<ParmVarDecl>(var)) {
+      pointees.push_back(Origin{var, Origin::Parameter});
+    }
+    for (const Expr *value : values.lookup(var)) {
+      collectPointee(value, pointees);
+    }
+    origins.append(pointees.begin(), pointees.end());
+
+    const unsigned dependency = lowestDependency;
+    lowestDependency = std::min(outerDependency, dependency);
+    if (dependency < ownPosition) {
+      // Part of a cycle whose first variable is not resolved yet.
+      return;
+    }
+    while (resolving.size() > ownPosition) {
+      resolvingPositions.erase(resolving.back());
+      resolved[resolving.back()] = pointees;
+      resolving.pop_back();
+    }
+  }
+
+  /// \brief Collect the objects the result of \c call may designate or point
+  /// to, from the summary of the callee.
+  void collectReturned(const CallExpr *call, Origins &origins) {
+    const FunctionDecl *callee = call->getDirectCallee();
+    if (callee == nullptr) {
+      return;
+    }
+    const llvm::ArrayRef<const Expr *> arguments = getArguments(call);
+    // The summary grows while it is iterated if the callee is the function
+    // being analyzed.
+    const EscapeSummary &calleeSummary = escapes.getSummary(callee);
+    for (size_t i = 0; i != calleeSummary.returnedParameters.size(); ++i) {
+      const unsigned index = calleeSummary.returnedParameters[i];
+      if (index >= arguments.size() || index >= callee->getNumParams()) {
+        continue;
+      }
+      if (callee->getParamDecl(index)->getType()->isReferenceType()) {
+        collectReferent(arguments[index], origins);
+      } else {
+        collectPointee(arguments[index], origins);
+      }
+    }
+  }
+
+  void report(StringRef rule, SourceLocation loc) {
+    if (violations != nullptr) {
+      violations->push_back(EscapeViolation{rule, loc});
+    }
+  }
+
+  void check() {
+    const bool returnsReference =
+        definition.getReturnType()->isReferenceType();
+    if (returnsReference || definition.getReturnType()->isPointerType()) {
+      for (const ReturnStmt *returnStmt : returns) {
+        checkReturn(returnStmt->getRetValue(), returnsReference);
+      }
+    }
+    for (const Store &store : stores) {
+      checkStore(store);
+    }
+  }
+
+  void checkReturn(const Expr *value, bool isReference) {
+    Origins origins;
+    if (isReference) {
+      collectReferent(value, origins);
+    } else {
+      collectPointee(value, origins);
+    }
+    bool isAutomatic = false;
+    bool isReferenceParameter = false;
+    for (const Origin &origin : origins) {
+      if (origin.kind == Origin::Automatic) {
+        isAutomatic = true;
+        continue;
+      }
+      const ParmVarDecl *param = cast<ParmVarDecl>(origin.var);
+      addIndex(summary.returnedParameters, param->getFunctionScopeIndex());
+      isReferenceParameter |= param->getType()->isReferenceType();
+    }
+    if (isAutomatic) {
+      report("7-5-1", value->getLocStart());
+    }
+    if (isReferenceParameter) {
+      report("7-5-3", value->getLocStart());
+    }
+  }
+
+  void checkStore(const Store &store) {
+    if (store.target.kind == Target::Unknown) {
+      return;
+    }
+    Origins origins;
+    if (store.isReference) {
+      collectReferent(store.value, origins);
+    } else {
+      collectPointee(store.value, origins);
+    }
+    bool outlives = false;
+    for (const Origin &origin : origins) {
+      if (origin.kind == Origin::Parameter) {
+        if (store.target.kind == Target::Static) {
+          addIndex(summary.storedParameters,
+                   cast<ParmVarDecl>(origin.var)->getFunctionScopeIndex());
+        }
+        continue;
+      }
+      // A local variable of an enclosing block, visible from both, lives
+      // longer than the variables of the inner blocks.
+      outlives |= store.target.kind != Target::Local ||
+                  store.target.depth < depths.lookup(origin.var);
+    }
+    if (outlives) {
+      report("7-5-2", store.loc);
+    }
+  }
+};
+
+class FunctionCollector : public RecursiveASTVisitor<FunctionCollector> {
+public:
+  explicit FunctionCollector(std::vector<const FunctionDecl *> &functions)
+      : functions(functions) {}
+
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (decl->doesThisDeclarationHaveABody()) {
+      functions.push_back(decl);
+    }
+    return true;
+  }
+
+  bool VisitLambdaExpr(LambdaExpr *expr) {
+    functions.push_back(expr->getCallOperator());
+    return true;
+  }
+
+private:
+  std::vector<const FunctionDecl *> &functions;
+};
+}
+
+AddressEscapes::AddressEscapes(CompilerInstance &CI) : CI(CI) {}
+
+const EscapeSummary &
+AddressEscapes::getSummary(const FunctionDecl *function) {
+  Entry &entry = entries[function->getCanonicalDecl()];
+  if (!entry.isStarted) {
+    summarizeCalleesFirst(function);
+  }
+  return entry.summary;
+}
+
+void AddressEscapes::summarizeCalleesFirst(const FunctionDecl *function) {
+  // Depth first over the call graph, with an explicit stack so that long
+  // call chains do not exhaust the native one. The functions on the stack
+  // when one of them is called again are part of a recursive cycle.
+  struct Frame {
+    const FunctionDecl *function;
+    std::vector<const FunctionDecl *> callees;
+    size_t nextCallee;
+  };
+  std::vector<Frame> stack;
+  auto push = [this, &stack](const FunctionDecl *function) {
+    entries[function->getCanonicalDecl()].isStarted = true;
+    stack.push_back(Frame{function, {}, 0});
+    const FunctionDecl *definition = nullptr;
+    if (function->hasBody(definition) && !definition->isDependentContext()) {
+      EscapeSummary scratch;
+      EscapeWalker(*this, *definition, scratch, nullptr,
+                   &stack.back().callees)
+          .build();
+    }
+  };
+
+  push(function);
+  while (!stack.empty()) {
+    Frame &frame = stack.back();
+    if (frame.nextCallee != frame.callees.size()) {
+      const FunctionDecl *callee = frame.callees[frame.nextCallee++];
+      if (!entries[callee->getCanonicalDecl()].isStarted) {
+        push(callee);
+      }
+      continue;
+    }
+    const FunctionDecl *summarized = frame.function;
+    stack.pop_back();
+    summarize(summarized, entries[summarized->getCanonicalDecl()].summary);
+  }
+}
+
+void AddressEscapes::summarize(const FunctionDecl *function,
+                               EscapeSummary &summary) {
+  const FunctionDecl *definition = nullptr;
+  if (function->hasBody(definition) && !definition->isDependentContext()) {
+    ++analyzedCount;
+    storeCount += EscapeWalker(*this, *definition, summary,
+                               definition->isTemplateInstantiation()
+                                   ? nullptr
+                                   : &violations)
+                      .build();
+  }
+}
+
+llvm::ArrayRef<EscapeViolation> AddressEscapes::getViolations() {
+  scan();
+  return violations;
+}
+
+void AddressEscapes::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Address escapes: " << entries.size() << " functions, "
+     << analyzedCount << " bodies analyzed, " << storeCount
+     << " stores of addresses, " << violations.size() << " violations\n";
+}
+
+void AddressEscapes::scan() {
+  if (isScanned) {
+    return;
+  }
+  isScanned = true;
+  std::vector<const FunctionDecl *> functions;
+  FunctionCollector(functions)
+      .TraverseDecl(CI.getASTContext().getTranslationUnitDecl());
+  for (const FunctionDecl *function : functions) {
+    getSummary(function);
+  }
+}
+}
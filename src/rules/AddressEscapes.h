@@ -0,0 +1,101 @@
+//===-  AddressEscapes.h - Addresses outliving their objects---------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ADDRESS_ESCAPES_H
+#define ADDRESS_ESCAPES_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include <map>
+#include <vector>
+
+namespace clang {
+class FunctionDecl;
+}
+
+namespace misracpp2008 {
+
+/// \brief Where the addresses given to a function may go, by index of the
+/// parameters. The address of a reference parameter is the one of the object
+/// bound to it, the address of a pointer parameter is its value.
+struct EscapeSummary {
+  /// Parameters whose address the result of the function may be, or refer
+  /// to.
+  std::vector<unsigned> returnedParameters;
+  /// Parameters whose address may be stored in an object with static
+  /// storage duration.
+  std::vector<unsigned> storedParameters;
+};
+
+/// \brief Violation of one of the rules 7-5-1 to 7-5-3.
+struct EscapeViolation {
+  llvm::StringRef rule;
+  clang::SourceLocation loc;
+};
+
+/// \brief Shared analysis following the addresses of the automatic objects
+/// and of the parameters to the places they may outlive them.
+///
+/// The body of each function is walked once, recording the values of its
+/// local pointer variables, its return statements and its stores of
+/// addresses: to objects with static storage, to the objects reached
+/// through the parameters or \c this, and to variables of enclosing blocks.
+/// The origins of the addresses are then resolved at the end of the
+/// function, through the local variables, the references and the results of
+/// the calls. A call is resolved with the summary of the callee, computed
+/// on demand once per function. The callees are summarized first, depth
+/// first with an explicit stack so that deep call chains do not exhaust the
+/// native one: the body of each function is walked once to find its callees
+/// and once to analyze it. Within a recursive cycle the summary of a
+/// function still on the stack is empty.
+///
+/// The analysis is flow-insensitive within a function, and addresses going
+/// through pointers to pointers, virtual calls or functions defined
+/// elsewhere are not followed. Template instantiations are summarized but
+/// not checked.
+class AddressEscapes : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit AddressEscapes(clang::CompilerInstance &CI);
+
+  /// \brief Get the summary of \c function, empty if it has no body.
+  const EscapeSummary &getSummary(const clang::FunctionDecl *function);
+
+  /// \brief The violations of the rules in the functions of the translation
+  /// unit.
+  llvm::ArrayRef<EscapeViolation> getViolations();
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  struct Entry {
+    EscapeSummary summary;
+    bool isStarted = false;
+  };
+
+  clang::CompilerInstance &CI;
+  bool isScanned = false;
+  /// Keyed by canonical declaration, a map keeps the summaries in place
+  /// while the ones of the callees get added.
+  std::map<const clang::FunctionDecl *, Entry> entries;
+  std::vector<EscapeViolation> violations;
+  unsigned analyzedCount = 0;
+  unsigned storeCount = 0;
+
+  void scan();
+  /// \brief Summarize \c function and the functions it calls which are not
+  /// summarized yet, callees first.
+  void summarizeCalleesFirst(const clang::FunctionDecl *function);
+  /// \brief Analyze \c function, the summaries of its callees being known
+  /// or part of a recursive cycle.
+  void summarize(const clang::FunctionDecl *function, EscapeSummary &summary);
+};
+}
+
+#endif
@@ -0,0 +1,36 @@
+//===-  AnalysisRuleChecker.h - Helper class ------------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef ANALYSIS_RULE_CHECKER_H
+#define ANALYSIS_RULE_CHECKER_H
+
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+/// \brief Auxiliary for the checkers of rules found by a shared analysis
+/// reporting the violations of several rules at once.
+///
+/// The violations are taken from \c Analysis::getViolations, which is given
+/// the shared analyses \c Dependencies it relies on, and the ones of the rule
+/// the checker is registered under are reported. A subclass just has to be
+/// registered under the name of its rule.
+template <typename Analysis, typename... Dependencies>
+class AnalysisRuleChecker : public RuleCheckerASTContext {
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    for (const auto &violation : getSharedAnalysis<Analysis>().getViolations(
+             getSharedAnalysis<Dependencies>()...)) {
+      if (name == violation.rule && !doIgnore(violation.loc)) {
+        reportError(violation.loc);
+      }
+    }
+  }
+};
+}
+
+#endif
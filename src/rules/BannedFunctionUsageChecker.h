@@ -7,13 +7,13 @@
 #ifndef ILLEGAL_FUNCTION_USAGE_CHECKER_H
 #define ILLEGAL_FUNCTION_USAGE_CHECKER_H
 
+#include "BannedSymbols.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/Basic/Diagnostic.h"
+#include "clang/Basic/IdentifierTable.h"
 #include "clang/Lex/Token.h"
 #include "misracpp2008.h"
-#include <string>
-#include <set>
 
 using namespace clang;
 
@@ -21,6 +21,11 @@ namespace misracpp2008 {
 
 /// \brief Auxiliary for easier implementation of a checker which simply checks
 /// for calls to illegal macros/functions.
+///
+/// The banned names of the rule are taken from the BannedSymbols analysis, so
+/// a subclass just has to be registered under the name of its rule. It is
+/// registered as AST checker to find references to banned functions and as
+/// preprocessor checker to find expansions of banned macros.
 class BannedFunctionUsageChecker
     : public RuleCheckerASTContext,
       public RuleCheckerPPCallback,
@@ -31,14 +36,16 @@ public:
   /// \param expr Expression to be analyzed.
   /// \return true
   bool VisitDeclRefExpr(DeclRefExpr *expr) {
-    if (doIgnore(expr->getLocation())) {
+    const NamedDecl *decl = expr->getDecl();
+    // Local variables and members may be named like a library function.
+    if (isBanned(decl->getIdentifier()) == false ||
+        decl->getDeclContext()->getRedeclContext()->isFileContext() == false) {
       return true;
     }
-
-    std::string funName = expr->getNameInfo().getAsString();
-    if (getIllegalFunctions().count(funName)) {
-      reportError(expr->getLocStart());
+    if (doIgnore(expr->getLocation())) {
+      return true;
     }
+    reportError(expr->getLocStart());
     return true;
   }
 
@@ -49,17 +56,13 @@ public:
   virtual void MacroExpands(const Token &MacroNameTok,
                             const MacroDefinition &MD, SourceRange Range,
                             const MacroArgs *) override {
-    if (doIgnore(MacroNameTok.getLocation())) {
+    if (isBanned(MacroNameTok.getIdentifierInfo()) == false) {
       return;
     }
-
-    const std::string &macroName = MacroNameTok.getIdentifierInfo()->getName();
-    if (getIllegalFunctions().count(macroName)) {
-      if (doIgnore(Range.getBegin())) {
-        return;
-      }
-      reportError(Range.getBegin());
+    if (doIgnore(MacroNameTok.getLocation()) || doIgnore(Range.getBegin())) {
+      return;
     }
+    reportError(Range.getBegin());
   }
 
 protected:
@@ -69,10 +72,16 @@ protected:
     this->TraverseDecl(context->getTranslationUnitDecl());
   }
 
-  /// \brief To be implemented by the subclass: Return a set of illegal
-  /// function/macro names.
-  /// \return A set of illegal function/macro names.
-  virtual const std::set<std::string> &getIllegalFunctions() const = 0;
+private:
+  const BannedSymbols::IdentifierSet *bannedIdentifiers = nullptr;
+
+  bool isBanned(const IdentifierInfo *identifier) {
+    if (bannedIdentifiers == nullptr) {
+      bannedIdentifiers =
+          &getSharedAnalysis<BannedSymbols>().getIdentifiers(name);
+    }
+    return identifier && bannedIdentifiers->count(identifier);
+  }
 };
 }
 
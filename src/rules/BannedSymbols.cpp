@@ -0,0 +1,123 @@
+//===-  BannedSymbols.cpp - Functions and macros banned by the rules-------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "BannedSymbols.h"
+#include "clang/Basic/IdentifierTable.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "clang/Lex/Preprocessor.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/LineIterator.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace clang;
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+char BannedSymbols::ID = 0;
+
+namespace {
+
+using NameLists = std::map<std::string, std::vector<std::string>>;
+
+/// \brief The functions and macros MISRA bans, keyed by rule.
+const NameLists &getMisraNames() {
+  static const NameLists names = {
+      {"17-0-5", {"longjmp", "setjmp"}},
+      {"18-0-2", {"atof", "atoi", "atol"}},
+      {"18-0-3", {"abort", "exit", "getenv", "system"}},
+      {"18-0-4",
+       {"asctime", "clock", "ctime", "difftime", "gmtime", "localtime",
+        "mktime", "strftime", "time"}},
+      {"18-0-5",
+       {"strcpy", "strcmp", "strcat", "strchr", "strspn", "strcspn", "strpbrk",
+        "strrchr", "strstr", "strtok", "strlen"}},
+      {"18-7-1", {"raise", "signal"}},
+      {"19-3-1", {"errno"}}};
+  return names;
+}
+
+/// \brief The names banned by the project's banned API list, keyed by rule.
+NameLists &getProjectNames() {
+  static NameLists names;
+  return names;
+}
+}
+
+BannedSymbols::BannedSymbols(CompilerInstance &CI) : CI(CI) {}
+
+const BannedSymbols::IdentifierSet &
+BannedSymbols::getIdentifiers(StringRef rule) {
+  auto it = identifiers.find(rule);
+  if (it != identifiers.end()) {
+    return it->second;
+  }
+
+  IdentifierSet &banned = identifiers[rule];
+  IdentifierTable &table = CI.getPreprocessor().getIdentifierTable();
+  const NameLists *lists[] = {&getMisraNames(), &getProjectNames()};
+  for (const NameLists *nameLists : lists) {
+    auto names = nameLists->find(rule);
+    if (names == nameLists->end()) {
+      continue;
+    }
+    for (const std::string &name : names->second) {
+      banned.insert(&table.get(name));
+    }
+  }
+  return banned;
+}
+
+bool BannedSymbols::loadProjectList(StringRef fileName, llvm::raw_ostream &OS) {
+  auto buffer = llvm::MemoryBuffer::getFile(fileName);
+  if (!buffer) {
+    OS << "Unable to read banned API list " << fileName << ": "
+       << buffer.getError().message() << "\n";
+    return false;
+  }
+
+  NameLists &projectNames = getProjectNames();
+  for (llvm::line_iterator line(**buffer, true, '#'); !line.is_at_end();
+       ++line) {
+    llvm::SmallVector<StringRef, 8> words;
+    llvm::SplitString(*line, words);
+    if (words.empty()) {
+      continue;
+    }
+    const std::string rule = words.front().str();
+    if (getMisraNames().count(rule) == 0) {
+      OS << fileName << ":" << line.line_number() << ": rule " << rule
+         << " does not ban functions or macros\n";
+      return false;
+    }
+    if (words.size() == 1) {
+      OS << fileName << ":" << line.line_number()
+         << ": no names given for rule " << rule << "\n";
+      return false;
+    }
+    std::vector<std::string> &names = projectNames[rule];
+    for (StringRef name : llvm::makeArrayRef(words).slice(1)) {
+      names.push_back(name.str());
+    }
+  }
+  return true;
+}
+
+void BannedSymbols::printStatistics(llvm::raw_ostream &OS) const {
+  unsigned identifierCount = 0;
+  for (const auto &rule : identifiers) {
+    identifierCount += rule.getValue().size();
+  }
+  OS << "Banned symbols: " << identifiers.size() << " rules, "
+     << identifierCount << " identifiers\n";
+}
+}
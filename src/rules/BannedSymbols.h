@@ -0,0 +1,58 @@
+//===-  BannedSymbols.h - Functions and macros banned by the rules---------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef BANNED_SYMBOLS_H
+#define BANNED_SYMBOLS_H
+
+#include "misracpp2008.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/StringRef.h"
+
+namespace clang {
+class IdentifierInfo;
+}
+
+namespace misracpp2008 {
+
+/// \brief Shared analysis resolving the names banned by the rules to the
+/// identifiers of the translation unit.
+///
+/// The names of a rule are resolved once, on the first request for the rule,
+/// so references to declarations and macro expansions are matched by pointer
+/// comparison. Besides the names given by MISRA, a project can ban its own
+/// names by passing a banned API list, see loadProjectList().
+class BannedSymbols : public SharedAnalysis {
+public:
+  using IdentifierSet = llvm::SmallPtrSet<const clang::IdentifierInfo *, 16>;
+
+  static char ID;
+
+  explicit BannedSymbols(clang::CompilerInstance &CI);
+
+  /// \brief Get the identifiers of the functions and macros banned by \c rule.
+  const IdentifierSet &getIdentifiers(llvm::StringRef rule);
+
+  /// \brief Read the names a project bans in addition to the ones given by
+  /// MISRA.
+  ///
+  /// Each line of the file lists a rule followed by the names to be reported
+  /// as violations of it, e.g. "18-0-3 fork popen". Empty lines and lines
+  /// starting with '#' are skipped.
+  /// \param fileName Path of the banned API list.
+  /// \param OS Stream the errors get reported to.
+  /// \return false if the file could not be read or is malformed.
+  static bool loadProjectList(llvm::StringRef fileName, llvm::raw_ostream &OS);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  llvm::StringMap<IdentifierSet> identifiers;
+};
+}
+
+#endif
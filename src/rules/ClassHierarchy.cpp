@@ -0,0 +1,367 @@
+//===-  ClassHierarchy.cpp - Index of the class hierarchies----------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ClassHierarchy.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char ClassHierarchy::ID = 0;
+
+namespace {
+
+const CXXRecordDecl *getDefinition(const CXXBaseSpecifier &base) {
+  const CXXRecordDecl *decl = base.getType()->getAsCXXRecordDecl();
+  return decl == nullptr ? nullptr : decl->getDefinition();
+}
+
+/// \brief Tell whether \c virtualBase is a virtual base of \c decl.
+bool hasVirtualBase(const CXXRecordDecl *decl,
+                    const CXXRecordDecl *virtualBase) {
+  for (const CXXBaseSpecifier &base : decl->vbases()) {
+    if (getDefinition(base) == virtualBase) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/// \brief Tell whether \c type is a template parameter, or a reference to
+/// one.
+bool isGenericParameter(QualType type) {
+  return type.getNonReferenceType()->getAs<TemplateTypeParmType>() != nullptr;
+}
+
+class ClassCollector : public RecursiveASTVisitor<ClassCollector> {
+public:
+  explicit ClassCollector(std::vector<const CXXRecordDecl *> &classes)
+      : classes(classes) {}
+
+  bool VisitCXXRecordDecl(CXXRecordDecl *decl) {
+    if (decl->isThisDeclarationADefinition() && !decl->isLambda()) {
+      classes.push_back(decl);
+    }
+    return true;
+  }
+
+private:
+  std::vector<const CXXRecordDecl *> &classes;
+};
+}
+
+ClassHierarchy::ClassHierarchy(CompilerInstance &CI) : CI(CI) {}
+
+llvm::ArrayRef<const CXXRecordDecl *> ClassHierarchy::getClasses() {
+  scan();
+  return classes;
+}
+
+llvm::ArrayRef<const CXXRecordDecl *>
+ClassHierarchy::getBases(const CXXRecordDecl *decl) {
+  auto it = bases.find(decl);
+  if (it != bases.end()) {
+    return it->second;
+  }
+
+  std::vector<const CXXRecordDecl *> closure;
+  llvm::SmallPtrSet<const CXXRecordDecl *, 16> seen;
+  for (const CXXBaseSpecifier &base : decl->bases()) {
+    const CXXRecordDecl *baseDecl = getDefinition(base);
+    if (baseDecl == nullptr) {
+      continue;
+    }
+    if (seen.insert(baseDecl).second) {
+      closure.push_back(baseDecl);
+    }
+    for (const CXXRecordDecl *indirect : getBases(baseDecl)) {
+      if (seen.insert(indirect).second) {
+        closure.push_back(indirect);
+      }
+    }
+  }
+  return bases[decl] = std::move(closure);
+}
+
+llvm::ArrayRef<const NamedDecl *>
+ClassHierarchy::getMemberNames(const CXXRecordDecl *decl) {
+  auto it = memberNames.find(decl);
+  if (it != memberNames.end()) {
+    return it->second;
+  }
+
+  std::vector<const NamedDecl *> names;
+  llvm::StringMap<bool> seen;
+  for (const Decl *member : decl->decls()) {
+    const NamedDecl *named = dyn_cast<NamedDecl>(member);
+    // Constructors, destructors and operators have no identifier.
+    if (named == nullptr || named->isImplicit() ||
+        named->getIdentifier() == nullptr ||
+        named->getAccess() == AS_private || isa<UsingDecl>(named) ||
+        isa<UsingShadowDecl>(named)) {
+      continue;
+    }
+    // Overloads share their name.
+    if (seen.insert(std::make_pair(named->getName(), true)).second) {
+      names.push_back(named);
+    }
+  }
+  return memberNames[decl] = std::move(names);
+}
+
+bool ClassHierarchy::isDefinedAbove(const CXXMethodDecl *method) {
+  auto it = definedAbove.find(method);
+  if (it != definedAbove.end()) {
+    return it->second;
+  }
+
+  bool result = false;
+  for (auto i = method->begin_overridden_methods(),
+            e = method->end_overridden_methods();
+       i != e && !result; ++i) {
+    result = !(*i)->isPure() || isDefinedAbove(*i);
+  }
+  definedAbove[method] = result;
+  return result;
+}
+
+llvm::ArrayRef<HierarchyViolation> ClassHierarchy::getViolations() {
+  scan();
+  return violations;
+}
+
+void ClassHierarchy::printStatistics(llvm::raw_ostream &OS) const {
+  size_t baseCount = 0;
+  for (const auto &entry : bases) {
+    baseCount += entry.second.size();
+  }
+  OS << "Class hierarchy: " << classes.size() << " classes, " << baseCount
+     << " bases in closures, " << violations.size() << " violations\n";
+}
+
+void ClassHierarchy::scan() {
+  if (isScanned) {
+    return;
+  }
+  isScanned = true;
+  ClassCollector collector(classes);
+  collector.TraverseDecl(CI.getASTContext().getTranslationUnitDecl());
+  collectDiamonds();
+  for (const CXXRecordDecl *decl : classes) {
+    checkClass(decl);
+  }
+}
+
+bool ClassHierarchy::hasMixedBases(const CXXRecordDecl *decl) {
+  auto it = mixedBases.find(decl);
+  if (it != mixedBases.end()) {
+    return it->second;
+  }
+
+  bool result = false;
+  if (decl->getNumVBases() != 0) {
+    llvm::SmallPtrSet<const CXXRecordDecl *, 16> nonVirtualBases;
+    auto addNonVirtualBases = [&nonVirtualBases](const CXXRecordDecl *cls) {
+      for (const CXXBaseSpecifier &base : cls->bases()) {
+        const CXXRecordDecl *baseDecl = getDefinition(base);
+        if (!base.isVirtual() && baseDecl != nullptr) {
+          nonVirtualBases.insert(baseDecl);
+        }
+      }
+    };
+    addNonVirtualBases(decl);
+    for (const CXXRecordDecl *base : getBases(decl)) {
+      addNonVirtualBases(base);
+    }
+    for (const CXXBaseSpecifier &base : decl->vbases()) {
+      if (nonVirtualBases.count(getDefinition(base)) != 0) {
+        result = true;
+        break;
+      }
+    }
+  }
+  mixedBases[decl] = result;
+  return result;
+}
+
+/// A virtual base is shared in a diamond when a class reaches it through
+/// two of its direct bases. The virtual base specifiers on these paths are
+/// the ones rule 10-1-2 allows.
+void ClassHierarchy::collectDiamonds() {
+  for (const CXXRecordDecl *decl : classes) {
+    if (decl->getNumBases() < 2) {
+      continue;
+    }
+    for (const CXXBaseSpecifier &virtualBase : decl->vbases()) {
+      const CXXRecordDecl *shared = getDefinition(virtualBase);
+      if (shared == nullptr) {
+        continue;
+      }
+      llvm::SmallVector<const CXXBaseSpecifier *, 4> paths;
+      for (const CXXBaseSpecifier &base : decl->bases()) {
+        const CXXRecordDecl *baseDecl = getDefinition(base);
+        if (baseDecl != nullptr &&
+            ((base.isVirtual() && baseDecl == shared) ||
+             hasVirtualBase(baseDecl, shared))) {
+          paths.push_back(&base);
+        }
+      }
+      if (paths.size() < 2) {
+        continue;
+      }
+      for (const CXXBaseSpecifier *path : paths) {
+        const CXXRecordDecl *baseDecl = getDefinition(*path);
+        if (baseDecl == shared) {
+          diamondBases.insert(std::make_pair(decl, shared));
+          continue;
+        }
+        auto addSpecifiers = [this, shared](const CXXRecordDecl *cls) {
+          for (const CXXBaseSpecifier &base : cls->bases()) {
+            if (base.isVirtual() && getDefinition(base) == shared) {
+              diamondBases.insert(std::make_pair(cls, shared));
+            }
+          }
+        };
+        addSpecifiers(baseDecl);
+        for (const CXXRecordDecl *indirect : getBases(baseDecl)) {
+          addSpecifiers(indirect);
+        }
+      }
+    }
+  }
+}
+
+void ClassHierarchy::checkClass(const CXXRecordDecl *decl) {
+  for (const CXXBaseSpecifier &base : decl->bases()) {
+    if (!base.isVirtual()) {
+      continue;
+    }
+    violations.push_back(HierarchyViolation{"10-1-1", base.getLocStart()});
+    const CXXRecordDecl *baseDecl = getDefinition(base);
+    if (baseDecl != nullptr &&
+        diamondBases.count(std::make_pair(decl, baseDecl)) == 0) {
+      violations.push_back(HierarchyViolation{"10-1-2", base.getLocStart()});
+    }
+  }
+
+  // Only the class where the bases get mixed is reported, not every class
+  // deriving from it.
+  if (hasMixedBases(decl)) {
+    bool isInherited = false;
+    for (const CXXBaseSpecifier &base : decl->bases()) {
+      const CXXRecordDecl *baseDecl = getDefinition(base);
+      if (baseDecl != nullptr && hasMixedBases(baseDecl)) {
+        isInherited = true;
+        break;
+      }
+    }
+    if (!isInherited) {
+      violations.push_back(HierarchyViolation{"10-1-3", decl->getLocation()});
+    }
+  }
+
+  // A name is ambiguous when it is declared in different classes reached
+  // through different direct bases.
+  if (decl->getNumBases() >= 2) {
+    llvm::StringMap<std::pair<const CXXRecordDecl *, unsigned>> declaringClass;
+    bool isAmbiguous = false;
+    unsigned index = 0;
+    for (const CXXBaseSpecifier &base : decl->bases()) {
+      const CXXRecordDecl *baseDecl = getDefinition(base);
+      ++index;
+      if (baseDecl == nullptr) {
+        continue;
+      }
+      auto addNames = [&](const CXXRecordDecl *cls) {
+        for (const NamedDecl *named : getMemberNames(cls)) {
+          auto inserted = declaringClass.insert(
+              std::make_pair(named->getName(), std::make_pair(cls, index)));
+          const auto &previous = inserted.first->second;
+          if (!inserted.second && previous.second != index &&
+              previous.first != cls) {
+            isAmbiguous = true;
+          }
+        }
+      };
+      addNames(baseDecl);
+      for (const CXXRecordDecl *indirect : getBases(baseDecl)) {
+        addNames(indirect);
+      }
+    }
+    if (isAmbiguous) {
+      violations.push_back(HierarchyViolation{"10-2-1", decl->getLocation()});
+    }
+  }
+
+  for (const CXXMethodDecl *method : decl->methods()) {
+    if (method->isImplicit()) {
+      continue;
+    }
+    if (method->isVirtual() && !method->isVirtualAsWritten()) {
+      violations.push_back(
+          HierarchyViolation{"10-3-2", method->getLocation()});
+    }
+    if (method->isPure()) {
+      for (auto i = method->begin_overridden_methods(),
+                e = method->end_overridden_methods();
+           i != e; ++i) {
+        if (!(*i)->isPure()) {
+          violations.push_back(
+              HierarchyViolation{"10-3-3", method->getLocation()});
+          break;
+        }
+      }
+    } else if (method->isVirtual() && !isa<CXXDestructorDecl>(method) &&
+               isDefinedAbove(method)) {
+      violations.push_back(
+          HierarchyViolation{"10-3-1", method->getLocation()});
+    }
+  }
+
+  if (decl->isAbstract() && decl->hasUserDeclaredCopyAssignment()) {
+    for (const CXXMethodDecl *method : decl->methods()) {
+      if (method->isCopyAssignmentOperator() &&
+          method->getAccess() == AS_public) {
+        violations.push_back(
+            HierarchyViolation{"12-8-2", method->getLocStart()});
+      }
+    }
+  }
+
+  for (const Decl *member : decl->decls()) {
+    const FunctionTemplateDecl *functionTemplate =
+        dyn_cast<FunctionTemplateDecl>(member);
+    if (functionTemplate == nullptr) {
+      continue;
+    }
+    const FunctionDecl *function = functionTemplate->getTemplatedDecl();
+    if (function->getNumParams() != 1 ||
+        !isGenericParameter(function->getParamDecl(0)->getType())) {
+      continue;
+    }
+    if (isa<CXXConstructorDecl>(function)) {
+      if (!decl->hasUserDeclaredCopyConstructor()) {
+        violations.push_back(
+            HierarchyViolation{"14-5-2", function->getLocation()});
+      }
+    } else if (function->getOverloadedOperator() == OO_Equal &&
+               !decl->hasUserDeclaredCopyAssignment()) {
+      violations.push_back(
+          HierarchyViolation{"14-5-3", function->getLocation()});
+    }
+  }
+}
+}
@@ -0,0 +1,100 @@
+//===-  ClassHierarchy.h - Index of the class hierarchies------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef CLASS_HIERARCHY_H
+#define CLASS_HIERARCHY_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/DenseSet.h"
+#include "llvm/ADT/StringRef.h"
+#include <utility>
+#include <vector>
+
+namespace clang {
+class CXXMethodDecl;
+class CXXRecordDecl;
+class NamedDecl;
+}
+
+namespace misracpp2008 {
+
+/// \brief Violation of one of the rules on class hierarchies and special
+/// members: 10-1-1 to 10-1-3, 10-2-1, 10-3-1 to 10-3-3, 12-8-2, 14-5-2 and
+/// 14-5-3.
+struct HierarchyViolation {
+  llvm::StringRef rule;
+  clang::SourceLocation loc;
+};
+
+/// \brief Shared analysis indexing the class hierarchies of the translation
+/// unit.
+///
+/// The index holds, for each class definition, the closure of its bases and
+/// its accessible member names. Closures are computed once per class and
+/// reused by all the classes deriving from it, and the virtual bases come
+/// from the closure Clang keeps itself. Overridden methods are recorded by
+/// the AST already, the index memoizes whether a virtual function has a
+/// definition above it. All the rules are then checked as queries on these
+/// tables, without walking the bases again.
+class ClassHierarchy : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit ClassHierarchy(clang::CompilerInstance &CI);
+
+  /// \brief The class definitions of the translation unit, in the order of
+  /// the source.
+  llvm::ArrayRef<const clang::CXXRecordDecl *> getClasses();
+
+  /// \brief The direct and indirect bases of the class definition \c decl,
+  /// each once, as definitions.
+  llvm::ArrayRef<const clang::CXXRecordDecl *>
+  getBases(const clang::CXXRecordDecl *decl);
+
+  /// \brief The members of \c decl with a name which are accessible from
+  /// derived classes.
+  llvm::ArrayRef<const clang::NamedDecl *>
+  getMemberNames(const clang::CXXRecordDecl *decl);
+
+  /// \brief Tell whether \c method overrides a virtual function which is
+  /// not pure, directly or indirectly.
+  bool isDefinedAbove(const clang::CXXMethodDecl *method);
+
+  /// \brief The violations of the rules, in the order of the classes.
+  llvm::ArrayRef<HierarchyViolation> getViolations();
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  bool isScanned = false;
+  std::vector<const clang::CXXRecordDecl *> classes;
+  llvm::DenseMap<const clang::CXXRecordDecl *,
+                 std::vector<const clang::CXXRecordDecl *>>
+      bases;
+  llvm::DenseMap<const clang::CXXRecordDecl *,
+                 std::vector<const clang::NamedDecl *>>
+      memberNames;
+  llvm::DenseMap<const clang::CXXMethodDecl *, bool> definedAbove;
+  llvm::DenseMap<const clang::CXXRecordDecl *, bool> mixedBases;
+  /// Pairs of a class and one of its direct virtual bases which is shared
+  /// in a diamond below the class.
+  llvm::DenseSet<
+      std::pair<const clang::CXXRecordDecl *, const clang::CXXRecordDecl *>>
+      diamondBases;
+  std::vector<HierarchyViolation> violations;
+
+  void scan();
+  bool hasMixedBases(const clang::CXXRecordDecl *decl);
+  void collectDiamonds();
+  void checkClass(const clang::CXXRecordDecl *decl);
+};
+}
+
+#endif
@@ -0,0 +1,56 @@
+//===-  CommentChecker.h - Helper class------------------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef COMMENT_CHECKER_H
+#define COMMENT_CHECKER_H
+
+#include "CommentIndex.h"
+#include "clang/Basic/SourceManager.h"
+#include "clang/Lex/PPCallbacks.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+/// \brief Auxiliary for easier implementation of a checker which checks the
+/// comments of the translation unit. The comments are recorded by the
+/// CommentIndex, subclasses check the records of the files not ignored.
+class CommentChecker : public RuleCheckerPPCallback {
+public:
+  virtual void FileChanged(SourceLocation Loc, FileChangeReason Reason,
+                           SrcMgr::CharacteristicKind FileType,
+                           FileID PrevFID) override final {
+    // Entering the main file is the first event, the index has to be in
+    // place before the preprocessor lexes the first comment.
+    getSharedAnalysis<CommentIndex>();
+  }
+
+  virtual void EndOfMainFile() override final {
+    CommentIndex &index = getSharedAnalysis<CommentIndex>();
+    const SourceManager &SM = CI->getSourceManager();
+    for (FileID FID : index.getFiles()) {
+      const SourceLocation fileStart = SM.getLocForStartOfFile(FID);
+      if (doIgnore(fileStart)) {
+        continue;
+      }
+      for (const CommentRecord &comment : index.getClassifiedComments(FID)) {
+        checkComment(comment, fileStart.getLocWithOffset(comment.offset));
+      }
+    }
+  }
+
+protected:
+  /// \brief To be implemented by the subclass: Check a comment of a file
+  /// which is not to be ignored.
+  /// \param comment Record of the comment.
+  /// \param loc Location of the start of the comment.
+  virtual void checkComment(const CommentRecord &comment,
+                            SourceLocation loc) {}
+};
+}
+
+#endif
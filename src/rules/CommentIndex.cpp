@@ -0,0 +1,284 @@
+//===-  CommentIndex.cpp - Comments of a translation unit------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "CommentIndex.h"
+#include "clang/Basic/SourceManager.h"
+#include "clang/Basic/TokenKinds.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "clang/Lex/Lexer.h"
+#include "clang/Lex/Preprocessor.h"
+#include "clang/Lex/Token.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+char CommentIndex::ID = 0;
+
+namespace {
+
+enum ByteClass : uint8_t {
+  Other,
+  Word,
+  Semicolon,
+  Brace,
+  Equals,
+  Parenthesis,
+  Slash
+};
+
+/// \brief Lookup table classifying the bytes of a comment for scoring.
+class ByteClasses {
+public:
+  ByteClasses() {
+    for (unsigned byte = 0; byte < 256; ++byte) {
+      table[byte] = Other;
+    }
+    for (unsigned byte = 'a'; byte <= 'z'; ++byte) {
+      table[byte] = Word;
+      table[byte - 'a' + 'A'] = Word;
+    }
+    for (unsigned byte = '0'; byte <= '9'; ++byte) {
+      table[byte] = Word;
+    }
+    table[static_cast<unsigned char>('_')] = Word;
+    table[static_cast<unsigned char>(';')] = Semicolon;
+    table[static_cast<unsigned char>('{')] = Brace;
+    table[static_cast<unsigned char>('}')] = Brace;
+    table[static_cast<unsigned char>('=')] = Equals;
+    table[static_cast<unsigned char>('(')] = Parenthesis;
+    table[static_cast<unsigned char>(')')] = Parenthesis;
+    table[static_cast<unsigned char>('/')] = Slash;
+  }
+
+  ByteClass operator[](char byte) const {
+    return static_cast<ByteClass>(table[static_cast<unsigned char>(byte)]);
+  }
+
+private:
+  uint8_t table[256];
+};
+
+/// Comments scoring below the threshold are taken to be prose without
+/// lexing them.
+const unsigned codeScoreThreshold = 2;
+
+/// \brief Tell whether \c word is a keyword typically found in code which has
+/// been commented out.
+bool isCodeKeyword(StringRef word) {
+  return llvm::StringSwitch<bool>(word)
+      .Cases("if", "else", "for", "while", "do", true)
+      .Cases("switch", "case", "return", "break", "continue", true)
+      .Cases("int", "char", "bool", "void", "unsigned", true)
+      .Cases("const", "static", "struct", "class", "namespace", true)
+      .Cases("template", "typename", "new", "delete", "auto", true)
+      .Cases("double", "float", "long", "include", "define", true)
+      .Default(false);
+}
+}
+
+CommentIndex::CommentIndex(CompilerInstance &CI) : CI(CI) {
+  CI.getPreprocessor().addCommentHandler(this);
+}
+
+CommentIndex::~CommentIndex() {
+  CI.getPreprocessor().removeCommentHandler(this);
+}
+
+llvm::ArrayRef<CommentRecord> CommentIndex::getComments(FileID FID) const {
+  auto it = files.find(getRecordedFileID(FID));
+  if (it == files.end()) {
+    return llvm::ArrayRef<CommentRecord>();
+  }
+  return it->second.comments;
+}
+
+llvm::ArrayRef<CommentRecord>
+CommentIndex::getClassifiedComments(FileID FID) {
+  FID = getRecordedFileID(FID);
+  auto it = files.find(FID);
+  if (it == files.end()) {
+    return llvm::ArrayRef<CommentRecord>();
+  }
+  FileComments &file = it->second;
+  if (file.isClassified == false) {
+    bool invalid = false;
+    const StringRef text = CI.getSourceManager().getBufferData(FID, &invalid);
+    if (!invalid) {
+      for (CommentRecord &comment : file.comments) {
+        classify(comment, text.substr(comment.offset, comment.length));
+      }
+    }
+    file.isClassified = true;
+  }
+  return file.comments;
+}
+
+void CommentIndex::printStatistics(llvm::raw_ostream &OS) const {
+  unsigned classifiedCount = 0;
+  for (const auto &file : files) {
+    if (file.second.isClassified) {
+      ++classifiedCount;
+    }
+  }
+  OS << "Comment index: " << commentCount << " comments in " << files.size()
+     << " files, " << classifiedCount << " files classified, "
+     << candidateCount << " comments lexed as code candidates\n";
+}
+
+FileID CommentIndex::getRecordedFileID(FileID FID) const {
+  if (const FileEntry *entry = CI.getSourceManager().getFileEntryForID(FID)) {
+    auto it = firstFileIDs.find(entry);
+    if (it != firstFileIDs.end()) {
+      return it->second;
+    }
+  }
+  return FID;
+}
+
+bool CommentIndex::HandleComment(Preprocessor &PP, SourceRange comment) {
+  const SourceManager &SM = PP.getSourceManager();
+  std::pair<FileID, unsigned> begin = SM.getDecomposedLoc(comment.getBegin());
+  if (lastFile == nullptr || begin.first != lastFID) {
+    lastFID = begin.first;
+    if (const FileEntry *entry = SM.getFileEntryForID(begin.first)) {
+      begin.first = firstFileIDs.insert(std::make_pair(entry, begin.first))
+                        .first->second;
+    }
+    auto inserted = files.insert(std::make_pair(begin.first, FileComments()));
+    if (inserted.second) {
+      fileOrder.push_back(begin.first);
+    }
+    lastFile = &inserted.first->second;
+  }
+
+  // Comments come in the order of their offsets, so one which is not behind
+  // the last comment of its file stems from another inclusion of the file.
+  std::vector<CommentRecord> &comments = lastFile->comments;
+  if (!comments.empty() && begin.second <= comments.back().offset) {
+    return false;
+  }
+  CommentRecord record{begin.second,
+                       SM.getFileOffset(comment.getEnd()) - begin.second, 0,
+                       0};
+  if (SM.getCharacterData(comment.getBegin())[1] == '*') {
+    record.flags |= CommentRecord::IsCStyle;
+  }
+  comments.push_back(record);
+  ++commentCount;
+  return false;
+}
+
+void CommentIndex::classify(CommentRecord &comment, StringRef text) {
+  static const ByteClasses byteClasses;
+
+  StringRef body = text.substr(2);
+  if (comment.is(CommentRecord::IsCStyle) && body.endswith("*/")) {
+    body = body.drop_back(2);
+  }
+
+  // Score the comment by its punctuation and keywords in a single pass over
+  // its bytes. Only comments scoring high enough get lexed.
+  unsigned score = body.ltrim().startswith("#") ? codeScoreThreshold : 0;
+  unsigned keywordCount = 0;
+  bool hasOperator = false;
+  size_t wordStart = StringRef::npos;
+  for (size_t i = 0, e = body.size(); i != e; ++i) {
+    const ByteClass byteClass = byteClasses[body[i]];
+    if (byteClass == Word) {
+      if (wordStart == StringRef::npos) {
+        wordStart = i;
+      }
+      continue;
+    }
+    if (wordStart != StringRef::npos) {
+      keywordCount += isCodeKeyword(body.slice(wordStart, i)) ? 1 : 0;
+      wordStart = StringRef::npos;
+    }
+    switch (byteClass) {
+    case Semicolon:
+      ++score;
+      break;
+    case Brace:
+    case Equals:
+      ++score;
+      hasOperator = true;
+      break;
+    case Parenthesis:
+      hasOperator = true;
+      break;
+    case Slash:
+      if (comment.is(CommentRecord::IsCStyle) && i + 1 != e &&
+          body[i + 1] == '*' && !comment.is(CommentRecord::HasNestedOpening)) {
+        comment.flags |= CommentRecord::HasNestedOpening;
+        comment.nestedOpeningOffset = static_cast<unsigned>(i) + 2;
+      }
+      break;
+    default:
+      break;
+    }
+  }
+  if (wordStart != StringRef::npos) {
+    keywordCount += isCodeKeyword(body.substr(wordStart)) ? 1 : 0;
+  }
+
+  score += keywordCount;
+  if (score < codeScoreThreshold || (!hasOperator && keywordCount == 0)) {
+    return;
+  }
+  ++candidateCount;
+  if (lexesLikeCode(body)) {
+    comment.flags |= CommentRecord::LooksLikeCode;
+  }
+}
+
+bool CommentIndex::lexesLikeCode(StringRef body) const {
+  // The lexer needs a null terminated buffer.
+  llvm::SmallString<256> buffer(body);
+  const char *begin = buffer.c_str();
+  Lexer lexer(SourceLocation(), CI.getLangOpts(), begin, begin,
+              begin + buffer.size());
+  Preprocessor &PP = CI.getPreprocessor();
+  Token token;
+  unsigned tokenCount = 0;
+  unsigned identifierRun = 0;
+  bool startsWithHash = false;
+  tok::TokenKind lastKind = tok::unknown;
+  while (true) {
+    lexer.LexFromRawLexer(token);
+    if (token.is(tok::eof)) {
+      break;
+    }
+    // Prose gives itself away by apostrophes and stray characters, and by
+    // words following each other which are not keywords.
+    if (token.is(tok::unknown)) {
+      return false;
+    }
+    if (token.is(tok::raw_identifier)) {
+      PP.LookUpIdentifierInfo(token);
+    }
+    identifierRun = token.is(tok::identifier) ? identifierRun + 1 : 0;
+    if (identifierRun == 3) {
+      return false;
+    }
+    if (tokenCount == 0) {
+      startsWithHash = token.is(tok::hash);
+    }
+    lastKind = token.getKind();
+    ++tokenCount;
+  }
+  if (tokenCount < 2) {
+    return false;
+  }
+  return startsWithHash || lastKind == tok::semi || lastKind == tok::l_brace ||
+         lastKind == tok::r_brace;
+}
+}
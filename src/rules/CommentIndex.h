@@ -0,0 +1,101 @@
+//===-  CommentIndex.h - Comments of a translation unit--------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef COMMENT_INDEX_H
+#define COMMENT_INDEX_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "clang/Lex/Preprocessor.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringRef.h"
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace clang {
+class FileEntry;
+}
+
+namespace misracpp2008 {
+
+/// \brief What the comment related rules need to know about a comment.
+struct CommentRecord {
+  enum Flag : uint8_t {
+    IsCStyle = 1 << 0,
+    /// A C-style comment containing the character sequence /*.
+    HasNestedOpening = 1 << 1,
+    /// The text of the comment looks like source code.
+    LooksLikeCode = 1 << 2
+  };
+
+  unsigned offset; ///< Offset of the comment within its file.
+  unsigned length; ///< Including the delimiters.
+  /// Offset of the first nested /* relative to the comment, if any.
+  unsigned nestedOpeningOffset;
+  uint8_t flags;
+
+  bool is(Flag flag) const { return (flags & flag) != 0; }
+};
+
+/// \brief Shared analysis recording the position of every comment seen by
+/// the preprocessor, per file.
+///
+/// The index registers itself as a comment handler on creation, so it has to
+/// be created before the preprocessor enters the main file. Classifying the
+/// comments is done per file on the first request, so files ignored by all
+/// checkers do not pay for it.
+class CommentIndex : public SharedAnalysis, private clang::CommentHandler {
+public:
+  static char ID;
+
+  explicit CommentIndex(clang::CompilerInstance &CI);
+  virtual ~CommentIndex();
+
+  /// \brief The files containing comments, in the order they were entered.
+  llvm::ArrayRef<clang::FileID> getFiles() const { return fileOrder; }
+
+  /// \brief Get the comments of \c FID in the order of their offsets. Only the
+  /// positions of the comments are valid, see getClassifiedComments().
+  ///
+  /// Any FileID of a file can be passed, the comments of a header included
+  /// more than once are the ones of its first inclusion.
+  llvm::ArrayRef<CommentRecord> getComments(clang::FileID FID) const;
+
+  /// \brief Get the comments of \c FID in the order of their offsets, with
+  /// their flags set.
+  llvm::ArrayRef<CommentRecord> getClassifiedComments(clang::FileID FID);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  struct FileComments {
+    std::vector<CommentRecord> comments;
+    bool isClassified = false;
+  };
+
+  clang::CompilerInstance &CI;
+  std::map<clang::FileID, FileComments> files;
+  std::vector<clang::FileID> fileOrder;
+  /// The comments of a header included more than once are recorded under the
+  /// FileID of its first inclusion.
+  llvm::DenseMap<const clang::FileEntry *, clang::FileID> firstFileIDs;
+  /// Cache of the file the last comment was in, comments come in runs.
+  clang::FileID lastFID;
+  FileComments *lastFile = nullptr;
+  unsigned commentCount = 0;
+  unsigned candidateCount = 0;
+
+  clang::FileID getRecordedFileID(clang::FileID FID) const;
+  virtual bool HandleComment(clang::Preprocessor &PP,
+                             clang::SourceRange comment) override;
+  void classify(CommentRecord &comment, llvm::StringRef text);
+  bool lexesLikeCode(llvm::StringRef body) const;
+};
+}
+
+#endif
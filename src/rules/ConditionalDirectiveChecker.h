@@ -0,0 +1,67 @@
+//===-  ConditionalDirectiveChecker.h - Helper class-----------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef CONDITIONAL_DIRECTIVE_CHECKER_H
+#define CONDITIONAL_DIRECTIVE_CHECKER_H
+
+#include "ConditionalDirectiveTracker.h"
+#include "clang/Lex/PPCallbacks.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+/// \brief Auxiliary for easier implementation of a checker which checks the
+/// \#if, \#elif, \#else and \#endif directives. The directives are recorded by
+/// the ConditionalDirectiveTracker, subclasses check the records.
+class ConditionalDirectiveChecker : public RuleCheckerPPCallback {
+public:
+  virtual void Defined(const Token &MacroNameTok, const MacroDefinition &MD,
+                       SourceRange Range) override final {
+    getSharedAnalysis<ConditionalDirectiveTracker>().recordDefined(Range);
+  }
+
+  virtual void If(SourceLocation Loc, SourceRange ConditionRange,
+                  ConditionValueKind ConditionValue) override final {
+    check(getSharedAnalysis<ConditionalDirectiveTracker>().record(
+        ConditionalDirective::If, Loc, Loc, ConditionRange));
+  }
+
+  virtual void Elif(SourceLocation Loc, SourceRange ConditionRange,
+                    ConditionValueKind ConditionValue,
+                    SourceLocation IfLoc) override final {
+    check(getSharedAnalysis<ConditionalDirectiveTracker>().record(
+        ConditionalDirective::Elif, Loc, IfLoc, ConditionRange));
+  }
+
+  virtual void Else(SourceLocation Loc, SourceLocation IfLoc) override final {
+    check(getSharedAnalysis<ConditionalDirectiveTracker>().record(
+        ConditionalDirective::Else, Loc, IfLoc));
+  }
+
+  virtual void Endif(SourceLocation Loc, SourceLocation IfLoc) override final {
+    check(getSharedAnalysis<ConditionalDirectiveTracker>().record(
+        ConditionalDirective::Endif, Loc, IfLoc));
+  }
+
+protected:
+  /// \brief To be implemented by the subclass: Check a directive which is not
+  /// to be ignored.
+  /// \param directive Record of the directive.
+  virtual void checkDirective(const ConditionalDirective &directive) {}
+
+private:
+  void check(const ConditionalDirective &directive) {
+    if (doIgnore(directive.loc)) {
+      return;
+    }
+    checkDirective(directive);
+  }
+};
+}
+
+#endif
@@ -0,0 +1,140 @@
+//===-  ConditionalDirectiveTracker.cpp - #if, #elif, #else and #endif-----===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ConditionalDirectiveTracker.h"
+#include "clang/Basic/IdentifierTable.h"
+#include "clang/Basic/SourceManager.h"
+#include "clang/Basic/TokenKinds.h"
+#include "clang/Lex/Lexer.h"
+#include "clang/Lex/MacroInfo.h"
+#include "clang/Lex/Preprocessor.h"
+#include "clang/Lex/Token.h"
+#include "llvm/Support/raw_ostream.h"
+#include <cassert>
+
+using namespace clang;
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+char ConditionalDirectiveTracker::ID = 0;
+
+ConditionalDirectiveTracker::ConditionalDirectiveTracker(CompilerInstance &CI)
+    : CI(CI) {}
+
+void ConditionalDirectiveTracker::recordDefined(SourceRange range) {
+  // The operators reported before a condition gets recorded belong to it.
+  if (areDefinedOperatorsTaken) {
+    expandedDefinedOperators.clear();
+    areDefinedOperatorsTaken = false;
+  }
+  const SourceLocation loc = range.getBegin();
+  if (loc.isMacroID() && (expandedDefinedOperators.empty() ||
+                          expandedDefinedOperators.back() != loc)) {
+    expandedDefinedOperators.push_back(loc);
+  }
+}
+
+const ConditionalDirective &
+ConditionalDirectiveTracker::record(ConditionalDirective::Kind kind,
+                                    SourceLocation loc, SourceLocation ifLoc,
+                                    SourceRange conditionRange) {
+  if (directiveCount > 0 && last.loc == loc) {
+    return last;
+  }
+  if (areDefinedOperatorsTaken) {
+    expandedDefinedOperators.clear();
+  }
+  areDefinedOperatorsTaken = true;
+  isLastScanned = false;
+  ++directiveCount;
+  last = ConditionalDirective{kind, loc, ifLoc, conditionRange,
+                              expandedDefinedOperators};
+  return last;
+}
+
+llvm::ArrayRef<SourceLocation>
+ConditionalDirectiveTracker::getUndefinedIdentifiers(
+    const ConditionalDirective &directive) {
+  assert(&directive == &last && "Only the last directive can be scanned.");
+  if (isLastScanned) {
+    return undefinedIdentifiers;
+  }
+  isLastScanned = true;
+  undefinedIdentifiers.clear();
+  if (directive.conditionRange.isInvalid()) {
+    return undefinedIdentifiers;
+  }
+
+  const SourceManager &SM = CI.getSourceManager();
+  Preprocessor &PP = CI.getPreprocessor();
+  const std::pair<FileID, unsigned> begin =
+      SM.getDecomposedLoc(directive.conditionRange.getBegin());
+  const unsigned endOffset =
+      SM.getFileOffset(directive.conditionRange.getEnd());
+  bool invalid = false;
+  const StringRef text = SM.getBufferData(begin.first, &invalid);
+  if (invalid) {
+    return undefinedIdentifiers;
+  }
+
+  Lexer lexer(SM.getLocForStartOfFile(begin.first), CI.getLangOpts(),
+              text.begin(), text.begin() + begin.second, text.end());
+  Token token;
+  bool isDefinedOperand = false;
+  bool isBuiltinArgument = false;
+  unsigned skippedParens = 0;
+  while (true) {
+    lexer.LexFromRawLexer(token);
+    if (token.is(tok::eof) ||
+        SM.getFileOffset(token.getLocation()) >= endOffset) {
+      break;
+    }
+    ++scannedTokenCount;
+
+    // The arguments of built-in macros like __has_include are no macros.
+    if (skippedParens > 0) {
+      if (token.is(tok::l_paren)) {
+        ++skippedParens;
+      } else if (token.is(tok::r_paren)) {
+        --skippedParens;
+      }
+      continue;
+    }
+    if (isBuiltinArgument) {
+      isBuiltinArgument = false;
+      if (token.is(tok::l_paren)) {
+        skippedParens = 1;
+        continue;
+      }
+    }
+    if (token.isNot(tok::raw_identifier)) {
+      continue;
+    }
+
+    const IdentifierInfo *identifier =
+        PP.getIdentifierInfo(token.getRawIdentifier());
+    if (isDefinedOperand) {
+      isDefinedOperand = false;
+    } else if (identifier->isStr("defined")) {
+      isDefinedOperand = true;
+    } else if (const MacroInfo *macroInfo = PP.getMacroInfo(identifier)) {
+      isBuiltinArgument = macroInfo->isBuiltinMacro();
+    } else if (!identifier->isStr("true") && !identifier->isStr("false") &&
+               !identifier->isCPlusPlusOperatorKeyword()) {
+      undefinedIdentifiers.push_back(token.getLocation());
+    }
+  }
+  return undefinedIdentifiers;
+}
+
+void ConditionalDirectiveTracker::printStatistics(
+    llvm::raw_ostream &OS) const {
+  OS << "Conditional directives: " << directiveCount << " directives, "
+     << scannedTokenCount << " condition tokens scanned\n";
+}
+}
@@ -0,0 +1,81 @@
+//===-  ConditionalDirectiveTracker.h - #if, #elif, #else and #endif-------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef CONDITIONAL_DIRECTIVE_TRACKER_H
+#define CONDITIONAL_DIRECTIVE_TRACKER_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include <cstdint>
+#include <vector>
+
+namespace misracpp2008 {
+
+/// \brief A conditional directive as seen by the conditional directive rules.
+struct ConditionalDirective {
+  enum Kind : uint8_t { If, Elif, Else, Endif };
+
+  Kind kind;
+  clang::SourceLocation loc;
+  /// Location of the \#if, \#ifdef or \#ifndef the directive belongs to,
+  /// same as \c loc for an \#if.
+  clang::SourceLocation ifLoc;
+  /// Condition of an \#if or \#elif, invalid for the other directives.
+  clang::SourceRange conditionRange;
+  /// Uses of the defined operator in the condition which are the result of a
+  /// macro expansion.
+  llvm::ArrayRef<clang::SourceLocation> expandedDefinedOperators;
+};
+
+/// \brief Shared analysis recording the conditional directives of the
+/// translation unit, fed by the checkers which are told about them.
+///
+/// Recording a directive takes constant time, no matter how long its
+/// condition is: the defined operators are reported by the preprocessor while
+/// it evaluates the condition, and the tokens of a condition are only scanned
+/// when getUndefinedIdentifiers() asks for them, at most once per directive.
+/// The preprocessor hands over the location of the opening directive, so no
+/// stack of open directives needs to be kept.
+class ConditionalDirectiveTracker : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit ConditionalDirectiveTracker(clang::CompilerInstance &CI);
+
+  /// \brief Record a use of the defined operator in the condition being
+  /// evaluated, the arguments are the ones of clang::PPCallbacks::Defined().
+  void recordDefined(clang::SourceRange range);
+
+  /// \brief Record a conditional directive.
+  /// \return The record of the directive, valid until the next directive gets
+  /// recorded.
+  const ConditionalDirective &
+  record(ConditionalDirective::Kind kind, clang::SourceLocation loc,
+         clang::SourceLocation ifLoc,
+         clang::SourceRange conditionRange = clang::SourceRange());
+
+  /// \brief Get the identifiers in the condition of \c directive which are
+  /// neither defined macros nor operands of the defined operator.
+  /// \param directive The directive recorded last.
+  llvm::ArrayRef<clang::SourceLocation>
+  getUndefinedIdentifiers(const ConditionalDirective &directive);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  ConditionalDirective last;
+  bool isLastScanned = false;
+  bool areDefinedOperatorsTaken = false;
+  std::vector<clang::SourceLocation> expandedDefinedOperators;
+  std::vector<clang::SourceLocation> undefinedIdentifiers;
+  unsigned directiveCount = 0;
+  unsigned scannedTokenCount = 0;
+};
+}
+
+#endif
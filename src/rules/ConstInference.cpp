@@ -0,0 +1,572 @@
+//===-  ConstInference.cpp - Variables and functions which could be const--===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ConstInference.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char ConstInference::ID = 0;
+
+namespace {
+
+/// \brief Number of uses of \c this in a member function, and how many of
+/// them access a member.
+struct ThisCount {
+  unsigned uses = 0;
+  unsigned memberAccesses = 0;
+};
+
+bool isConst(const ASTContext &context, QualType type) {
+  return context.getBaseElementType(type).isConstQualified();
+}
+
+/// \brief The type of the objects \c type points or refers to, or a null
+/// type if \c type is neither a pointer nor a reference.
+QualType getIndirectType(QualType type) {
+  if (const PointerType *pointer = type->getAs<PointerType>()) {
+    return pointer->getPointeeType();
+  }
+  if (const ReferenceType *reference = type->getAs<ReferenceType>()) {
+    return reference->getPointeeType();
+  }
+  return QualType();
+}
+
+const FunctionProtoType *getPrototype(const CallExpr *call) {
+  if (const FunctionDecl *callee = call->getDirectCallee()) {
+    return callee->getType()->getAs<FunctionProtoType>();
+  }
+  QualType type = call->getCallee()->getType();
+  if (const PointerType *pointer = type->getAs<PointerType>()) {
+    type = pointer->getPointeeType();
+  }
+  return type->getAs<FunctionProtoType>();
+}
+
+/// \brief Records the uses of the variables and of \c this which may modify
+/// them, and the candidates for the rules.
+class UseRecorder : public RecursiveASTVisitor<UseRecorder> {
+  typedef RecursiveASTVisitor<UseRecorder> Base;
+
+public:
+  UseRecorder(const ASTContext &context,
+              llvm::DenseMap<const VarDecl *, uint8_t> &variableUses,
+              llvm::DenseMap<const CXXMethodDecl *, uint8_t> &thisUses,
+              std::vector<const VarDecl *> &variables,
+              std::vector<const ParmVarDecl *> &indirections,
+              std::vector<const CXXMethodDecl *> &methods)
+      : context(context), variableUses(variableUses), thisUses(thisUses),
+        variables(variables), indirections(indirections), methods(methods) {}
+
+  bool TraverseDecl(Decl *decl) {
+    const FunctionDecl *enclosingFunction = function;
+    const CXXMethodDecl *enclosingMethod = method;
+    if (const FunctionDecl *functionDecl =
+            dyn_cast_or_null<FunctionDecl>(decl)) {
+      function = functionDecl;
+      method = dyn_cast<CXXMethodDecl>(functionDecl);
+    }
+    const bool result = Base::TraverseDecl(decl);
+    function = enclosingFunction;
+    method = enclosingMethod;
+    return result;
+  }
+
+  /// Return statements of a lambda return from its call operator, but \c this
+  /// still designates the object of the enclosing member function.
+  bool TraverseLambdaExpr(LambdaExpr *expr) {
+    const FunctionDecl *enclosingFunction = function;
+    function = expr->getCallOperator();
+    const bool result = Base::TraverseLambdaExpr(expr);
+    function = enclosingFunction;
+    return result;
+  }
+
+  bool TraverseConstructorInitializer(CXXCtorInitializer *init) {
+    if (init->isAnyMemberInitializer()) {
+      sinkInitializer(init->getAnyMember()->getType(), init->getInit());
+    }
+    return Base::TraverseConstructorInitializer(init);
+  }
+
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (!decl->doesThisDeclarationHaveABody() || decl->isImplicit() ||
+        decl->isDefaulted() || decl->isDependentContext()) {
+      return true;
+    }
+    const CXXMethodDecl *methodDecl = dyn_cast<CXXMethodDecl>(decl);
+    const bool isVirtual = methodDecl != nullptr && methodDecl->isVirtual();
+    for (const ParmVarDecl *param : decl->params()) {
+      if (param->getName().empty()) {
+        continue;
+      }
+      const QualType type = param->getType();
+      if (!type->isReferenceType() && !isConst(context, type)) {
+        variables.push_back(param);
+      }
+      const QualType indirectType = getIndirectType(type);
+      if (!indirectType.isNull() && !type->isRValueReferenceType() &&
+          !indirectType->isFunctionType() && !isConst(context, indirectType) &&
+          !isVirtual && !decl->isMain()) {
+        indirections.push_back(param);
+      }
+    }
+    if (methodDecl != nullptr && !methodDecl->isStatic() && !isVirtual &&
+        !isa<CXXConstructorDecl>(methodDecl) &&
+        !isa<CXXDestructorDecl>(methodDecl) &&
+        !methodDecl->getParent()->isLambda()) {
+      methods.push_back(methodDecl);
+    }
+    return true;
+  }
+
+  bool VisitVarDecl(VarDecl *decl) {
+    if (isa<ParmVarDecl>(decl)) {
+      return true;
+    }
+    const Expr *init = decl->getInit();
+    sinkInitializer(decl->getType(), init);
+    if (init == nullptr || !decl->isLocalVarDecl() || decl->isImplicit() ||
+        decl->isExceptionVariable() ||
+        decl->getDeclContext()->isDependentContext() ||
+        decl->getType()->isReferenceType() ||
+        isConst(context, decl->getType())) {
+      return true;
+    }
+    // A const object of class type needs a user-provided default constructor.
+    if (const CXXConstructExpr *construct = dyn_cast<CXXConstructExpr>(init)) {
+      if (construct->getNumArgs() == 0 &&
+          !construct->getConstructor()->isUserProvided()) {
+        return true;
+      }
+    }
+    variables.push_back(decl);
+    return true;
+  }
+
+  bool VisitUnaryOperator(UnaryOperator *op) {
+    if (op->isIncrementDecrementOp()) {
+      mark(op->getSubExpr(), VariableUse::Written);
+    } else if (op->getOpcode() == UO_AddrOf) {
+      mark(op->getSubExpr(), VariableUse::AddressTaken);
+    }
+    return true;
+  }
+
+  bool VisitBinaryOperator(BinaryOperator *op) {
+    if (op->isAssignmentOp()) {
+      mark(op->getLHS(), VariableUse::Written);
+      if (op->getOpcode() == BO_Assign) {
+        sinkInitializer(op->getLHS()->getType(), op->getRHS());
+      }
+    }
+    return true;
+  }
+
+  bool VisitCallExpr(CallExpr *call) {
+    unsigned firstArg = 0;
+    if (isa<CXXOperatorCallExpr>(call) && call->getNumArgs() != 0) {
+      if (const CXXMethodDecl *callee =
+              dyn_cast_or_null<CXXMethodDecl>(call->getDirectCallee())) {
+        // The first argument is the object of the member operator.
+        if (!callee->isStatic() && !callee->isConst()) {
+          mark(call->getArg(0), VariableUse::Written);
+        }
+        firstArg = 1;
+      }
+    }
+    sinkArguments(getPrototype(call), call->getArgs() + firstArg,
+                  call->getNumArgs() - firstArg);
+    return true;
+  }
+
+  bool VisitCXXMemberCallExpr(CXXMemberCallExpr *call) {
+    const CXXMethodDecl *callee = call->getMethodDecl();
+    const MemberExpr *member =
+        dyn_cast<MemberExpr>(call->getCallee()->IgnoreParens());
+    if (callee == nullptr || member == nullptr || callee->isConst()) {
+      return true;
+    }
+    if (member->isArrow()) {
+      markPointee(member->getBase());
+    } else {
+      mark(member->getBase(), VariableUse::Written);
+    }
+    return true;
+  }
+
+  bool VisitCXXConstructExpr(CXXConstructExpr *construct) {
+    sinkArguments(
+        construct->getConstructor()->getType()->getAs<FunctionProtoType>(),
+        construct->getArgs(), construct->getNumArgs());
+    return true;
+  }
+
+  bool VisitCXXNewExpr(CXXNewExpr *expr) {
+    const FunctionDecl *allocator = expr->getOperatorNew();
+    if (allocator == nullptr) {
+      return true;
+    }
+    // The placement arguments follow the size of the allocation.
+    for (unsigned i = 0, e = expr->getNumPlacementArgs(); i != e; ++i) {
+      const unsigned param = i + 1;
+      if (param < allocator->getNumParams()) {
+        sinkInitializer(allocator->getParamDecl(param)->getType(),
+                        expr->getPlacementArg(i));
+      }
+    }
+    return true;
+  }
+
+  bool VisitReturnStmt(ReturnStmt *stmt) {
+    if (function != nullptr) {
+      sinkInitializer(function->getReturnType(), stmt->getRetValue());
+    }
+    return true;
+  }
+
+  bool VisitInitListExpr(InitListExpr *list) {
+    if (!list->isSemanticForm()) {
+      return true;
+    }
+    const RecordType *record = list->getType()->getAs<RecordType>();
+    if (record != nullptr && !record->getDecl()->isUnion()) {
+      unsigned i = 0;
+      for (const FieldDecl *field : record->getDecl()->fields()) {
+        if (i == list->getNumInits()) {
+          break;
+        }
+        sinkInitializer(field->getType(), list->getInit(i++));
+      }
+      return true;
+    }
+    for (const Expr *init : list->inits()) {
+      sinkInitializer(init->getType(), init);
+    }
+    return true;
+  }
+
+  /// The range of a range-based for loop is bound to a reference the loop
+  /// does not traverse.
+  bool VisitCXXForRangeStmt(CXXForRangeStmt *stmt) {
+    const DeclStmt *rangeStmt = stmt->getRangeStmt();
+    if (rangeStmt == nullptr || !rangeStmt->isSingleDecl()) {
+      return true;
+    }
+    if (const VarDecl *range = dyn_cast<VarDecl>(rangeStmt->getSingleDecl())) {
+      sinkInitializer(range->getType(), range->getInit());
+    }
+    return true;
+  }
+
+  bool VisitCXXThisExpr(CXXThisExpr *) {
+    if (method != nullptr) {
+      ++thisCounts[method].uses;
+    }
+    return true;
+  }
+
+  bool VisitMemberExpr(MemberExpr *expr) {
+    if (method != nullptr &&
+        isa<CXXThisExpr>(expr->getBase()->IgnoreParenImpCasts())) {
+      ++thisCounts[method].memberAccesses;
+    }
+    return true;
+  }
+
+  /// \brief Fold the uses of \c this into the flags of the member functions.
+  void finish() {
+    for (const auto &entry : thisCounts) {
+      uint8_t &flags = thisUses[entry.first];
+      if (entry.second.uses != 0) {
+        flags |= ThisUse::UsesThis;
+      }
+      // Any other use lets \c this escape.
+      if (entry.second.uses != entry.second.memberAccesses) {
+        flags |= ThisUse::ModifiesThis;
+      }
+    }
+  }
+
+private:
+  const ASTContext &context;
+  llvm::DenseMap<const VarDecl *, uint8_t> &variableUses;
+  llvm::DenseMap<const CXXMethodDecl *, uint8_t> &thisUses;
+  std::vector<const VarDecl *> &variables;
+  std::vector<const ParmVarDecl *> &indirections;
+  std::vector<const CXXMethodDecl *> &methods;
+  llvm::DenseMap<const CXXMethodDecl *, ThisCount> thisCounts;
+  const FunctionDecl *function = nullptr;
+  const CXXMethodDecl *method = nullptr;
+
+  void record(const ValueDecl *decl, uint8_t flag) {
+    if (const VarDecl *variable = dyn_cast<VarDecl>(decl)) {
+      variableUses[variable] |=
+          variable->getType()->isReferenceType() ? VariableUse::PointeeModified
+                                                 : flag;
+    }
+  }
+
+  void modifyThis() {
+    if (method != nullptr) {
+      thisUses[method] |= ThisUse::ModifiesThis;
+    }
+  }
+
+  /// \brief Record that \c target is initialized with \c init, as a
+  /// variable, a parameter or a return value.
+  void sinkInitializer(QualType target, const Expr *init) {
+    if (init == nullptr || target.isNull()) {
+      return;
+    }
+    const QualType indirectType = getIndirectType(target);
+    if (indirectType.isNull() || isConst(context, indirectType)) {
+      return;
+    }
+    if (target->isReferenceType()) {
+      mark(init, VariableUse::BoundToReference);
+    } else {
+      markPointee(init);
+    }
+  }
+
+  /// \brief Record that the arguments are passed to the parameters of
+  /// \c prototype. Without a prototype, every argument may be modified.
+  void sinkArguments(const FunctionProtoType *prototype,
+                     const Expr *const *args, unsigned argCount) {
+    for (unsigned i = 0; i != argCount; ++i) {
+      const Expr *arg = args[i];
+      if (prototype == nullptr) {
+        mark(arg, VariableUse::BoundToReference);
+        sinkInitializer(arg->getType(), arg);
+      } else if (i < prototype->getNumParams()) {
+        sinkInitializer(prototype->getParamType(i), arg);
+      } else {
+        // Variadic arguments are copied.
+        sinkInitializer(arg->getType(), arg);
+      }
+    }
+  }
+
+  /// \brief Record that the object the glvalue \c expr designates may be
+  /// modified.
+  void mark(const Expr *expr, uint8_t flag) {
+    while (expr != nullptr) {
+      expr = expr->IgnoreParens();
+      if (const CastExpr *cast = dyn_cast<CastExpr>(expr)) {
+        switch (cast->getCastKind()) {
+        case CK_NoOp:
+        case CK_DerivedToBase:
+        case CK_UncheckedDerivedToBase:
+        case CK_BaseToDerived:
+        case CK_LValueBitCast:
+          expr = cast->getSubExpr();
+          continue;
+        default:
+          return;
+        }
+      }
+      if (const MemberExpr *member = dyn_cast<MemberExpr>(expr)) {
+        const ValueDecl *memberDecl = member->getMemberDecl();
+        // Neither mutable members nor the objects of reference members are
+        // part of the object.
+        if (memberDecl->getType()->isReferenceType()) {
+          return;
+        }
+        if (const FieldDecl *field = dyn_cast<FieldDecl>(memberDecl)) {
+          if (field->isMutable()) {
+            return;
+          }
+        }
+        if (member->isArrow()) {
+          markPointee(member->getBase());
+          return;
+        }
+        expr = member->getBase();
+      } else if (const ArraySubscriptExpr *subscript =
+                     dyn_cast<ArraySubscriptExpr>(expr)) {
+        markPointee(subscript->getBase());
+        return;
+      } else if (const UnaryOperator *op = dyn_cast<UnaryOperator>(expr)) {
+        if (op->getOpcode() == UO_Deref) {
+          markPointee(op->getSubExpr());
+        } else if (op->isPrefix()) {
+          expr = op->getSubExpr();
+          continue;
+        }
+        return;
+      } else if (const BinaryOperator *op = dyn_cast<BinaryOperator>(expr)) {
+        if (op->getOpcode() == BO_Comma) {
+          expr = op->getRHS();
+        } else if (op->isAssignmentOp()) {
+          expr = op->getLHS();
+        } else {
+          return;
+        }
+      } else if (const ConditionalOperator *op =
+                     dyn_cast<ConditionalOperator>(expr)) {
+        mark(op->getTrueExpr(), flag);
+        expr = op->getFalseExpr();
+      } else if (const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(expr)) {
+        record(ref->getDecl(), flag);
+        return;
+      } else {
+        return;
+      }
+    }
+  }
+
+  /// \brief Record that the object the pointer \c expr points to may be
+  /// modified.
+  void markPointee(const Expr *expr) {
+    while (expr != nullptr) {
+      expr = expr->IgnoreParens();
+      if (const CastExpr *cast = dyn_cast<CastExpr>(expr)) {
+        switch (cast->getCastKind()) {
+        case CK_LValueToRValue: {
+          // Only pointer variables are followed, the pointers stored in
+          // objects are not part of them.
+          const DeclRefExpr *ref =
+              dyn_cast<DeclRefExpr>(cast->getSubExpr()->IgnoreParens());
+          if (ref != nullptr) {
+            record(ref->getDecl(), VariableUse::PointeeModified);
+          }
+          return;
+        }
+        case CK_ArrayToPointerDecay:
+          mark(cast->getSubExpr(), VariableUse::Written);
+          return;
+        case CK_FunctionToPointerDecay:
+        case CK_NullToPointer:
+          return;
+        default:
+          expr = cast->getSubExpr();
+          continue;
+        }
+      }
+      if (isa<CXXThisExpr>(expr)) {
+        modifyThis();
+        return;
+      }
+      if (const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(expr)) {
+        record(ref->getDecl(), VariableUse::PointeeModified);
+        return;
+      }
+      if (const UnaryOperator *op = dyn_cast<UnaryOperator>(expr)) {
+        if (op->getOpcode() == UO_AddrOf) {
+          mark(op->getSubExpr(), VariableUse::Written);
+          return;
+        }
+        if (!op->isIncrementDecrementOp()) {
+          return;
+        }
+        expr = op->getSubExpr();
+      } else if (const BinaryOperator *op = dyn_cast<BinaryOperator>(expr)) {
+        if (op->isAdditiveOp()) {
+          expr = op->getLHS()->getType()->isPointerType() ? op->getLHS()
+                                                           : op->getRHS();
+        } else if (op->getOpcode() == BO_Comma) {
+          expr = op->getRHS();
+        } else if (op->isAssignmentOp()) {
+          expr = op->getLHS();
+        } else {
+          return;
+        }
+      } else if (const ConditionalOperator *op =
+                     dyn_cast<ConditionalOperator>(expr)) {
+        markPointee(op->getTrueExpr());
+        expr = op->getFalseExpr();
+      } else {
+        return;
+      }
+    }
+  }
+};
+
+/// \brief Tell whether \c method may not be static, whatever its body.
+bool mayNotBeStatic(const CXXMethodDecl *method) {
+  return method->isOverloadedOperator() || isa<CXXConversionDecl>(method) ||
+         method->getRefQualifier() != RQ_None;
+}
+}
+
+ConstInference::ConstInference(CompilerInstance &CI) : CI(CI) {}
+
+uint8_t ConstInference::getVariableUse(const VarDecl *variable) {
+  scan();
+  return variableUses.lookup(variable);
+}
+
+uint8_t ConstInference::getThisUse(const CXXMethodDecl *method) {
+  scan();
+  return thisUses.lookup(method);
+}
+
+llvm::ArrayRef<ConstViolation> ConstInference::getViolations() {
+  scan();
+  return violations;
+}
+
+void ConstInference::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Const inference: " << variables.size() << " variables, "
+     << indirections.size() << " pointer and reference parameters, "
+     << methods.size() << " member functions, " << violations.size()
+     << " violations\n";
+}
+
+void ConstInference::scan() {
+  if (isScanned) {
+    return;
+  }
+  isScanned = true;
+  ASTContext &context = CI.getASTContext();
+  UseRecorder recorder(context, variableUses, thisUses, variables,
+                       indirections, methods);
+  recorder.TraverseDecl(context.getTranslationUnitDecl());
+  recorder.finish();
+  check();
+}
+
+void ConstInference::check() {
+  for (const VarDecl *variable : variables) {
+    if ((variableUses.lookup(variable) & VariableUse::Modified) == 0) {
+      violations.push_back(ConstViolation{"7-1-1", variable->getLocation()});
+    }
+  }
+
+  for (const ParmVarDecl *param : indirections) {
+    uint8_t uses = variableUses.lookup(param);
+    // Assigning a pointer does not modify the object it points to.
+    if (param->getType()->isPointerType()) {
+      uses &= ~VariableUse::Written;
+    }
+    if (uses == 0) {
+      violations.push_back(ConstViolation{"7-1-2", param->getLocation()});
+    }
+  }
+
+  for (const CXXMethodDecl *method : methods) {
+    const uint8_t uses = thisUses.lookup(method);
+    const bool couldBeStatic =
+        (uses & ThisUse::UsesThis) == 0 && !mayNotBeStatic(method);
+    const bool couldBeConst =
+        (uses & ThisUse::ModifiesThis) == 0 && !method->isConst();
+    if (couldBeStatic || couldBeConst) {
+      violations.push_back(ConstViolation{
+          "9-3-3", method->getCanonicalDecl()->getLocation()});
+    }
+  }
+}
+}
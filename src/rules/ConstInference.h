@@ -0,0 +1,106 @@
+//===-  ConstInference.h - Variables and functions which could be const----===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef CONST_INFERENCE_H
+#define CONST_INFERENCE_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringRef.h"
+#include <cstdint>
+#include <vector>
+
+namespace clang {
+class CXXMethodDecl;
+class ParmVarDecl;
+class VarDecl;
+}
+
+namespace misracpp2008 {
+
+/// \brief How a variable is used, a combination of flags.
+struct VariableUse {
+  enum Flag : uint8_t {
+    Written = 1 << 0,
+    AddressTaken = 1 << 1,
+    BoundToReference = 1 << 2,
+    /// The object a pointer or a reference designates may be modified
+    /// through the variable.
+    PointeeModified = 1 << 3
+  };
+  /// Flags meaning that the variable itself may be modified.
+  static const uint8_t Modified = Written | AddressTaken | BoundToReference;
+};
+
+/// \brief How a member function uses its implicit object, a combination of
+/// flags.
+struct ThisUse {
+  enum Flag : uint8_t {
+    UsesThis = 1 << 0,
+    ModifiesThis = 1 << 1
+  };
+};
+
+/// \brief Violation of one of the rules 7-1-1, 7-1-2 and 9-3-3.
+struct ConstViolation {
+  llvm::StringRef rule;
+  clang::SourceLocation loc;
+};
+
+/// \brief Shared analysis telling which variables, parameters and member
+/// functions of the translation unit could be declared const or static.
+///
+/// The translation unit is traversed once. Each expression which may modify
+/// an object is traced down to the variable or the implicit object it
+/// designates, without looking up the parents of the expression: writes,
+/// address-of operators, and the initializers of non-const references and
+/// pointers, i.e. variables, arguments, return values and the objects of
+/// non-const member function calls. The result is a set of flags for each
+/// variable and member function, from which the rules are checked at the
+/// end of the translation unit.
+///
+/// The analysis is conservative: taking the address of a variable counts as
+/// a modification, and so does any use of \c this other than accessing a
+/// member. Code depending on template parameters is not checked.
+class ConstInference : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit ConstInference(clang::CompilerInstance &CI);
+
+  /// \brief The flags of \c variable, see VariableUse.
+  uint8_t getVariableUse(const clang::VarDecl *variable);
+
+  /// \brief The flags of \c method, see ThisUse.
+  uint8_t getThisUse(const clang::CXXMethodDecl *method);
+
+  /// \brief The violations of the rules, in the order of the source.
+  llvm::ArrayRef<ConstViolation> getViolations();
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  bool isScanned = false;
+  llvm::DenseMap<const clang::VarDecl *, uint8_t> variableUses;
+  llvm::DenseMap<const clang::CXXMethodDecl *, uint8_t> thisUses;
+  /// Local variables and parameters which could be const, in the order of
+  /// the source.
+  std::vector<const clang::VarDecl *> variables;
+  /// Pointer and reference parameters to non-const objects.
+  std::vector<const clang::ParmVarDecl *> indirections;
+  /// Member functions which could be static or const.
+  std::vector<const clang::CXXMethodDecl *> methods;
+  std::vector<ConstViolation> violations;
+
+  void scan();
+  void check();
+};
+}
+
+#endif
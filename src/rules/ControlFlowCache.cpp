@@ -0,0 +1,160 @@
+//===-  ControlFlowCache.cpp - Control flow graphs of the functions--------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ControlFlowCache.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Decl.h"
+#include "clang/Analysis/CFG.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/Timer.h"
+#include "llvm/Support/raw_ostream.h"
+#include <deque>
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char ControlFlowCache::ID = 0;
+
+ControlFlowCache::ControlFlowCache(CompilerInstance &CI) : CI(CI) {}
+
+ControlFlowCache::~ControlFlowCache() {}
+
+const CFG *ControlFlowCache::getCFG(const FunctionDecl *function) {
+  FunctionFlow &flow = functions[function];
+  if (flow.isBuilt) {
+    return flow.cfg.get();
+  }
+  flow.isBuilt = true;
+  if (!function->hasBody() || function->isDependentContext()) {
+    return nullptr;
+  }
+
+  // The rules are about the code as written, so trivially false conditions
+  // must not make the code they guard unreachable.
+  CFG::BuildOptions options;
+  options.PruneTriviallyFalseEdges = false;
+  options.AddInitializers = true;
+  options.setAllAlwaysAdd();
+  const llvm::TimeRecord start = llvm::TimeRecord::getCurrentTime(true);
+  flow.cfg = CFG::buildCFG(function, function->getBody(),
+                           &CI.getASTContext(), options);
+  buildSeconds += llvm::TimeRecord::getCurrentTime(false).getWallTime() -
+                  start.getWallTime();
+  ++cfgCount;
+  return flow.cfg.get();
+}
+
+const TrackedVariables &
+ControlFlowCache::getTrackedVariables(const FunctionDecl *function) {
+  FunctionFlow &flow = functions[function];
+  if (!flow.variables) {
+    flow.variables.reset(new TrackedVariables(*function));
+  }
+  return *flow.variables;
+}
+
+DataflowResult ControlFlowCache::solve(const CFG &cfg,
+                                       const BitVectorProblem &problem) {
+  ++problemCount;
+  const bool isForward = problem.getDirection() == BitVectorProblem::Forward;
+  const bool isUnion = problem.getMeet() == BitVectorProblem::Union;
+  const unsigned blockCount = cfg.getNumBlockIDs();
+  const CFGBlock &boundary = isForward ? cfg.getEntry() : cfg.getExit();
+
+  // Blocks not visited yet hold the neutral element of the meet. The exits
+  // of the blocks are kept as well, so a block is only re-joined when one of
+  // its neighbours changed.
+  DataflowResult result;
+  result.blockStates.assign(blockCount,
+                            llvm::BitVector(problem.getBitCount(), !isUnion));
+  std::vector<llvm::BitVector> exitStates(result.blockStates);
+  llvm::BitVector &boundaryState = result.blockStates[boundary.getBlockID()];
+  boundaryState.reset();
+  problem.initBoundary(boundaryState);
+
+  // The CFG numbers its blocks backwards, starting from the exit, so this
+  // order approximates the direction of the problem.
+  std::deque<const CFGBlock *> worklist;
+  llvm::BitVector isQueued(blockCount);
+  for (const CFGBlock *block : cfg) {
+    if (isForward) {
+      worklist.push_front(block);
+    } else {
+      worklist.push_back(block);
+    }
+    isQueued.set(block->getBlockID());
+  }
+
+  while (!worklist.empty()) {
+    const CFGBlock *block = worklist.front();
+    worklist.pop_front();
+    const unsigned blockID = block->getBlockID();
+    isQueued.reset(blockID);
+    ++iterationCount;
+
+    llvm::BitVector &state = result.blockStates[blockID];
+    if (block != &boundary) {
+      bool isFirst = true;
+      auto join = [&](const CFGBlock *neighbour) {
+        if (neighbour == nullptr) {
+          return;
+        }
+        const llvm::BitVector &other = exitStates[neighbour->getBlockID()];
+        if (isFirst) {
+          state = other;
+          isFirst = false;
+        } else if (isUnion) {
+          state |= other;
+        } else {
+          state &= other;
+        }
+      };
+      if (isForward) {
+        for (const CFGBlock *predecessor : block->preds()) {
+          join(predecessor);
+        }
+      } else {
+        for (const CFGBlock *successor : block->succs()) {
+          join(successor);
+        }
+      }
+    }
+
+    llvm::BitVector exitState = state;
+    problem.transferBlock(*block, exitState);
+    if (exitState == exitStates[blockID]) {
+      continue;
+    }
+    exitStates[blockID] = std::move(exitState);
+    auto enqueue = [&](const CFGBlock *neighbour) {
+      if (neighbour && !isQueued.test(neighbour->getBlockID())) {
+        isQueued.set(neighbour->getBlockID());
+        worklist.push_back(neighbour);
+      }
+    };
+    if (isForward) {
+      for (const CFGBlock *successor : block->succs()) {
+        enqueue(successor);
+      }
+    } else {
+      for (const CFGBlock *predecessor : block->preds()) {
+        enqueue(predecessor);
+      }
+    }
+  }
+  return result;
+}
+
+void ControlFlowCache::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Control flow cache: " << cfgCount << " CFGs built in "
+     << llvm::format("%.3f", buildSeconds * 1000) << " ms, " << problemCount
+     << " dataflow problems solved in " << iterationCount
+     << " block iterations\n";
+}
+}
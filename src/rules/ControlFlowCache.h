@@ -0,0 +1,66 @@
+//===-  ControlFlowCache.h - Control flow graphs of the functions----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef CONTROL_FLOW_CACHE_H
+#define CONTROL_FLOW_CACHE_H
+
+#include "Dataflow.h"
+#include "misracpp2008.h"
+#include <map>
+#include <memory>
+
+namespace clang {
+class CFG;
+class FunctionDecl;
+}
+
+namespace misracpp2008 {
+
+/// \brief Shared analysis building the control flow graph of a function at
+/// most once per translation unit, and solving dataflow problems on it.
+///
+/// The graphs contain every statement as an element of its own, and keep the
+/// edges of trivially false conditions. Checkers get them through
+/// RuleCheckerASTContext::getCFG().
+class ControlFlowCache : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit ControlFlowCache(clang::CompilerInstance &CI);
+  virtual ~ControlFlowCache();
+
+  /// \brief Get the control flow graph of \c function.
+  /// \return The graph, nullptr if \c function has no body or the graph
+  /// could not be built.
+  const clang::CFG *getCFG(const clang::FunctionDecl *function);
+
+  /// \brief Get the variables of \c function the dataflow problems track.
+  const TrackedVariables &
+  getTrackedVariables(const clang::FunctionDecl *function);
+
+  /// \brief Solve \c problem on \c cfg with a worklist iteration to its
+  /// fixed point.
+  DataflowResult solve(const clang::CFG &cfg, const BitVectorProblem &problem);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  struct FunctionFlow {
+    std::unique_ptr<clang::CFG> cfg;
+    std::unique_ptr<TrackedVariables> variables;
+    bool isBuilt = false;
+  };
+
+  clang::CompilerInstance &CI;
+  std::map<const clang::FunctionDecl *, FunctionFlow> functions;
+  unsigned cfgCount = 0;
+  double buildSeconds = 0;
+  unsigned problemCount = 0;
+  unsigned iterationCount = 0;
+};
+}
+
+#endif
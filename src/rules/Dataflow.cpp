@@ -0,0 +1,273 @@
+//===-  Dataflow.cpp - Bit vector dataflow problems------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "Dataflow.h"
+#include "clang/AST/Decl.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/Stmt.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/Analysis/CFG.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+namespace {
+
+const DeclRefExpr *getReference(const Expr *expr) {
+  return dyn_cast<DeclRefExpr>(expr->IgnoreParens());
+}
+
+/// \brief Collect the variables of a function body and tell apart those
+/// only read and assigned from those used in any other way.
+class ReferenceCollector : public RecursiveASTVisitor<ReferenceCollector> {
+public:
+  llvm::SmallVector<const VarDecl *, 32> candidates;
+  llvm::SmallPtrSet<const VarDecl *, 8> escaped;
+
+  bool VisitVarDecl(VarDecl *var) {
+    candidates.push_back(var);
+    return true;
+  }
+
+  bool VisitDeclRefExpr(DeclRefExpr *ref) {
+    if (const VarDecl *var = dyn_cast<VarDecl>(ref->getDecl())) {
+      if (accounted.count(ref) == 0) {
+        escaped.insert(var);
+      }
+    }
+    return true;
+  }
+
+  // Parents are visited before their children, so the references read or
+  // assigned are known by the time they get visited themselves.
+  bool VisitImplicitCastExpr(ImplicitCastExpr *cast) {
+    if (cast->getCastKind() == CK_LValueToRValue) {
+      account(cast->getSubExpr());
+    }
+    return true;
+  }
+
+  bool VisitBinaryOperator(BinaryOperator *op) {
+    if (op->isAssignmentOp()) {
+      account(op->getLHS());
+    }
+    return true;
+  }
+
+  bool VisitUnaryOperator(UnaryOperator *op) {
+    if (op->isIncrementDecrementOp()) {
+      account(op->getSubExpr());
+    }
+    return true;
+  }
+
+  // The body of a lambda is not part of the CFG of the enclosing function.
+  bool TraverseLambdaExpr(LambdaExpr *lambda) {
+    for (const LambdaCapture &capture : lambda->captures()) {
+      if (capture.capturesVariable()) {
+        escaped.insert(capture.getCapturedVar());
+      }
+    }
+    return true;
+  }
+
+private:
+  llvm::SmallPtrSet<const DeclRefExpr *, 64> accounted;
+
+  void account(const Expr *expr) {
+    if (const DeclRefExpr *ref = getReference(expr)) {
+      accounted.insert(ref);
+    }
+  }
+};
+
+/// \brief Tell whether \c type is a class, or an array of classes, whose
+/// constructors or destructor may have effects of their own, e.g. a lock.
+bool hasSpecialMemberEffects(QualType type) {
+  const CXXRecordDecl *record =
+      type->getBaseElementTypeUnsafe()->getAsCXXRecordDecl();
+  if (record == nullptr || !record->hasDefinition()) {
+    return false;
+  }
+  return record->hasUserDeclaredConstructor() ||
+         !record->hasTrivialDefaultConstructor() ||
+         !record->hasTrivialDestructor();
+}
+
+bool isTrackable(const VarDecl *var) {
+  const QualType type = var->getType();
+  return var->hasLocalStorage() && !var->isImplicit() &&
+         !type->isReferenceType() && !type.isVolatileQualified() &&
+         !hasSpecialMemberEffects(type);
+}
+}
+
+TrackedVariables::TrackedVariables(const FunctionDecl &function) {
+  ReferenceCollector collector;
+  for (const ParmVarDecl *param : function.params()) {
+    collector.candidates.push_back(param);
+  }
+  collector.TraverseStmt(function.getBody());
+  for (const VarDecl *var : collector.candidates) {
+    if (isTrackable(var) && collector.escaped.count(var) == 0) {
+      indices[var] = size();
+      variables.push_back(var);
+    }
+  }
+}
+
+TrackedVariables::Access
+TrackedVariables::makeAccess(const VarDecl *variable, uint8_t kind) const {
+  auto it = indices.find(variable);
+  if (it == indices.end()) {
+    return Access{nullptr, 0, Access::None};
+  }
+  return Access{variable, it->second, kind};
+}
+
+TrackedVariables::Access TrackedVariables::getAccess(const Stmt *stmt) const {
+  const Access none{nullptr, 0, Access::None};
+  if (const ImplicitCastExpr *cast = dyn_cast<ImplicitCastExpr>(stmt)) {
+    if (cast->getCastKind() != CK_LValueToRValue) {
+      return none;
+    }
+    const DeclRefExpr *ref = getReference(cast->getSubExpr());
+    return ref ? makeAccess(dyn_cast<VarDecl>(ref->getDecl()), Access::Read)
+               : none;
+  }
+  if (const BinaryOperator *op = dyn_cast<BinaryOperator>(stmt)) {
+    if (!op->isAssignmentOp()) {
+      return none;
+    }
+    const DeclRefExpr *ref = getReference(op->getLHS());
+    const uint8_t kind = op->isCompoundAssignmentOp()
+                             ? Access::Read | Access::Write
+                             : Access::Write;
+    return ref ? makeAccess(dyn_cast<VarDecl>(ref->getDecl()), kind) : none;
+  }
+  if (const UnaryOperator *op = dyn_cast<UnaryOperator>(stmt)) {
+    if (!op->isIncrementDecrementOp()) {
+      return none;
+    }
+    const DeclRefExpr *ref = getReference(op->getSubExpr());
+    return ref ? makeAccess(dyn_cast<VarDecl>(ref->getDecl()),
+                            Access::Read | Access::Write)
+               : none;
+  }
+  // The CFG splits declarations of several variables into one declaration
+  // statement per variable.
+  if (const DeclStmt *declStmt = dyn_cast<DeclStmt>(stmt)) {
+    if (!declStmt->isSingleDecl()) {
+      return none;
+    }
+    const VarDecl *var = dyn_cast<VarDecl>(declStmt->getSingleDecl());
+    if (var == nullptr) {
+      return none;
+    }
+    return makeAccess(var, var->hasInit() ? Access::Write
+                                          : Access::DeclareUninitialized);
+  }
+  return none;
+}
+
+void BitVectorProblem::transferBlock(const CFGBlock &block,
+                                     llvm::BitVector &state) const {
+  if (direction == Forward) {
+    for (const CFGElement &element : block) {
+      transfer(element, state);
+    }
+  } else {
+    for (auto it = block.rbegin(), ie = block.rend(); it != ie; ++it) {
+      transfer(*it, state);
+    }
+  }
+}
+
+void BitVectorProblem::replay(
+    const CFGBlock &block, const DataflowResult &result,
+    llvm::function_ref<void(const CFGElement &, const llvm::BitVector &)>
+        callback) const {
+  llvm::BitVector state = result.blockStates[block.getBlockID()];
+  if (direction == Forward) {
+    for (const CFGElement &element : block) {
+      callback(element, state);
+      transfer(element, state);
+    }
+  } else {
+    for (auto it = block.rbegin(), ie = block.rend(); it != ie; ++it) {
+      callback(*it, state);
+      transfer(*it, state);
+    }
+  }
+}
+
+void LivenessProblem::transfer(const CFGElement &element,
+                               llvm::BitVector &state) const {
+  Optional<CFGStmt> stmt = element.getAs<CFGStmt>();
+  if (!stmt) {
+    return;
+  }
+  // Going backwards, a read and write element like x += 1 first kills the
+  // variable and then makes it live again.
+  const TrackedVariables::Access access =
+      variables.getAccess(stmt->getStmt());
+  if (access.is(TrackedVariables::Access::Write) ||
+      access.is(TrackedVariables::Access::DeclareUninitialized)) {
+    state.reset(access.index);
+  }
+  if (access.is(TrackedVariables::Access::Read)) {
+    state.set(access.index);
+  }
+}
+
+void UninitializedProblem::transfer(const CFGElement &element,
+                                    llvm::BitVector &state) const {
+  Optional<CFGStmt> stmt = element.getAs<CFGStmt>();
+  if (!stmt) {
+    return;
+  }
+  const TrackedVariables::Access access =
+      variables.getAccess(stmt->getStmt());
+  if (access.is(TrackedVariables::Access::DeclareUninitialized)) {
+    state.set(access.index);
+  } else if (access.is(TrackedVariables::Access::Write)) {
+    state.reset(access.index);
+  }
+}
+
+llvm::BitVector findReachableBlocks(const CFG &cfg) {
+  llvm::BitVector reachable(cfg.getNumBlockIDs());
+  llvm::SmallVector<const CFGBlock *, 32> worklist;
+  worklist.push_back(&cfg.getEntry());
+  reachable.set(cfg.getEntry().getBlockID());
+  // Without exception edges only throw expressions lead to the handlers,
+  // which are entered from any call of the try block as well.
+  for (const CFGBlock *block : cfg) {
+    if (block != nullptr && block->getLabel() != nullptr &&
+        isa<CXXCatchStmt>(block->getLabel())) {
+      reachable.set(block->getBlockID());
+      worklist.push_back(block);
+    }
+  }
+  while (!worklist.empty()) {
+    const CFGBlock *block = worklist.pop_back_val();
+    for (const CFGBlock *successor : block->succs()) {
+      if (successor && !reachable.test(successor->getBlockID())) {
+        reachable.set(successor->getBlockID());
+        worklist.push_back(successor);
+      }
+    }
+  }
+  return reachable;
+}
+}
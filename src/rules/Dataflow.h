@@ -0,0 +1,163 @@
+//===-  Dataflow.h - Bit vector dataflow problems--------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef DATAFLOW_H
+#define DATAFLOW_H
+
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/STLExtras.h"
+#include <cstdint>
+#include <vector>
+
+namespace clang {
+class CFG;
+class CFGBlock;
+class CFGElement;
+class FunctionDecl;
+class Stmt;
+class VarDecl;
+}
+
+namespace misracpp2008 {
+
+/// \brief The local variables and parameters of a function whose every use is
+/// either a read of their value or an assignment to them, numbered for the
+/// bit vectors of the dataflow problems.
+///
+/// Variables whose address is taken, which are bound to references, captured
+/// by lambdas or used in any other way may be accessed through aliases and
+/// are not tracked. Neither are volatile variables, nor objects of classes
+/// with constructors or a destructor of their own, which may be declared for
+/// their effects alone, e.g. locks.
+class TrackedVariables {
+public:
+  /// \brief How a CFG element accesses a tracked variable.
+  struct Access {
+    enum Kind : uint8_t {
+      None = 0,
+      Read = 1 << 0,
+      Write = 1 << 1,
+      /// Declaration without an initializer.
+      DeclareUninitialized = 1 << 2
+    };
+
+    const clang::VarDecl *variable;
+    unsigned index;
+    uint8_t kind;
+
+    bool is(Kind flag) const { return (kind & flag) != 0; }
+  };
+
+  explicit TrackedVariables(const clang::FunctionDecl &function);
+
+  unsigned size() const { return static_cast<unsigned>(variables.size()); }
+
+  const clang::VarDecl *getVariable(unsigned index) const {
+    return variables[index];
+  }
+
+  /// \brief Get the access of \c stmt, a statement of a CFG element, to a
+  /// tracked variable. Only \c stmt itself is looked at, not its children,
+  /// which are elements of their own.
+  Access getAccess(const clang::Stmt *stmt) const;
+
+private:
+  std::vector<const clang::VarDecl *> variables;
+  llvm::DenseMap<const clang::VarDecl *, unsigned> indices;
+
+  Access makeAccess(const clang::VarDecl *variable, uint8_t kind) const;
+};
+
+/// \brief The states a dataflow problem has been solved to. The state of a
+/// block is the one before its first element in the direction of the
+/// problem.
+struct DataflowResult {
+  std::vector<llvm::BitVector> blockStates;
+};
+
+/// \brief Base class of a dataflow problem on bit vectors, solved by
+/// ControlFlowCache::solve().
+class BitVectorProblem {
+public:
+  enum Direction { Forward, Backward };
+  /// How the states of the incoming edges of a block are joined.
+  enum Meet { Union, Intersection };
+
+  BitVectorProblem(Direction direction, Meet meet, unsigned bitCount)
+      : direction(direction), meet(meet), bitCount(bitCount) {}
+  virtual ~BitVectorProblem() {}
+
+  Direction getDirection() const { return direction; }
+  Meet getMeet() const { return meet; }
+  unsigned getBitCount() const { return bitCount; }
+
+  /// \brief Set the state at the entry of the function for forward problems,
+  /// at its exit for backward problems. All bits are clear by default.
+  virtual void initBoundary(llvm::BitVector &state) const {}
+
+  /// \brief Apply the effect of \c element to \c state.
+  virtual void transfer(const clang::CFGElement &element,
+                        llvm::BitVector &state) const = 0;
+
+  /// \brief Apply the effect of all the elements of \c block to \c state, in
+  /// the direction of the problem.
+  void transferBlock(const clang::CFGBlock &block,
+                     llvm::BitVector &state) const;
+
+  /// \brief Walk the elements of \c block in the direction of the problem.
+  /// \param callback Called with each element and the state before it in the
+  /// direction of the problem, e.g. the variables live after the element for
+  /// a liveness problem.
+  void replay(const clang::CFGBlock &block, const DataflowResult &result,
+              llvm::function_ref<void(const clang::CFGElement &,
+                                      const llvm::BitVector &)>
+                  callback) const;
+
+private:
+  Direction direction;
+  Meet meet;
+  unsigned bitCount;
+};
+
+/// \brief Backward problem: which tracked variables may be read before they
+/// get written again.
+class LivenessProblem : public BitVectorProblem {
+public:
+  explicit LivenessProblem(const TrackedVariables &variables)
+      : BitVectorProblem(Backward, Union, variables.size()),
+        variables(variables) {}
+
+  virtual void transfer(const clang::CFGElement &element,
+                        llvm::BitVector &state) const override;
+
+private:
+  const TrackedVariables &variables;
+};
+
+/// \brief Forward problem: which tracked variables may still hold the
+/// undefined value of their declaration, that is which declarations without
+/// an initializer reach an element.
+class UninitializedProblem : public BitVectorProblem {
+public:
+  explicit UninitializedProblem(const TrackedVariables &variables)
+      : BitVectorProblem(Forward, Union, variables.size()),
+        variables(variables) {}
+
+  virtual void transfer(const clang::CFGElement &element,
+                        llvm::BitVector &state) const override;
+
+private:
+  const TrackedVariables &variables;
+};
+
+/// \brief Find the blocks of \c cfg reachable from its entry or from the
+/// handlers of its try blocks.
+/// \return Bits indexed by block ID.
+llvm::BitVector findReachableBlocks(const clang::CFG &cfg);
+}
+
+#endif
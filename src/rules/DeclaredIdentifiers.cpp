@@ -0,0 +1,227 @@
+//===-  DeclaredIdentifiers.cpp - Identifiers declared by a TU-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "DeclaredIdentifiers.h"
+#include "ScopeTrackingVisitor.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/DeclTemplate.h"
+#include "clang/Basic/SourceManager.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/Twine.h"
+#include "llvm/Support/StringSaver.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+char DeclaredIdentifiers::ID = 0;
+
+namespace {
+
+IdentifierKind getKind(const NamedDecl *decl) {
+  if (isa<TypedefNameDecl>(decl)) {
+    return IdentifierKind::Typedef;
+  }
+  if (isa<TagDecl>(decl)) {
+    return IdentifierKind::Tag;
+  }
+  if (isa<FieldDecl>(decl) || isa<IndirectFieldDecl>(decl) ||
+      isa<CXXMethodDecl>(decl)) {
+    return IdentifierKind::Member;
+  }
+  if (const VarDecl *var = dyn_cast<VarDecl>(decl)) {
+    return var->isStaticDataMember() ? IdentifierKind::Member
+                                     : IdentifierKind::Object;
+  }
+  if (isa<FunctionDecl>(decl)) {
+    return IdentifierKind::Function;
+  }
+  return IdentifierKind::Other;
+}
+
+IdentifierLinkage getLinkage(const NamedDecl *decl) {
+  switch (decl->getFormalLinkage()) {
+  case ExternalLinkage:
+    return IdentifierLinkage::External;
+  case InternalLinkage:
+  case UniqueExternalLinkage:
+    return IdentifierLinkage::Internal;
+  default:
+    return IdentifierLinkage::None;
+  }
+}
+
+/// \brief Records the declaration walk and the declared identifiers.
+class IdentifierCollector : public ScopeTrackingVisitor<IdentifierCollector> {
+public:
+  IdentifierCollector(const SourceManager &SM, llvm::BumpPtrAllocator &storage,
+                      std::vector<DeclarationEvent> &events,
+                      std::vector<IdentifierRecord> &records,
+                      std::vector<const NamedDecl *> &decls)
+      : SM(SM), strings(storage), events(events), records(records),
+        decls(decls) {}
+
+  void scopeEntered(const DeclContext *DC, bool isSemanticParent) {
+    events.push_back(DeclarationEvent{DeclarationEvent::ScopeEntered,
+                                      isSemanticParent, 0, DC, nullptr});
+    if (const NamedDecl *scopeDecl = dyn_cast<NamedDecl>(DC)) {
+      scopeNames.push_back(save(scopeDecl->getQualifiedNameAsString()));
+    } else {
+      // E.g. blocks: their names belong to the enclosing scope.
+      scopeNames.push_back(scopeNames.empty() ? StringRef()
+                                              : scopeNames.back());
+    }
+  }
+
+  void scopeLeft(const DeclContext *DC) {
+    events.push_back(DeclarationEvent{DeclarationEvent::ScopeLeft, false, 0,
+                                      DC, nullptr});
+    scopeNames.pop_back();
+  }
+
+  bool VisitNamedDecl(const NamedDecl *decl) {
+    const unsigned depth = getScopeDepth(decl);
+    events.push_back(DeclarationEvent{DeclarationEvent::Declared, false, depth,
+                                      nullptr, decl});
+
+    if (!decl->getIdentifier() || decl->isImplicit()) {
+      return true;
+    }
+    // Out-of-line definitions and friends are recorded with the declaration
+    // in their semantic scope.
+    if (decl->getDeclContext() != decl->getLexicalDeclContext()) {
+      return true;
+    }
+    // Templates are recorded along with their pattern. Labels and using
+    // declarations do not declare anything the rules are interested in.
+    if (isa<RedeclarableTemplateDecl>(decl) || isa<LabelDecl>(decl) ||
+        isa<UsingDecl>(decl) || isa<UsingShadowDecl>(decl)) {
+      return true;
+    }
+
+    // All the redeclarations of an entity share the location of the first
+    // one.
+    const SourceLocation loc =
+        SM.getExpansionLoc(decl->getCanonicalDecl()->getLocation());
+    if (loc.isInvalid() || SM.isInSystemHeader(loc)) {
+      return true;
+    }
+    const PresumedLoc presumedLoc = SM.getPresumedLoc(loc);
+    if (presumedLoc.isInvalid() || presumedLoc.getFilename()[0] == '<') {
+      return true;
+    }
+
+    IdentifierRecord record;
+    record.name = decl->getName();
+    record.scope = scopeNames[depth];
+    record.location =
+        save(llvm::Twine(getFileName(presumedLoc.getFilename())) + ":" +
+             llvm::Twine(presumedLoc.getLine()) + ":" +
+             llvm::Twine(presumedLoc.getColumn()));
+    record.kind = getKind(decl);
+    record.linkage = getLinkage(decl);
+    record.isStatic = false;
+    if (record.kind == IdentifierKind::Object) {
+      record.isStatic = cast<VarDecl>(decl)->hasGlobalStorage() &&
+                        record.linkage != IdentifierLinkage::External;
+    } else if (record.kind == IdentifierKind::Function) {
+      record.isStatic = record.linkage == IdentifierLinkage::Internal;
+    }
+    record.order = records.size();
+
+    records.push_back(record);
+    decls.push_back(decl);
+    return true;
+  }
+
+private:
+  const SourceManager &SM;
+  llvm::StringSaver strings;
+  std::vector<DeclarationEvent> &events;
+  std::vector<IdentifierRecord> &records;
+  std::vector<const NamedDecl *> &decls;
+  /// Qualified names of the entered scopes.
+  llvm::SmallVector<StringRef, 16> scopeNames;
+  /// Normalized names of the files seen so far.
+  llvm::StringMap<StringRef> fileNames;
+
+  StringRef save(const llvm::Twine &str) {
+    llvm::SmallString<128> buffer;
+    return strings.save(str.toStringRef(buffer));
+  }
+
+  StringRef getFileName(StringRef presumedFileName) {
+    StringRef &fileName = fileNames[presumedFileName];
+    if (fileName.empty()) {
+      fileName = save(normalizeFileName(presumedFileName));
+    }
+    return fileName;
+  }
+};
+}
+
+DeclaredIdentifiers::DeclaredIdentifiers(CompilerInstance &CI) : CI(CI) {}
+
+llvm::ArrayRef<DeclarationEvent> DeclaredIdentifiers::getEvents() {
+  collect();
+  return events;
+}
+
+llvm::ArrayRef<IdentifierRecord> DeclaredIdentifiers::getRecords() {
+  collect();
+  if (!isWritten) {
+    isWritten = true;
+    if (!getProjectDataDirectory().empty()) {
+      writeProjectData();
+    }
+  }
+  return records;
+}
+
+llvm::ArrayRef<IdentifierCollision> DeclaredIdentifiers::getCollisions() {
+  if (!areCollisionsFound) {
+    areCollisionsFound = true;
+    // The search reorders the records, work on a copy.
+    std::vector<IdentifierRecord> sortedRecords(getRecords().begin(),
+                                                getRecords().end());
+    findIdentifierCollisions(sortedRecords, collisions);
+  }
+  return collisions;
+}
+
+void DeclaredIdentifiers::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Declared identifiers: " << events.size() << " walk events, "
+     << records.size() << " records, "
+     << collisions.size() << " collisions\n";
+}
+
+void DeclaredIdentifiers::collect() {
+  if (isCollected) {
+    return;
+  }
+  isCollected = true;
+  ASTContext &context = CI.getASTContext();
+  IdentifierCollector collector(context.getSourceManager(), stringStorage,
+                                events, records, decls);
+  collector.TraverseDecl(context.getTranslationUnitDecl());
+}
+
+void DeclaredIdentifiers::writeProjectData() {
+  std::unique_ptr<llvm::raw_fd_ostream> OS =
+      openProjectDataFile(CI, ".misra-ids");
+  if (!OS) {
+    return;
+  }
+  for (const IdentifierRecord &record : records) {
+    writeIdentifierRecord(*OS, record);
+  }
+}
+}
@@ -0,0 +1,109 @@
+//===-  DeclaredIdentifiers.h - Identifiers declared by a TU---------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef DECLARED_IDENTIFIERS_H
+#define DECLARED_IDENTIFIERS_H
+
+#include "misracpp2008.h"
+#include "project/IdentifierRecords.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/Support/Allocator.h"
+#include <cstdint>
+#include <vector>
+
+namespace clang {
+class DeclContext;
+class NamedDecl;
+}
+
+namespace misracpp2008 {
+
+/// \brief Step of the declaration walk of a translation unit.
+struct DeclarationEvent {
+  enum Kind : uint8_t { ScopeEntered, ScopeLeft, Declared };
+
+  Kind kind;
+  /// For ScopeEntered: whether \c scope is entered on behalf of an
+  /// out-of-line definition, see ScopeTrackingVisitor::scopeEntered().
+  bool isSemanticParent;
+  /// For Declared: depth of the scope \c decl has been declared in.
+  unsigned depth;
+  const clang::DeclContext *scope; ///< For ScopeEntered and ScopeLeft.
+  const clang::NamedDecl *decl;    ///< For Declared.
+};
+
+/// \brief Shared analysis walking the declarations of the translation unit
+/// once for all the identifier rules 2-10-1 to 2-10-6.
+///
+/// The walk is kept as a sequence of events, which the checkers of rules
+/// 2-10-1 and 2-10-2 replay instead of traversing the AST themselves. The
+/// identifiers declared are additionally collected as records, the input of
+/// the uniqueness rules 2-10-3 to 2-10-6.
+///
+/// Declarations in system headers are not recorded. If the user asked for
+/// project data, the records are additionally written to a file, to be merged
+/// with the ones of the other translation units by misracpp2008-merge.
+class DeclaredIdentifiers : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit DeclaredIdentifiers(clang::CompilerInstance &CI);
+
+  /// \brief Replay the declaration walk to \c visitor. Like a
+  /// ScopeTrackingVisitor, it gets notified by scopeEntered() and
+  /// scopeLeft(), and by <tt>declared(const NamedDecl *, unsigned depth)</tt>
+  /// for every named declaration, system headers included.
+  template <typename Visitor> void replay(Visitor &visitor) {
+    for (const DeclarationEvent &event : getEvents()) {
+      switch (event.kind) {
+      case DeclarationEvent::ScopeEntered:
+        visitor.scopeEntered(event.scope, event.isSemanticParent);
+        break;
+      case DeclarationEvent::ScopeLeft:
+        visitor.scopeLeft(event.scope);
+        break;
+      case DeclarationEvent::Declared:
+        visitor.declared(event.decl, event.depth);
+        break;
+      }
+    }
+  }
+
+  /// \brief Events of the declaration walk in the order of the traversal.
+  llvm::ArrayRef<DeclarationEvent> getEvents();
+
+  /// \brief Records of the declared identifiers in the order of their
+  /// declaration. The order of a record is its index.
+  llvm::ArrayRef<IdentifierRecord> getRecords();
+
+  /// \brief Declaration a record has been created for.
+  const clang::NamedDecl *getDecl(const IdentifierRecord &record) const {
+    return decls[record.order];
+  }
+
+  /// \brief Identifiers of this translation unit being reused against rules
+  /// 2-10-3, 2-10-4 and 2-10-5.
+  llvm::ArrayRef<IdentifierCollision> getCollisions();
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  bool isCollected = false;
+  bool isWritten = false;
+  bool areCollisionsFound = false;
+  llvm::BumpPtrAllocator stringStorage; ///< Names, scopes and locations.
+  std::vector<DeclarationEvent> events;
+  std::vector<IdentifierRecord> records;
+  std::vector<const clang::NamedDecl *> decls;
+  std::vector<IdentifierCollision> collisions;
+
+  void collect();
+  void writeProjectData();
+};
+}
+
+#endif
@@ -0,0 +1,52 @@
+//===-  EvaluationCache.cpp - Compile time values of expressions-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "EvaluationCache.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Expr.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/Support/raw_ostream.h"
+#include <utility>
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char EvaluationCache::ID = 0;
+
+EvaluationCache::EvaluationCache(CompilerInstance &CI) : CI(CI) {}
+
+const APValue *EvaluationCache::evaluate(const Expr *expr,
+                                         bool allowSideEffects) {
+  ++lookupCount;
+  auto it = results.find(expr);
+  if (it != results.end()) {
+    ++hitCount;
+  } else {
+    Result result = {nullptr, false};
+    Expr::EvalResult evalResult;
+    if (!expr->isValueDependent() &&
+        expr->EvaluateAsRValue(evalResult, CI.getASTContext())) {
+      values.push_back(std::move(evalResult.Val));
+      result.value = &values.back();
+      result.hasSideEffects = evalResult.HasSideEffects;
+    }
+    it = results.insert(std::make_pair(expr, result)).first;
+  }
+
+  if (it->second.hasSideEffects && !allowSideEffects) {
+    return nullptr;
+  }
+  return it->second.value;
+}
+
+void EvaluationCache::printStatistics(llvm::raw_ostream &OS) const {
+  const unsigned hitRate = lookupCount ? hitCount * 100 / lookupCount : 0;
+  OS << "Constant evaluations: " << lookupCount << " lookups, " << hitCount
+     << " hits (" << hitRate << "%), " << values.size() << " constants\n";
+}
+}
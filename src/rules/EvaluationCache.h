@@ -0,0 +1,57 @@
+//===-  EvaluationCache.h - Compile time values of expressions-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef EVALUATION_CACHE_H
+#define EVALUATION_CACHE_H
+
+#include "misracpp2008.h"
+#include "clang/AST/APValue.h"
+#include "llvm/ADT/DenseMap.h"
+#include <deque>
+
+namespace clang {
+class Expr;
+}
+
+namespace misracpp2008 {
+
+/// \brief Shared analysis evaluating expressions at compile time, at most once
+/// per expression and translation unit.
+///
+/// Expressions which can not be evaluated are remembered as well, so asking
+/// again for a non-constant expression does not cost another evaluation.
+/// Checkers use it through RuleCheckerASTContext::evaluateConstant().
+class EvaluationCache : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit EvaluationCache(clang::CompilerInstance &CI);
+
+  /// \brief Evaluate \c expr as an rvalue.
+  /// \param expr Expression to evaluate.
+  /// \param allowSideEffects Also accept expressions with side effects.
+  /// \return The value of \c expr, or nullptr if it is no constant.
+  const clang::APValue *evaluate(const clang::Expr *expr,
+                                 bool allowSideEffects);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  struct Result {
+    const clang::APValue *value; ///< Null for non-constant expressions.
+    bool hasSideEffects;
+  };
+
+  clang::CompilerInstance &CI;
+  llvm::DenseMap<const clang::Expr *, Result> results;
+  /// Values of the constant expressions, a deque keeps them in place.
+  std::deque<clang::APValue> values;
+  unsigned lookupCount = 0;
+  unsigned hitCount = 0;
+};
+}
+
+#endif
@@ -0,0 +1,319 @@
+//===-  ExceptionSummaries.cpp - Exceptions leaving the functions----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ExceptionSummaries.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char ExceptionSummaries::ID = 0;
+
+namespace {
+
+QualType getUnqualifiedCanonicalType(QualType type) {
+  return type.getNonReferenceType().getCanonicalType().getUnqualifiedType();
+}
+
+/// \brief Builds the summary of a function by walking its body once, with
+/// the try blocks enclosing the current statement at hand. If \c callees is
+/// given, the functions called are collected instead of asking for their
+/// summaries.
+class SummaryBuilder {
+public:
+  SummaryBuilder(ExceptionSummaries &summaries, const ASTContext &context,
+                 ExceptionSummary &summary,
+                 std::vector<const FunctionDecl *> *callees = nullptr)
+      : summaries(summaries), context(context), summary(summary),
+        callees(callees) {}
+
+  void build(const FunctionDecl &definition) {
+    if (const CXXConstructorDecl *ctor =
+            dyn_cast<CXXConstructorDecl>(&definition)) {
+      for (const CXXCtorInitializer *init : ctor->inits()) {
+        visit(init->getInit());
+      }
+    }
+
+    // The handlers of the function-try-block of a constructor or destructor
+    // rethrow when reaching their end, so the exceptions they catch leave
+    // the function nevertheless.
+    const CXXTryStmt *functionTry = dyn_cast<CXXTryStmt>(definition.getBody());
+    if (functionTry != nullptr && (isa<CXXConstructorDecl>(definition) ||
+                                   isa<CXXDestructorDecl>(definition))) {
+      visit(functionTry->getTryBlock());
+      visitHandlers(*functionTry);
+      return;
+    }
+    visit(definition.getBody());
+  }
+
+private:
+  ExceptionSummaries &summaries;
+  const ASTContext &context;
+  ExceptionSummary &summary;
+  std::vector<const FunctionDecl *> *callees;
+  std::vector<const CXXTryStmt *> tries;
+  /// Innermost handler the current statement is in.
+  const CXXCatchStmt *handler = nullptr;
+  /// Throw expression the operand of which contains the current statement.
+  const CXXThrowExpr *throwExpr = nullptr;
+
+  void visit(const Stmt *stmt) {
+    if (stmt == nullptr) {
+      return;
+    }
+    if (const CXXTryStmt *tryStmt = dyn_cast<CXXTryStmt>(stmt)) {
+      tries.push_back(tryStmt);
+      visit(tryStmt->getTryBlock());
+      tries.pop_back();
+      visitHandlers(*tryStmt);
+      return;
+    }
+    if (const CXXThrowExpr *throwStmt = dyn_cast<CXXThrowExpr>(stmt)) {
+      visitThrow(*throwStmt);
+      return;
+    }
+    if (const LambdaExpr *lambda = dyn_cast<LambdaExpr>(stmt)) {
+      // The body is the one of the call operator, summarized on its own.
+      for (const Expr *init : lambda->capture_inits()) {
+        visit(init);
+      }
+      return;
+    }
+
+    for (const Stmt *child : stmt->children()) {
+      visit(child);
+    }
+
+    if (const CallExpr *call = dyn_cast<CallExpr>(stmt)) {
+      raiseFrom(call->getDirectCallee(), call);
+    } else if (const CXXConstructExpr *construct =
+                   dyn_cast<CXXConstructExpr>(stmt)) {
+      raiseFrom(construct->getConstructor(), construct);
+    } else if (const CXXDeleteExpr *deleteExpr =
+                   dyn_cast<CXXDeleteExpr>(stmt)) {
+      raiseFrom(getDestructor(deleteExpr->getDestroyedType()), deleteExpr);
+    } else if (const DeclStmt *declStmt = dyn_cast<DeclStmt>(stmt)) {
+      for (const Decl *decl : declStmt->decls()) {
+        const VarDecl *var = dyn_cast<VarDecl>(decl);
+        if (var != nullptr && var->hasLocalStorage()) {
+          raiseFrom(getDestructor(var->getType()), declStmt);
+        }
+      }
+    }
+  }
+
+  void visitHandlers(const CXXTryStmt &tryStmt) {
+    const CXXCatchStmt *outerHandler = handler;
+    for (unsigned i = 0, e = tryStmt.getNumHandlers(); i != e; ++i) {
+      handler = tryStmt.getHandler(i);
+      visit(handler->getHandlerBlock());
+    }
+    handler = outerHandler;
+  }
+
+  void visitThrow(const CXXThrowExpr &throwStmt) {
+    const Expr *operand = throwStmt.getSubExpr();
+    if (operand == nullptr) {
+      if (handler == nullptr) {
+        summary.rethrows.push_back(&throwStmt);
+        raise(QualType(), &throwStmt, &throwStmt);
+      } else {
+        raise(getCaughtType(*handler), &throwStmt, &throwStmt);
+      }
+      return;
+    }
+
+    const CXXThrowExpr *outerThrowExpr = throwExpr;
+    throwExpr = &throwStmt;
+    visit(operand);
+    throwExpr = outerThrowExpr;
+    raise(getUnqualifiedCanonicalType(
+              context.getExceptionObjectType(operand->getType())),
+          &throwStmt, &throwStmt);
+  }
+
+  void raiseFrom(const FunctionDecl *callee, const Stmt *site) {
+    if (callee == nullptr) {
+      return;
+    }
+    if (callees != nullptr) {
+      callees->push_back(callee);
+      return;
+    }
+    // The summary grows while it is iterated if the callee is the function
+    // being summarized.
+    const ExceptionSummary &calleeSummary = summaries.getSummary(callee);
+    for (size_t i = 0; i != calleeSummary.escaping.size(); ++i) {
+      const EscapingException exception = calleeSummary.escaping[i];
+      raise(exception.type, exception.origin, site);
+    }
+  }
+
+  void raise(QualType type, const CXXThrowExpr *origin, const Stmt *site) {
+    if (throwExpr != nullptr && (summary.throwingOperands.empty() ||
+                                 summary.throwingOperands.back() != site)) {
+      summary.throwingOperands.push_back(site);
+    }
+    for (auto tryStmt = tries.rbegin(), ie = tries.rend(); tryStmt != ie;
+         ++tryStmt) {
+      for (unsigned i = 0, e = (*tryStmt)->getNumHandlers(); i != e; ++i) {
+        if (ExceptionSummaries::isCaughtAs(
+                context, type, getCaughtType(*(*tryStmt)->getHandler(i)))) {
+          return;
+        }
+      }
+    }
+    for (const EscapingException &escaping : summary.escaping) {
+      if (escaping.type == type) {
+        return;
+      }
+    }
+    summary.escaping.push_back(EscapingException{type, origin, site});
+  }
+
+  static QualType getCaughtType(const CXXCatchStmt &catchStmt) {
+    return catchStmt.getExceptionDecl() == nullptr
+               ? QualType()
+               : getUnqualifiedCanonicalType(catchStmt.getCaughtType());
+  }
+
+  const FunctionDecl *getDestructor(QualType type) const {
+    const CXXRecordDecl *record =
+        context.getBaseElementType(type)->getAsCXXRecordDecl();
+    if (record == nullptr || !record->hasDefinition() ||
+        record->hasTrivialDestructor()) {
+      return nullptr;
+    }
+    return record->getDestructor();
+  }
+};
+}
+
+ExceptionSummaries::ExceptionSummaries(CompilerInstance &CI) : CI(CI) {}
+
+const ExceptionSummary &
+ExceptionSummaries::getSummary(const FunctionDecl *function) {
+  Entry &entry = entries[function->getCanonicalDecl()];
+  if (!entry.isStarted) {
+    summarizeCalleesFirst(function);
+  }
+  return entry.summary;
+}
+
+void ExceptionSummaries::summarizeCalleesFirst(const FunctionDecl *function) {
+  // Depth first over the call graph, with an explicit stack so that long
+  // call chains do not exhaust the native one. The functions on the stack
+  // when one of them is called again are part of a recursive cycle.
+  struct Frame {
+    const FunctionDecl *function;
+    std::vector<const FunctionDecl *> callees;
+    size_t nextCallee;
+  };
+  std::vector<Frame> stack;
+  auto push = [this, &stack](const FunctionDecl *function) {
+    entries[function->getCanonicalDecl()].isStarted = true;
+    stack.push_back(Frame{function, {}, 0});
+    const FunctionDecl *definition = nullptr;
+    if (function->hasBody(definition) && !definition->isDependentContext()) {
+      ExceptionSummary scratch;
+      SummaryBuilder(*this, CI.getASTContext(), scratch, &stack.back().callees)
+          .build(*definition);
+    }
+  };
+
+  push(function);
+  while (!stack.empty()) {
+    Frame &frame = stack.back();
+    if (frame.nextCallee != frame.callees.size()) {
+      const FunctionDecl *callee = frame.callees[frame.nextCallee++];
+      if (!entries[callee->getCanonicalDecl()].isStarted) {
+        push(callee);
+      }
+      continue;
+    }
+    const FunctionDecl *summarized = frame.function;
+    stack.pop_back();
+    summarize(summarized, entries[summarized->getCanonicalDecl()].summary);
+  }
+}
+
+void ExceptionSummaries::summarize(const FunctionDecl *function,
+                                   ExceptionSummary &summary) {
+  const FunctionDecl *definition = nullptr;
+  if (function->hasBody(definition)) {
+    if (!definition->isDependentContext()) {
+      ++analyzedCount;
+      SummaryBuilder(*this, CI.getASTContext(), summary).build(*definition);
+    }
+    return;
+  }
+
+  const FunctionProtoType *proto =
+      function->getType()->getAs<FunctionProtoType>();
+  if (proto != nullptr && proto->hasDynamicExceptionSpec()) {
+    for (QualType type : proto->exceptions()) {
+      summary.escaping.push_back(EscapingException{
+          getUnqualifiedCanonicalType(type), nullptr, nullptr});
+    }
+  }
+}
+
+bool ExceptionSummaries::isCaughtAs(const ASTContext &context, QualType thrown,
+                                    QualType caught) {
+  if (caught.isNull()) {
+    return true;
+  }
+  if (thrown.isNull()) {
+    return false;
+  }
+  if (context.hasSameType(thrown, caught)) {
+    return true;
+  }
+
+  // Pointers are converted to pointers to less qualified types, to bases
+  // and to void.
+  if (const PointerType *caughtPointer = caught->getAs<PointerType>()) {
+    if (thrown->isNullPtrType()) {
+      return true;
+    }
+    const PointerType *thrownPointer = thrown->getAs<PointerType>();
+    if (thrownPointer == nullptr) {
+      return false;
+    }
+    caught = caughtPointer->getPointeeType().getUnqualifiedType();
+    thrown = thrownPointer->getPointeeType().getUnqualifiedType();
+    if (context.hasSameType(thrown, caught) ||
+        (caught->isVoidType() && !thrown->isFunctionType())) {
+      return true;
+    }
+  }
+
+  const CXXRecordDecl *thrownClass = thrown->getAsCXXRecordDecl();
+  const CXXRecordDecl *caughtClass = caught->getAsCXXRecordDecl();
+  return thrownClass != nullptr && caughtClass != nullptr &&
+         thrownClass->hasDefinition() &&
+         thrownClass->isDerivedFrom(caughtClass);
+}
+
+void ExceptionSummaries::printStatistics(llvm::raw_ostream &OS) const {
+  unsigned escapingCount = 0;
+  for (const auto &entry : entries) {
+    escapingCount += entry.second.summary.escaping.size();
+  }
+  OS << "Exception summaries: " << entries.size() << " functions, "
+     << analyzedCount << " bodies analyzed, " << escapingCount
+     << " escaping exceptions\n";
+}
+}
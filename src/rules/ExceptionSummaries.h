@@ -0,0 +1,103 @@
+//===-  ExceptionSummaries.h - Exceptions leaving the functions------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef EXCEPTION_SUMMARIES_H
+#define EXCEPTION_SUMMARIES_H
+
+#include "misracpp2008.h"
+#include "clang/AST/Type.h"
+#include <map>
+#include <vector>
+
+namespace clang {
+class ASTContext;
+class CXXThrowExpr;
+class FunctionDecl;
+class Stmt;
+}
+
+namespace misracpp2008 {
+
+/// \brief An exception which may leave a function.
+struct EscapingException {
+  /// Unqualified canonical type of the exception object, null if unknown,
+  /// e.g. for an exception rethrown by a catch-all handler.
+  clang::QualType type;
+  /// The throw expression raising the exception, nullptr if it is not
+  /// visible, e.g. for the exceptions listed by the exception specification
+  /// of a function defined elsewhere.
+  const clang::CXXThrowExpr *origin;
+  /// The statement of the function the exception leaves through: a throw
+  /// expression, a call, or the declaration of a variable the destructor of
+  /// which throws.
+  const clang::Stmt *site;
+};
+
+/// \brief What a function does with exceptions.
+struct ExceptionSummary {
+  /// The exceptions which may leave the function, one per type.
+  std::vector<EscapingException> escaping;
+  /// Statements within the operand of a throw expression which may throw.
+  std::vector<const clang::Stmt *> throwingOperands;
+  /// Empty throw expressions outside of any handler of the function.
+  std::vector<const clang::CXXThrowExpr *> rethrows;
+};
+
+/// \brief Shared analysis summarizing the exceptions which may leave each
+/// function, for the exception handling rules of chapter 15.
+///
+/// A summary is computed on the first request for the function, from the
+/// throw expressions of its body which are not caught by an enclosing
+/// handler and from the summaries of the functions it calls, constructs or
+/// destroys. Every function is thus analyzed bottom up over the call graph,
+/// which is walked with an explicit stack so that deep call chains do not
+/// exhaust the native one: its body is walked once to find its callees and
+/// once to build its summary. Within a recursive cycle the summary of a
+/// function still on the stack is used as far as it is known. Functions
+/// defined elsewhere are assumed to throw the types of their exception
+/// specification, and nothing if they have none. Virtual calls are resolved
+/// to the function named.
+class ExceptionSummaries : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit ExceptionSummaries(clang::CompilerInstance &CI);
+
+  /// \brief Get the summary of \c function.
+  const ExceptionSummary &getSummary(const clang::FunctionDecl *function);
+
+  /// \brief Tell whether an exception of type \c thrown is caught by a
+  /// handler of type \c caught.
+  /// \param thrown Type of the exception, as in EscapingException.
+  /// \param caught Type of the handler, null for a catch-all handler.
+  static bool isCaughtAs(const clang::ASTContext &context,
+                         clang::QualType thrown, clang::QualType caught);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  struct Entry {
+    ExceptionSummary summary;
+    bool isStarted = false;
+  };
+
+  clang::CompilerInstance &CI;
+  /// Keyed by canonical declaration, a map keeps the summaries in place
+  /// while the ones of the callees get added.
+  std::map<const clang::FunctionDecl *, Entry> entries;
+  unsigned analyzedCount = 0;
+
+  /// \brief Summarize \c function and the functions it calls which are not
+  /// summarized yet, callees first.
+  void summarizeCalleesFirst(const clang::FunctionDecl *function);
+  /// \brief Build the summary of \c function, the ones of its callees being
+  /// known or part of a recursive cycle.
+  void summarize(const clang::FunctionDecl *function,
+                 ExceptionSummary &summary);
+};
+}
+
+#endif
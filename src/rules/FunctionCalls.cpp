@@ -0,0 +1,284 @@
+//===-  FunctionCalls.cpp - Calls made by a TU-----------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "FunctionCalls.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Attr.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/Mangle.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Basic/ABI.h"
+#include "clang/Basic/SourceManager.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/ADT/Twine.h"
+#include "llvm/Support/StringSaver.h"
+#include "llvm/Support/raw_ostream.h"
+#include <memory>
+
+using namespace clang;
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+char FunctionCalls::ID = 0;
+
+namespace {
+
+/// \brief Names functions the same way in all translation units.
+class FunctionKeys {
+public:
+  FunctionKeys(ASTContext &context, llvm::BumpPtrAllocator &storage)
+      : SM(context.getSourceManager()),
+        mangler(context.createMangleContext()), strings(storage) {}
+
+  StringRef getKey(const FunctionDecl *function) {
+    function = function->getCanonicalDecl();
+    StringRef &key = keys[function];
+    if (!key.empty()) {
+      return key;
+    }
+    llvm::SmallString<128> buffer;
+    llvm::raw_svector_ostream OS(buffer);
+    // Functions without external linkage may share their mangled name with
+    // functions of other files.
+    if (function->getFormalLinkage() != ExternalLinkage) {
+      OS << getFileName(function->getLocation()) << ':';
+    }
+    if (const CXXConstructorDecl *ctor =
+            dyn_cast<CXXConstructorDecl>(function)) {
+      mangler->mangleCXXCtor(ctor, Ctor_Complete, OS);
+    } else if (const CXXDestructorDecl *dtor =
+                   dyn_cast<CXXDestructorDecl>(function)) {
+      mangler->mangleCXXDtor(dtor, Dtor_Complete, OS);
+    } else if (mangler->shouldMangleDeclName(function)) {
+      mangler->mangleName(function, OS);
+    } else {
+      OS << function->getName();
+    }
+    key = save(OS.str());
+    return key;
+  }
+
+  StringRef getName(const FunctionDecl *function) {
+    function = function->getCanonicalDecl();
+    StringRef &name = names[function];
+    if (name.empty()) {
+      name = save(function->getQualifiedNameAsString());
+    }
+    return name;
+  }
+
+  StringRef getLocation(SourceLocation loc) {
+    const PresumedLoc presumedLoc = SM.getPresumedLoc(SM.getExpansionLoc(loc));
+    if (presumedLoc.isInvalid()) {
+      return StringRef();
+    }
+    return save(llvm::Twine(getFileName(presumedLoc.getFilename())) + ":" +
+                llvm::Twine(presumedLoc.getLine()) + ":" +
+                llvm::Twine(presumedLoc.getColumn()));
+  }
+
+private:
+  const SourceManager &SM;
+  std::unique_ptr<MangleContext> mangler;
+  llvm::StringSaver strings;
+  llvm::DenseMap<const FunctionDecl *, StringRef> keys;
+  llvm::DenseMap<const FunctionDecl *, StringRef> names;
+  /// Normalized names of the files seen so far.
+  llvm::StringMap<StringRef> fileNames;
+
+  StringRef save(const llvm::Twine &str) {
+    llvm::SmallString<128> buffer;
+    return strings.save(str.toStringRef(buffer));
+  }
+
+  StringRef getFileName(SourceLocation loc) {
+    const PresumedLoc presumedLoc = SM.getPresumedLoc(SM.getExpansionLoc(loc));
+    return presumedLoc.isValid() ? getFileName(presumedLoc.getFilename())
+                                 : StringRef();
+  }
+
+  StringRef getFileName(StringRef presumedFileName) {
+    StringRef &fileName = fileNames[presumedFileName];
+    if (fileName.empty()) {
+      fileName = save(normalizeFileName(presumedFileName));
+    }
+    return fileName;
+  }
+};
+
+/// \brief Collects the calls made by the body of a function. Calls made by
+/// lambdas are attributed to the enclosing function.
+class CallFinder : public RecursiveASTVisitor<CallFinder> {
+public:
+  CallFinder(FunctionKeys &keys, StringRef caller, CallGraphRecords &records,
+             std::vector<SourceLocation> &callLocs)
+      : keys(keys), caller(caller), records(records), callLocs(callLocs) {}
+
+  // Local classes get visited as functions of their own.
+  bool TraverseCXXRecordDecl(CXXRecordDecl *decl) { return true; }
+
+  bool VisitCallExpr(CallExpr *call) {
+    const FunctionDecl *callee = call->getDirectCallee();
+    if (callee == nullptr || callee->getBuiltinID() != 0) {
+      return true;
+    }
+    addCall(callee, isVirtualCall(call, callee) ? CallKind::Virtual
+                                                : CallKind::Direct,
+            call->getExprLoc());
+    return true;
+  }
+
+  bool VisitCXXConstructExpr(CXXConstructExpr *construct) {
+    const CXXConstructorDecl *ctor = construct->getConstructor();
+    if (!ctor->isTrivial()) {
+      addCall(ctor, CallKind::Direct, construct->getExprLoc());
+    }
+    return true;
+  }
+
+private:
+  FunctionKeys &keys;
+  StringRef caller;
+  CallGraphRecords &records;
+  std::vector<SourceLocation> &callLocs;
+
+  /// \brief Tell whether the call is dispatched at run time. Qualified calls
+  /// and calls of final functions are not.
+  static bool isVirtualCall(const CallExpr *call, const FunctionDecl *callee) {
+    const CXXMethodDecl *method = dyn_cast<CXXMethodDecl>(callee);
+    if (method == nullptr || !method->isVirtual() ||
+        method->hasAttr<FinalAttr>() ||
+        method->getParent()->hasAttr<FinalAttr>()) {
+      return false;
+    }
+    const MemberExpr *member =
+        dyn_cast<MemberExpr>(call->getCallee()->IgnoreParenImpCasts());
+    return member == nullptr || !member->hasQualifier();
+  }
+
+  void addCall(const FunctionDecl *callee, CallKind kind, SourceLocation loc) {
+    CallRecord record;
+    record.caller = caller;
+    record.callee = keys.getKey(callee);
+    record.calleeName = keys.getName(callee);
+    record.location = keys.getLocation(loc);
+    record.kind = kind;
+    record.order = records.calls.size();
+    records.calls.push_back(record);
+    callLocs.push_back(loc);
+  }
+};
+
+/// \brief Collects the calls of all the functions defined outside of system
+/// headers, including the instantiations of templates.
+class FunctionCollector : public RecursiveASTVisitor<FunctionCollector> {
+public:
+  FunctionCollector(ASTContext &context, FunctionKeys &keys,
+                    CallGraphRecords &records,
+                    std::vector<SourceLocation> &callLocs)
+      : SM(context.getSourceManager()), keys(keys), records(records),
+        callLocs(callLocs) {}
+
+  bool shouldVisitTemplateInstantiations() const { return true; }
+
+  bool VisitFunctionDecl(FunctionDecl *function) {
+    if (!isRecorded(function)) {
+      return true;
+    }
+    if (const CXXMethodDecl *method = dyn_cast<CXXMethodDecl>(function)) {
+      if (method->isCanonicalDecl()) {
+        for (auto it = method->begin_overridden_methods(),
+                  ie = method->end_overridden_methods();
+             it != ie; ++it) {
+          records.overrides.push_back(
+              OverrideRecord{keys.getKey(*it), keys.getKey(method)});
+        }
+      }
+    }
+    if (!function->doesThisDeclarationHaveABody()) {
+      return true;
+    }
+
+    CallFinder finder(keys, keys.getKey(function), records, callLocs);
+    if (const CXXConstructorDecl *ctor =
+            dyn_cast<CXXConstructorDecl>(function)) {
+      for (const CXXCtorInitializer *init : ctor->inits()) {
+        finder.TraverseStmt(init->getInit());
+      }
+    }
+    finder.TraverseStmt(function->getBody());
+    return true;
+  }
+
+private:
+  const SourceManager &SM;
+  FunctionKeys &keys;
+  CallGraphRecords &records;
+  std::vector<SourceLocation> &callLocs;
+
+  bool isRecorded(const FunctionDecl *function) const {
+    if (function->isDependentContext() || function->isImplicit()) {
+      return false;
+    }
+    const SourceLocation loc = SM.getExpansionLoc(function->getLocation());
+    return loc.isValid() && !SM.isInSystemHeader(loc);
+  }
+};
+}
+
+FunctionCalls::FunctionCalls(CompilerInstance &CI) : CI(CI) {}
+
+const CallGraphRecords &FunctionCalls::getRecords() {
+  if (!isCollected) {
+    isCollected = true;
+    collect();
+    if (!getProjectDataDirectory().empty()) {
+      writeProjectData();
+    }
+  }
+  return records;
+}
+
+llvm::ArrayRef<RecursiveCycle> FunctionCalls::getCycles() {
+  if (!areCyclesFound) {
+    areCyclesFound = true;
+    findRecursiveCycles(getRecords(), cycles);
+  }
+  return cycles;
+}
+
+void FunctionCalls::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Function calls: " << records.calls.size() << " calls, "
+     << records.overrides.size() << " overrides, " << cycles.size()
+     << " recursive cycles\n";
+}
+
+void FunctionCalls::collect() {
+  ASTContext &context = CI.getASTContext();
+  FunctionKeys keys(context, stringStorage);
+  FunctionCollector collector(context, keys, records, callLocs);
+  collector.TraverseDecl(context.getTranslationUnitDecl());
+}
+
+void FunctionCalls::writeProjectData() {
+  std::unique_ptr<llvm::raw_fd_ostream> OS =
+      openProjectDataFile(CI, ".misra-calls");
+  if (!OS) {
+    return;
+  }
+  for (const CallRecord &record : records.calls) {
+    writeCallRecord(*OS, record);
+  }
+  for (const OverrideRecord &record : records.overrides) {
+    writeOverrideRecord(*OS, record);
+  }
+}
+}
@@ -0,0 +1,62 @@
+//===-  FunctionCalls.h - Calls made by a TU-------------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef FUNCTION_CALLS_H
+#define FUNCTION_CALLS_H
+
+#include "misracpp2008.h"
+#include "project/CallGraphRecords.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/Support/Allocator.h"
+#include <vector>
+
+namespace misracpp2008 {
+
+/// \brief Shared analysis collecting the calls made by the functions of the
+/// translation unit and the overriding relations between its virtual
+/// functions, the input of the recursion rule 7-5-4.
+///
+/// Functions are keyed by their mangled names, prefixed by their file for
+/// functions without external linkage. Functions defined in system headers
+/// are not recorded as callers. If the user asked for project data, the
+/// records are additionally written to a file, to be merged with the ones of
+/// the other translation units by misracpp2008-merge.
+class FunctionCalls : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit FunctionCalls(clang::CompilerInstance &CI);
+
+  /// \brief Records of the calls and overrides. The order of a call record
+  /// is its index.
+  const CallGraphRecords &getRecords();
+
+  /// \brief Location of the call a record has been created for.
+  clang::SourceLocation getLocation(const CallRecord &record) const {
+    return callLocs[record.order];
+  }
+
+  /// \brief Cycles of calls within this translation unit.
+  llvm::ArrayRef<RecursiveCycle> getCycles();
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  bool isCollected = false;
+  bool areCyclesFound = false;
+  llvm::BumpPtrAllocator stringStorage; ///< Keys, names and locations.
+  CallGraphRecords records;
+  std::vector<clang::SourceLocation> callLocs;
+  std::vector<RecursiveCycle> cycles;
+
+  void collect();
+  void writeProjectData();
+};
+}
+
+#endif
@@ -0,0 +1,45 @@
+//===-  IdentifierCollisionChecker.h - Helper class -----------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef IDENTIFIER_COLLISION_CHECKER_H
+#define IDENTIFIER_COLLISION_CHECKER_H
+
+#include "DeclaredIdentifiers.h"
+#include "clang/AST/Decl.h"
+#include "clang/Basic/Diagnostic.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+/// \brief Auxiliary for the checkers of the identifier uniqueness rules 2-10-3,
+/// 2-10-4 and 2-10-5. Reports the collisions found within the translation
+/// unit, the ones between translation units are found by misracpp2008-merge.
+class IdentifierCollisionChecker : public RuleCheckerASTContext {
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    DeclaredIdentifiers &identifiers =
+        getSharedAnalysis<DeclaredIdentifiers>();
+    for (const IdentifierCollision &collision : identifiers.getCollisions()) {
+      if (name != collision.rule) {
+        continue;
+      }
+      const clang::NamedDecl *offendingDecl =
+          identifiers.getDecl(collision.offending);
+      if (doIgnore(offendingDecl->getLocation())) {
+        continue;
+      }
+      reportError(offendingDecl->getLocation());
+      report(identifiers.getDecl(collision.previous)->getLocation(),
+             "Previous occurence of identifier '%0'",
+             clang::DiagnosticsEngine::Note)
+          << collision.previous.name;
+    }
+  }
+};
+}
+
+#endif
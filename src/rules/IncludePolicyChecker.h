@@ -0,0 +1,46 @@
+//===-  IncludePolicyChecker.h - Helper class------------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef INCLUDE_POLICY_CHECKER_H
+#define INCLUDE_POLICY_CHECKER_H
+
+#include "IncludeTracker.h"
+#include "clang/Lex/PPCallbacks.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+/// \brief Auxiliary for easier implementation of a checker which checks the
+/// \#include directives. The directives are recorded by the IncludeTracker,
+/// subclasses check the records.
+class IncludePolicyChecker : public RuleCheckerPPCallback {
+public:
+  virtual void InclusionDirective(SourceLocation HashLoc,
+                                  const Token &IncludeTok, StringRef FileName,
+                                  bool IsAngled, CharSourceRange FilenameRange,
+                                  const FileEntry *File, StringRef SearchPath,
+                                  StringRef RelativePath,
+                                  const Module *Imported) override final {
+    const InclusionRecord &inclusion =
+        getSharedAnalysis<IncludeTracker>().record(HashLoc, FileName, IsAngled,
+                                                   FilenameRange, File);
+    if (doIgnore(HashLoc)) {
+      return;
+    }
+    checkInclusion(inclusion);
+  }
+
+protected:
+  /// \brief To be implemented by the subclass: Check a directive which is not
+  /// to be ignored.
+  /// \param inclusion Record of the directive.
+  virtual void checkInclusion(const InclusionRecord &inclusion) {}
+};
+}
+
+#endif
@@ -0,0 +1,146 @@
+//===-  IncludeTracker.cpp - Inclusions of a translation unit--------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IncludeTracker.h"
+#include "clang/Basic/SourceManager.h"
+#include "clang/Basic/TokenKinds.h"
+#include "clang/Lex/HeaderSearch.h"
+#include "clang/Lex/Lexer.h"
+#include "clang/Lex/Preprocessor.h"
+#include "clang/Lex/Token.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/StringSaver.h"
+#include "llvm/Support/raw_ostream.h"
+#include <limits>
+
+using namespace clang;
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+char IncludeTracker::ID = 0;
+
+IncludeTracker::IncludeTracker(CompilerInstance &CI) : CI(CI) {}
+
+const InclusionRecord &IncludeTracker::record(SourceLocation hashLoc,
+                                              StringRef fileName,
+                                              bool isAngled,
+                                              CharSourceRange filenameRange,
+                                              const FileEntry *file) {
+  if (!inclusions.empty() && inclusions.back().hashLoc == hashLoc) {
+    return inclusions.back();
+  }
+
+  const SourceManager &SM = CI.getSourceManager();
+  llvm::StringSaver saver(fileNames);
+  InclusionRecord inclusion{hashLoc, saver.save(fileName), file,
+                            getBanningRule(fileName), 0};
+  if (isAngled) {
+    inclusion.flags |= InclusionRecord::IsAngled;
+  }
+  if (filenameRange.getBegin().isMacroID()) {
+    inclusion.flags |= InclusionRecord::IsMacroExpanded;
+  } else if (hasTrailingTokens(filenameRange.getEnd())) {
+    inclusion.flags |= InclusionRecord::HasTrailingTokens;
+  }
+  const std::pair<FileID, unsigned> decomposedLoc =
+      SM.getDecomposedLoc(hashLoc);
+  if (decomposedLoc.second > getFirstCodeOffset(decomposedLoc.first)) {
+    inclusion.flags |= InclusionRecord::FollowsCode;
+  }
+  inclusions.push_back(inclusion);
+  return inclusions.back();
+}
+
+bool IncludeTracker::isGuarded(const FileEntry *file) const {
+  // HeaderSearch::isFileMultipleIncludeGuarded() also accepts #pragma once
+  // and #import, which are no include guards in the sense of rule 16-2-3.
+  // Only a controlling macro found by the multiple include optimization is.
+  HeaderSearch &headerSearch = CI.getPreprocessor().getHeaderSearchInfo();
+  const HeaderFileInfo &fileInfo = headerSearch.getFileInfo(file);
+  return fileInfo.ControllingMacro || fileInfo.ControllingMacroID;
+}
+
+StringRef IncludeTracker::getBanningRule(StringRef fileName) {
+  // The cases are tried in turn, each comparing the characters only if the
+  // length matches.
+  return llvm::StringSwitch<StringRef>(fileName)
+      .Cases("assert.h", "ctype.h", "errno.h", "fenv.h", "float.h", "18-0-1")
+      .Cases("inttypes.h", "iso646.h", "limits.h", "locale.h", "math.h",
+             "18-0-1")
+      .Cases("setjmp.h", "signal.h", "stdarg.h", "stdbool.h", "stddef.h",
+             "18-0-1")
+      .Cases("stdint.h", "stdlib.h", "string.h", "tgmath.h", "time.h",
+             "18-0-1")
+      .Cases("uchar.h", "wchar.h", "wctype.h", "18-0-1")
+      .Case("ctime", "18-0-4")
+      .Case("csignal", "18-7-1")
+      .Case("cstdio", "27-0-1")
+      .Default(StringRef());
+}
+
+void IncludeTracker::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Include tracker: " << inclusions.size() << " inclusions, "
+     << firstCodeOffsets.size() << " files scanned for code\n";
+}
+
+unsigned IncludeTracker::getFirstCodeOffset(FileID FID) {
+  auto it = firstCodeOffsets.find(FID);
+  if (it != firstCodeOffsets.end()) {
+    return it->second;
+  }
+
+  unsigned firstCodeOffset = std::numeric_limits<unsigned>::max();
+  const SourceManager &SM = CI.getSourceManager();
+  bool invalid = false;
+  const llvm::MemoryBuffer *buffer = SM.getBuffer(FID, &invalid);
+  if (!invalid) {
+    Lexer lexer(FID, buffer, SM, CI.getLangOpts());
+    lexer.SetCommentRetentionState(false);
+    Token token;
+    bool isDirective = false;
+    while (true) {
+      lexer.LexFromRawLexer(token);
+      if (token.is(tok::eof)) {
+        break;
+      }
+      if (token.isAtStartOfLine()) {
+        isDirective = token.is(tok::hash);
+      }
+      if (!isDirective) {
+        firstCodeOffset = SM.getFileOffset(token.getLocation());
+        break;
+      }
+    }
+  }
+  firstCodeOffsets[FID] = firstCodeOffset;
+  return firstCodeOffset;
+}
+
+bool IncludeTracker::hasTrailingTokens(SourceLocation filenameEnd) const {
+  const SourceManager &SM = CI.getSourceManager();
+  const std::pair<FileID, unsigned> decomposedEnd =
+      SM.getDecomposedLoc(filenameEnd);
+  bool invalid = false;
+  const StringRef text = SM.getBufferData(decomposedEnd.first, &invalid);
+  if (invalid) {
+    return false;
+  }
+
+  // A raw lexer started in the middle of a line takes its first token to be
+  // at the start of a line, so compare the line numbers instead.
+  Lexer lexer(SM.getLocForStartOfFile(decomposedEnd.first), CI.getLangOpts(),
+              text.begin(), text.begin() + decomposedEnd.second, text.end());
+  Token token;
+  lexer.LexFromRawLexer(token);
+  return token.isNot(tok::eof) &&
+         SM.getLineNumber(decomposedEnd.first,
+                          SM.getFileOffset(token.getLocation())) ==
+             SM.getLineNumber(decomposedEnd.first, decomposedEnd.second);
+}
+}
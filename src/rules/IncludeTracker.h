@@ -0,0 +1,96 @@
+//===-  IncludeTracker.h - Inclusions of a translation unit----------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef INCLUDE_TRACKER_H
+#define INCLUDE_TRACKER_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Allocator.h"
+#include <cstdint>
+#include <vector>
+
+namespace clang {
+class FileEntry;
+}
+
+namespace misracpp2008 {
+
+/// \brief What the include related rules need to know about an \#include
+/// directive.
+struct InclusionRecord {
+  enum Flag : uint8_t {
+    IsAngled = 1 << 0,
+    /// The header name is the result of a macro expansion.
+    IsMacroExpanded = 1 << 1,
+    /// Tokens follow the header name on the line of the directive.
+    HasTrailingTokens = 1 << 2,
+    /// Preceded by a token of its file which is not part of a directive.
+    FollowsCode = 1 << 3
+  };
+
+  clang::SourceLocation hashLoc;
+  llvm::StringRef fileName;    ///< As spelled, without the delimiters.
+  const clang::FileEntry *file; ///< nullptr if the header was not found.
+  llvm::StringRef banningRule; ///< Rule banning the header, empty if none.
+  uint8_t flags;
+
+  bool is(Flag flag) const { return (flags & flag) != 0; }
+};
+
+/// \brief Shared analysis recording each \#include directive of the
+/// translation unit once.
+///
+/// The preprocessor has no hook for shared analyses, so the include checkers
+/// pass on the directives they are told about. All of them are told about
+/// the same directive before the preprocessor moves on, so a directive just
+/// recorded does not need to be looked up.
+class IncludeTracker : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit IncludeTracker(clang::CompilerInstance &CI);
+
+  /// \brief Record an \#include directive, the arguments are the ones of
+  /// clang::PPCallbacks::InclusionDirective().
+  /// \return The record of the directive, valid until the next directive
+  /// gets recorded.
+  const InclusionRecord &record(clang::SourceLocation hashLoc,
+                                llvm::StringRef fileName, bool isAngled,
+                                clang::CharSourceRange filenameRange,
+                                const clang::FileEntry *file);
+
+  /// \brief The directives recorded so far, in the order of preprocessing.
+  llvm::ArrayRef<InclusionRecord> getInclusions() const { return inclusions; }
+
+  /// \brief Tell whether the multiple include optimization found \c file to
+  /// be protected by an \#ifndef / \#define include guard. \#pragma once
+  /// does not count. Only reliable for files which have been left by the
+  /// preprocessor.
+  bool isGuarded(const clang::FileEntry *file) const;
+
+  /// \brief Get the rule banning the header \c fileName.
+  /// \return Name of the rule, empty if the header is not banned.
+  static llvm::StringRef getBanningRule(llvm::StringRef fileName);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  std::vector<InclusionRecord> inclusions;
+  /// Offset of the first token not part of a directive, per including file.
+  llvm::DenseMap<clang::FileID, unsigned> firstCodeOffsets;
+  llvm::BumpPtrAllocator fileNames;
+
+  unsigned getFirstCodeOffset(clang::FileID FID);
+  bool hasTrailingTokens(clang::SourceLocation filenameEnd) const;
+};
+}
+
+#endif
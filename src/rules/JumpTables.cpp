@@ -0,0 +1,270 @@
+//===-  JumpTables.cpp - Jumps and their targets per function--------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "JumpTables.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char JumpTables::ID = 0;
+
+namespace {
+
+const unsigned NoInterval = ~0u;
+
+/// \brief Positions of the statements in a block, a try block or a handler.
+struct Interval {
+  unsigned begin;
+  unsigned end;
+
+  bool contains(unsigned position) const {
+    return begin <= position && position < end;
+  }
+};
+
+/// \brief A label or a case label, with the innermost block and the
+/// innermost try block or handler enclosing it.
+struct JumpTarget {
+  unsigned position;
+  unsigned block;
+  unsigned region;
+};
+
+struct GotoSite {
+  const GotoStmt *stmt;
+  unsigned position;
+};
+
+struct CaseSite {
+  const SwitchCase *label;
+  JumpTarget target;
+  unsigned switchPosition;
+};
+
+/// \brief The jump table of a function body.
+struct JumpTable {
+  std::vector<Interval> blocks;
+  /// Try blocks and handlers.
+  std::vector<Interval> regions;
+  llvm::DenseMap<const LabelDecl *, JumpTarget> labels;
+  std::vector<GotoSite> gotos;
+  std::vector<CaseSite> cases;
+  std::vector<const ReturnStmt *> returns;
+};
+
+/// \brief Builds the jump table of a function body in one walk.
+class TableBuilder {
+public:
+  explicit TableBuilder(JumpTable &table) : table(table) {}
+
+  void build(const Stmt *body) { walk(body); }
+
+private:
+  JumpTable &table;
+  unsigned position = 0;
+  unsigned block = NoInterval;
+  unsigned region = NoInterval;
+  std::vector<unsigned> switchPositions;
+
+  unsigned open(std::vector<Interval> &intervals) {
+    intervals.push_back(Interval{position, position});
+    return intervals.size() - 1;
+  }
+
+  void walkIn(std::vector<Interval> &intervals, unsigned &current,
+              const Stmt *stmt) {
+    const unsigned enclosing = current;
+    current = open(intervals);
+    const unsigned index = current;
+    walk(stmt);
+    intervals[index].end = position;
+    current = enclosing;
+  }
+
+  JumpTarget here(unsigned targetPosition) const {
+    return JumpTarget{targetPosition, block, region};
+  }
+
+  void walk(const Stmt *stmt) {
+    if (stmt == nullptr) {
+      return;
+    }
+    // Lambda bodies have tables of their own.
+    if (isa<LambdaExpr>(stmt)) {
+      return;
+    }
+
+    if (const CXXTryStmt *tryStmt = dyn_cast<CXXTryStmt>(stmt)) {
+      ++position;
+      walkIn(table.regions, region, tryStmt->getTryBlock());
+      for (unsigned i = 0, e = tryStmt->getNumHandlers(); i != e; ++i) {
+        walkIn(table.regions, region, tryStmt->getHandler(i));
+      }
+      return;
+    }
+    if (isa<CompoundStmt>(stmt)) {
+      const unsigned enclosing = block;
+      block = open(table.blocks);
+      const unsigned index = block;
+      ++position;
+      walkChildren(stmt);
+      table.blocks[index].end = position;
+      block = enclosing;
+      return;
+    }
+
+    const unsigned current = position++;
+    if (const LabelStmt *label = dyn_cast<LabelStmt>(stmt)) {
+      table.labels[label->getDecl()] = here(current);
+    } else if (const SwitchCase *label = dyn_cast<SwitchCase>(stmt)) {
+      if (!switchPositions.empty()) {
+        table.cases.push_back(
+            CaseSite{label, here(current), switchPositions.back()});
+      }
+    } else if (const GotoStmt *gotoStmt = dyn_cast<GotoStmt>(stmt)) {
+      table.gotos.push_back(GotoSite{gotoStmt, current});
+    } else if (const ReturnStmt *returnStmt = dyn_cast<ReturnStmt>(stmt)) {
+      table.returns.push_back(returnStmt);
+    } else if (isa<SwitchStmt>(stmt)) {
+      switchPositions.push_back(current);
+      walkChildren(stmt);
+      switchPositions.pop_back();
+      return;
+    }
+    walkChildren(stmt);
+  }
+
+  void walkChildren(const Stmt *stmt) {
+    for (const Stmt *child : stmt->children()) {
+      walk(child);
+    }
+  }
+};
+
+/// \brief The statement ending \c body, looking through the try block of a
+/// function-try-block.
+const Stmt *getLastStatement(const Stmt *body) {
+  if (const CXXTryStmt *tryStmt = dyn_cast<CXXTryStmt>(body)) {
+    body = tryStmt->getTryBlock();
+  }
+  const CompoundStmt *compound = dyn_cast<CompoundStmt>(body);
+  if (compound == nullptr || compound->body_empty()) {
+    return nullptr;
+  }
+  return compound->body_back();
+}
+
+void check(const JumpTable &table, const Stmt *body,
+           std::vector<JumpViolation> &violations) {
+  for (const GotoSite &site : table.gotos) {
+    const SourceLocation loc = site.stmt->getGotoLoc();
+    auto it = table.labels.find(site.stmt->getLabel());
+    if (it == table.labels.end()) {
+      continue;
+    }
+    const JumpTarget &target = it->second;
+    if (target.block != NoInterval &&
+        !table.blocks[target.block].contains(site.position)) {
+      violations.push_back(JumpViolation{"6-6-1", loc});
+    }
+    if (target.position < site.position) {
+      violations.push_back(JumpViolation{"6-6-2", loc});
+    }
+    if (target.region != NoInterval &&
+        !table.regions[target.region].contains(site.position)) {
+      violations.push_back(JumpViolation{"15-0-3", loc});
+    }
+  }
+
+  for (const CaseSite &site : table.cases) {
+    if (site.target.region != NoInterval &&
+        !table.regions[site.target.region].contains(site.switchPosition)) {
+      violations.push_back(
+          JumpViolation{"15-0-3", site.label->getKeywordLoc()});
+    }
+  }
+
+  // A single return is allowed as the last statement of the body.
+  const Stmt *last = getLastStatement(body);
+  for (const ReturnStmt *returnStmt : table.returns) {
+    if (returnStmt != last) {
+      violations.push_back(
+          JumpViolation{"6-6-5", returnStmt->getReturnLoc()});
+    }
+  }
+}
+
+class FunctionScanner : public RecursiveASTVisitor<FunctionScanner> {
+public:
+  FunctionScanner(std::vector<JumpViolation> &violations,
+                  unsigned &functionCount, unsigned &labelCount,
+                  unsigned &jumpCount)
+      : violations(violations), functionCount(functionCount),
+        labelCount(labelCount), jumpCount(jumpCount) {}
+
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (decl->doesThisDeclarationHaveABody()) {
+      scanBody(decl->getBody());
+    }
+    return true;
+  }
+
+  bool VisitLambdaExpr(LambdaExpr *expr) {
+    scanBody(expr->getBody());
+    return true;
+  }
+
+private:
+  std::vector<JumpViolation> &violations;
+  unsigned &functionCount;
+  unsigned &labelCount;
+  unsigned &jumpCount;
+
+  void scanBody(const Stmt *body) {
+    if (body == nullptr) {
+      return;
+    }
+    JumpTable table;
+    TableBuilder(table).build(body);
+    check(table, body, violations);
+    ++functionCount;
+    labelCount += table.labels.size();
+    jumpCount += table.gotos.size() + table.cases.size();
+  }
+};
+}
+
+JumpTables::JumpTables(CompilerInstance &CI) : CI(CI) {}
+
+llvm::ArrayRef<JumpViolation> JumpTables::getViolations() {
+  scan();
+  return violations;
+}
+
+void JumpTables::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Jump tables: " << functionCount << " functions, " << labelCount
+     << " labels, " << jumpCount << " jumps, " << violations.size()
+     << " violations\n";
+}
+
+void JumpTables::scan() {
+  if (isScanned) {
+    return;
+  }
+  isScanned = true;
+  FunctionScanner scanner(violations, functionCount, labelCount, jumpCount);
+  scanner.TraverseDecl(CI.getASTContext().getTranslationUnitDecl());
+}
+}
@@ -0,0 +1,57 @@
+//===-  JumpTables.h - Jumps and their targets per function----------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef JUMP_TABLES_H
+#define JUMP_TABLES_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include <vector>
+
+namespace misracpp2008 {
+
+/// \brief Violation of one of the jump rules 6-6-1, 6-6-2, 6-6-5 and 15-0-3.
+struct JumpViolation {
+  llvm::StringRef rule;
+  clang::SourceLocation loc;
+};
+
+/// \brief Shared analysis checking the jumps of all the functions of the
+/// translation unit.
+///
+/// The body of each function is walked once, numbering its statements in
+/// the order of the walk. The table of the function records the interval of
+/// numbers each block, try block and handler spans, the position of each
+/// label with its innermost block and try block or handler, and the goto,
+/// switch and return statements. The rules are then checked by comparing
+/// positions against intervals, and a goto finds its label by a hash lookup,
+/// so the cost per jump does not depend on the number of labels.
+class JumpTables : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit JumpTables(clang::CompilerInstance &CI);
+
+  /// \brief The violations of the jump rules, in the order of the functions.
+  llvm::ArrayRef<JumpViolation> getViolations();
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  bool isScanned = false;
+  std::vector<JumpViolation> violations;
+  unsigned functionCount = 0;
+  unsigned labelCount = 0;
+  unsigned jumpCount = 0;
+
+  void scan();
+};
+}
+
+#endif
@@ -0,0 +1,274 @@
+//===-  LexicalTokenTable.cpp - Literals, trigraphs and digraphs per file--===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "LexicalTokenTable.h"
+#include "clang/Basic/SourceManager.h"
+#include "clang/Basic/TokenKinds.h"
+#include "clang/Lex/Lexer.h"
+#include "clang/Lex/Token.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+
+using namespace clang;
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+char LexicalTokenTable::ID = 0;
+
+namespace {
+
+bool isOctalDigit(char c) { return c >= '0' && c <= '7'; }
+
+void findTrigraphs(StringRef text, std::vector<unsigned> &trigraphs) {
+  for (size_t pos = text.find("??"); pos != StringRef::npos;
+       pos = text.find("??", pos + 1)) {
+    if (pos + 2 < text.size() &&
+        StringRef("=/'()!<>-").find(text[pos + 2]) != StringRef::npos) {
+      trigraphs.push_back(pos);
+      pos += 2;
+    }
+  }
+}
+
+/// \brief Tell whether a punctuator token has been spelled as a digraph.
+/// Only the digraphs start with '<', ':' or '%', a trigraph spelling starts
+/// with '?' and is no digraph.
+bool isDigraph(const Token &token, char firstChar) {
+  switch (token.getKind()) {
+  case tok::l_square:
+  case tok::l_brace:
+    return firstChar == '<';
+  case tok::r_square:
+    return firstChar == ':';
+  case tok::r_brace:
+  case tok::hash:
+  case tok::hashhash:
+    return firstChar == '%';
+  default:
+    return false;
+  }
+}
+
+/// \brief Directives followed by something else than tokens to be checked.
+bool takesFreeText(StringRef directive) {
+  return llvm::StringSwitch<bool>(directive)
+      .Cases("include", "include_next", "import", true)
+      .Cases("error", "warning", "line", true)
+      .Default(false);
+}
+
+void classifyNumeric(StringRef spelling, LiteralToken &literal) {
+  const bool isHex = spelling.startswith("0x") || spelling.startswith("0X");
+  const bool isBinary =
+      spelling.startswith("0b") || spelling.startswith("0B");
+  const bool isFloating =
+      isHex ? spelling.find_first_of(".pP") != StringRef::npos
+            : !isBinary && spelling.find_first_of(".eE") != StringRef::npos;
+
+  // Hexadecimal digits do not include any of the suffix letters.
+  const StringRef suffixLetters = isFloating ? "fFlL" : "uUlL";
+  size_t digitsEnd = spelling.size();
+  while (digitsEnd > 0 &&
+         suffixLetters.find(spelling[digitsEnd - 1]) != StringRef::npos) {
+    --digitsEnd;
+  }
+  const StringRef digits = spelling.substr(0, digitsEnd);
+  const StringRef suffix = spelling.substr(digitsEnd);
+
+  if (isFloating) {
+    literal.flags |= LiteralToken::IsFloating;
+    literal.radix = isHex ? 16 : 10;
+  } else if (isHex) {
+    literal.radix = 16;
+  } else if (isBinary) {
+    literal.radix = 2;
+  } else if (digits.size() > 1 && digits[0] == '0') {
+    literal.radix = 8;
+    if (digits.find_first_not_of('0') != StringRef::npos) {
+      literal.flags |= LiteralToken::IsNonZeroOctal;
+    }
+  }
+
+  for (char c : suffix) {
+    if (c == 'U') {
+      literal.flags |= LiteralToken::HasUpperCaseUSuffix;
+    } else if (c == 'u' || c == 'l' || c == 'f') {
+      literal.flags |= LiteralToken::HasLowerCaseSuffix;
+    }
+  }
+}
+
+void classifyEscapes(StringRef body, LiteralToken &literal) {
+  for (size_t i = 0, e = body.size(); i < e; ++i) {
+    if (body[i] != '\\' || ++i == e) {
+      continue;
+    }
+    const char c = body[i];
+    if (isOctalDigit(c)) {
+      size_t length = 1;
+      while (length < 3 && i + length < e && isOctalDigit(body[i + length])) {
+        ++length;
+      }
+      if (length > 1 || c != '0') {
+        literal.flags |= LiteralToken::HasOctalEscape;
+      }
+      i += length - 1;
+    } else if (StringRef("ntvbrfa\\?'\"xuU\r\n").find(c) == StringRef::npos) {
+      // Besides the escape sequences of C++03 and universal character names
+      // a backslash may only be followed by a line splice.
+      literal.flags |= LiteralToken::HasNonStandardEscape;
+    }
+  }
+}
+
+void classifyQuoted(StringRef spelling, LiteralToken &literal) {
+  const size_t quote = spelling.find_first_of("'\"");
+  if (quote == StringRef::npos) {
+    return;
+  }
+  const StringRef prefix = spelling.substr(0, quote);
+  if (prefix.startswith("L")) {
+    literal.prefix = LiteralToken::WidePrefix;
+  } else if (prefix.startswith("u8")) {
+    literal.prefix = LiteralToken::UTF8Prefix;
+  } else if (prefix.startswith("u")) {
+    literal.prefix = LiteralToken::UTF16Prefix;
+  } else if (prefix.startswith("U")) {
+    literal.prefix = LiteralToken::UTF32Prefix;
+  }
+  if (prefix.endswith("R")) {
+    literal.flags |= LiteralToken::IsRaw;
+    return;
+  }
+
+  const size_t closingQuote = spelling.find_last_of(spelling[quote]);
+  if (closingQuote > quote) {
+    classifyEscapes(spelling.slice(quote + 1, closingQuote), literal);
+  }
+}
+}
+
+LexicalTokenTable::LexicalTokenTable(CompilerInstance &CI) : CI(CI) {}
+
+const LiteralToken *LexicalTokenTable::getLiteral(SourceLocation loc) {
+  const SourceManager &SM = CI.getSourceManager();
+  const std::pair<FileID, unsigned> decomposedLoc =
+      SM.getDecomposedLoc(SM.getSpellingLoc(loc));
+  const std::vector<LiteralToken> &literals =
+      getLexedFile(decomposedLoc.first).literals;
+  auto it = std::lower_bound(
+      literals.begin(), literals.end(), decomposedLoc.second,
+      [](const LiteralToken &literal, unsigned offset) {
+        return literal.offset < offset;
+      });
+  if (it == literals.end() || it->offset != decomposedLoc.second) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+const LexedFile &LexicalTokenTable::getLexedFile(FileID FID) {
+  auto it = files.find(FID);
+  if (it == files.end()) {
+    it = files.insert(std::make_pair(FID, LexedFile())).first;
+    lex(FID, it->second);
+  }
+  return it->second;
+}
+
+std::vector<FileID> LexicalTokenTable::getFiles() const {
+  const SourceManager &SM = CI.getSourceManager();
+  std::vector<FileID> fileIDs;
+  for (auto it = SM.fileinfo_begin(), ie = SM.fileinfo_end(); it != ie; ++it) {
+    const FileID FID = SM.translateFile(it->first);
+    if (FID.isValid()) {
+      fileIDs.push_back(FID);
+    }
+  }
+  std::sort(fileIDs.begin(), fileIDs.end());
+  return fileIDs;
+}
+
+void LexicalTokenTable::printStatistics(llvm::raw_ostream &OS) const {
+  size_t literalCount = 0;
+  for (const auto &file : files) {
+    literalCount += file.second.literals.size();
+  }
+  OS << "Lexical token table: " << files.size() << " files lexed, "
+     << literalCount << " literals\n";
+}
+
+void LexicalTokenTable::lex(FileID FID, LexedFile &file) const {
+  const SourceManager &SM = CI.getSourceManager();
+  bool invalid = false;
+  const llvm::MemoryBuffer *buffer = SM.getBuffer(FID, &invalid);
+  if (invalid) {
+    return;
+  }
+  const StringRef text = buffer->getBuffer();
+  findTrigraphs(text, file.trigraphs);
+
+  Lexer lexer(FID, buffer, SM, CI.getLangOpts());
+  lexer.SetCommentRetentionState(false);
+  llvm::SmallString<64> spellingBuffer;
+  Token token;
+  bool isDirectiveName = false;
+  bool isFreeText = false;
+  while (true) {
+    lexer.LexFromRawLexer(token);
+    if (token.is(tok::eof)) {
+      break;
+    }
+    if (token.isAtStartOfLine()) {
+      isFreeText = false;
+    }
+    if (isFreeText) {
+      continue;
+    }
+    if (isDirectiveName) {
+      isDirectiveName = false;
+      isFreeText = !token.isAtStartOfLine() &&
+                   token.is(tok::raw_identifier) &&
+                   takesFreeText(token.getRawIdentifier());
+    }
+
+    const unsigned offset = SM.getFileOffset(token.getLocation());
+    if (isDigraph(token, text[offset])) {
+      file.digraphs.push_back(offset);
+    }
+    if (token.is(tok::hash) && token.isAtStartOfLine()) {
+      isDirectiveName = true;
+      continue;
+    }
+
+    LiteralToken literal{offset, LiteralToken::Numeric, LiteralToken::NoPrefix,
+                         10, 0};
+    if (token.is(tok::numeric_constant)) {
+      classifyNumeric(
+          Lexer::getSpelling(token, spellingBuffer, SM, CI.getLangOpts()),
+          literal);
+    } else if (tok::isStringLiteral(token.getKind()) ||
+               token.isOneOf(tok::char_constant, tok::wide_char_constant,
+                             tok::utf8_char_constant, tok::utf16_char_constant,
+                             tok::utf32_char_constant)) {
+      literal.kind = tok::isStringLiteral(token.getKind())
+                         ? LiteralToken::String
+                         : LiteralToken::Character;
+      classifyQuoted(
+          Lexer::getSpelling(token, spellingBuffer, SM, CI.getLangOpts()),
+          literal);
+    } else {
+      continue;
+    }
+    file.literals.push_back(literal);
+  }
+}
+}
@@ -0,0 +1,92 @@
+//===-  LexicalTokenTable.h - Literals, trigraphs and digraphs per file----===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef LEXICAL_TOKEN_TABLE_H
+#define LEXICAL_TOKEN_TABLE_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/StringRef.h"
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace misracpp2008 {
+
+/// \brief A literal token, classified once by the raw lexer pass.
+struct LiteralToken {
+  enum Kind : uint8_t { Numeric, Character, String };
+
+  enum Prefix : uint8_t {
+    NoPrefix,
+    WidePrefix,  ///< L
+    UTF8Prefix,  ///< u8
+    UTF16Prefix, ///< u
+    UTF32Prefix  ///< U
+  };
+
+  enum Flag : uint8_t {
+    IsFloating = 1 << 0,
+    IsNonZeroOctal = 1 << 1,      ///< Octal constant other than zero.
+    HasUpperCaseUSuffix = 1 << 2, ///< 'U' suffix.
+    HasLowerCaseSuffix = 1 << 3,  ///< 'u', 'l' or 'f' suffix.
+    HasOctalEscape = 1 << 4,      ///< Octal escape sequence other than "\\0".
+    HasNonStandardEscape = 1 << 5, ///< Escape sequence not defined by C++03.
+    IsRaw = 1 << 6                 ///< Raw string literal.
+  };
+
+  unsigned offset; ///< Offset of the token within its file.
+  Kind kind;
+  Prefix prefix;
+  uint8_t radix; ///< Radix of numeric literals, 10 for the other ones.
+  uint8_t flags;
+
+  bool is(Flag flag) const { return (flags & flag) != 0; }
+};
+
+/// \brief The lexical tokens of a file the rules are interested in.
+struct LexedFile {
+  std::vector<LiteralToken> literals; ///< Ordered by offset.
+  std::vector<unsigned> trigraphs;    ///< Offsets of the trigraphs.
+  std::vector<unsigned> digraphs;     ///< Offsets of the digraphs.
+};
+
+/// \brief Shared analysis lexing each file of the translation unit once and
+/// keeping what the lexical rules need to know about its tokens.
+///
+/// Files are lexed with a raw lexer on their first request, so files nobody
+/// asks for, e.g. system headers, are never lexed. Directives which take free
+/// text, like \#include or \#error, are skipped.
+class LexicalTokenTable : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit LexicalTokenTable(clang::CompilerInstance &CI);
+
+  /// \brief Get the literal token spelled at \c loc.
+  /// \return The classified token or nullptr if there is no literal at the
+  /// spelling location of \c loc.
+  const LiteralToken *getLiteral(clang::SourceLocation loc);
+
+  /// \brief Get the tokens of \c FID, lexing it on the first request.
+  const LexedFile &getLexedFile(clang::FileID FID);
+
+  /// \brief The files of the translation unit, in the order of their first
+  /// inclusion.
+  std::vector<clang::FileID> getFiles() const;
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  /// Node based, references to the lexed files stay valid.
+  std::map<clang::FileID, LexedFile> files;
+
+  void lex(clang::FileID FID, LexedFile &file) const;
+};
+}
+
+#endif
@@ -0,0 +1,496 @@
+//===-  LoopControl.cpp - Loop counters and loop-control variables---------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "LoopControl.h"
+#include "EvaluationCache.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/AST/StmtCXX.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char LoopControl::ID = 0;
+
+namespace {
+
+const unsigned none = ~0u;
+
+const VarDecl *getVariable(const Expr *expr) {
+  const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(expr->IgnoreParenImpCasts());
+  return ref == nullptr ? nullptr : dyn_cast<VarDecl>(ref->getDecl());
+}
+
+bool contains(const std::vector<const VarDecl *> &variables,
+              const VarDecl *variable) {
+  return std::find(variables.begin(), variables.end(), variable) !=
+         variables.end();
+}
+
+/// \brief Collect the variables \c stmt refers to.
+/// \return false if \c stmt contains a call.
+bool collectVariables(const Stmt *stmt,
+                      std::vector<const VarDecl *> &variables) {
+  if (stmt == nullptr) {
+    return true;
+  }
+  if (isa<CallExpr>(stmt)) {
+    return false;
+  }
+  if (const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(stmt)) {
+    const VarDecl *variable = dyn_cast<VarDecl>(ref->getDecl());
+    if (variable != nullptr && !contains(variables, variable)) {
+      variables.push_back(variable);
+    }
+  }
+  bool hasNoCalls = true;
+  for (const Stmt *child : stmt->children()) {
+    hasNoCalls = collectVariables(child, variables) && hasNoCalls;
+  }
+  return hasNoCalls;
+}
+
+/// \brief Scans the translation unit with the loops enclosing the current
+/// statement at hand.
+class LoopScanner : public RecursiveASTVisitor<LoopScanner> {
+public:
+  LoopScanner(EvaluationCache &evaluations, std::vector<LoopRecord> &loops,
+              std::vector<LoopViolation> &violations)
+      : evaluations(evaluations), loops(loops), violations(violations) {}
+
+  bool TraverseForStmt(ForStmt *stmt) {
+    enter(stmt, LoopRecord::For);
+    activeLoops.back().isInInit = true;
+    TraverseStmt(stmt->getInit());
+    activeLoops.back().isInInit = false;
+    setRegion(LoopModification::Condition);
+    TraverseStmt(stmt->getConditionVariableDeclStmt());
+    TraverseStmt(stmt->getCond());
+    setRegion(LoopModification::Expression);
+    TraverseStmt(stmt->getInc());
+    identifyCounters();
+    setRegion(LoopModification::Statement);
+    TraverseStmt(stmt->getBody());
+    leave();
+    return true;
+  }
+
+  bool TraverseCXXForRangeStmt(CXXForRangeStmt *stmt) {
+    TraverseStmt(stmt->getRangeInit());
+    enter(stmt, LoopRecord::RangeFor);
+    TraverseStmt(stmt->getLoopVarStmt());
+    TraverseStmt(stmt->getBody());
+    leave();
+    return true;
+  }
+
+  bool TraverseWhileStmt(WhileStmt *stmt) {
+    enter(stmt, LoopRecord::While);
+    setRegion(LoopModification::Condition);
+    TraverseStmt(stmt->getConditionVariableDeclStmt());
+    TraverseStmt(stmt->getCond());
+    setRegion(LoopModification::Statement);
+    TraverseStmt(stmt->getBody());
+    leave();
+    return true;
+  }
+
+  bool TraverseDoStmt(DoStmt *stmt) {
+    enter(stmt, LoopRecord::Do);
+    TraverseStmt(stmt->getBody());
+    setRegion(LoopModification::Condition);
+    TraverseStmt(stmt->getCond());
+    leave();
+    return true;
+  }
+
+  bool TraverseSwitchStmt(SwitchStmt *stmt) {
+    breakTargets.push_back(none);
+    RecursiveASTVisitor<LoopScanner>::TraverseSwitchStmt(stmt);
+    breakTargets.pop_back();
+    return true;
+  }
+
+  // The loops enclosing a lambda or a local class do not enclose the
+  // statements of its functions.
+  bool TraverseLambdaExpr(LambdaExpr *lambda) {
+    Isolation isolation(*this);
+    return RecursiveASTVisitor<LoopScanner>::TraverseLambdaExpr(lambda);
+  }
+
+  bool TraverseCXXRecordDecl(CXXRecordDecl *decl) {
+    Isolation isolation(*this);
+    return RecursiveASTVisitor<LoopScanner>::TraverseCXXRecordDecl(decl);
+  }
+
+  bool VisitDeclRefExpr(DeclRefExpr *ref) {
+    const VarDecl *variable = dyn_cast<VarDecl>(ref->getDecl());
+    if (variable == nullptr || !isInForCondition()) {
+      return true;
+    }
+    LoopRecord &record = loops[activeLoops.back().index];
+    if (!contains(record.controlVariables, variable)) {
+      record.controlVariables.push_back(variable);
+    }
+    record.conditionUses.push_back(
+        LoopConditionUse{ref, relationalOperands.count(ref) != 0});
+    return true;
+  }
+
+  bool VisitUnaryOperator(UnaryOperator *op) {
+    if (op->isIncrementDecrementOp()) {
+      addModification(op->getSubExpr(), op, LoopModification::Increment);
+    }
+    return true;
+  }
+
+  bool VisitBinaryOperator(BinaryOperator *op) {
+    if (op->isRelationalOp()) {
+      addRelationalOperand(op->getLHS());
+      addRelationalOperand(op->getRHS());
+    } else if (op->getOpcode() == BO_AddAssign ||
+               op->getOpcode() == BO_SubAssign) {
+      addModification(op->getLHS(), op, LoopModification::Step, op->getRHS());
+    } else if (op->isAssignmentOp()) {
+      addModification(op->getLHS(), op, LoopModification::Other);
+    }
+    return true;
+  }
+
+  bool VisitCXXOperatorCallExpr(CXXOperatorCallExpr *call) {
+    if (call->getNumArgs() == 0) {
+      return true;
+    }
+    switch (call->getOperator()) {
+    case OO_Less:
+    case OO_LessEqual:
+    case OO_Greater:
+    case OO_GreaterEqual:
+      for (const Expr *arg : call->arguments()) {
+        addRelationalOperand(arg);
+      }
+      break;
+    case OO_PlusPlus:
+    case OO_MinusMinus:
+      addModification(call->getArg(0), call, LoopModification::Increment);
+      break;
+    case OO_PlusEqual:
+    case OO_MinusEqual:
+      if (call->getNumArgs() == 2) {
+        addModification(call->getArg(0), call, LoopModification::Step,
+                        call->getArg(1));
+      }
+      break;
+    case OO_Equal:
+    case OO_StarEqual:
+    case OO_SlashEqual:
+    case OO_PercentEqual:
+    case OO_CaretEqual:
+    case OO_AmpEqual:
+    case OO_PipeEqual:
+    case OO_LessLessEqual:
+    case OO_GreaterGreaterEqual:
+      addModification(call->getArg(0), call, LoopModification::Other);
+      break;
+    default:
+      break;
+    }
+    return true;
+  }
+
+  bool VisitBreakStmt(BreakStmt *stmt) {
+    if (!breakTargets.empty() && breakTargets.back() != none) {
+      loops[breakTargets.back()].exits.push_back(stmt);
+    }
+    return true;
+  }
+
+  bool VisitContinueStmt(ContinueStmt *stmt) {
+    if (!activeLoops.empty()) {
+      loops[activeLoops.back().index].continues.push_back(stmt);
+    }
+    return true;
+  }
+
+  // The gotos are exits until the scan of the loop has shown their label to
+  // be within the loop.
+  bool VisitGotoStmt(GotoStmt *stmt) {
+    for (const ActiveLoop &active : activeLoops) {
+      loops[active.index].exits.push_back(stmt);
+    }
+    return true;
+  }
+
+  bool VisitLabelStmt(LabelStmt *stmt) {
+    for (ActiveLoop &active : activeLoops) {
+      active.labels.insert(stmt->getDecl());
+    }
+    return true;
+  }
+
+private:
+  struct ActiveLoop {
+    unsigned index;
+    LoopRecord::Kind kind;
+    LoopModification::Region region;
+    bool isInInit;
+    /// Variables the modifications of which are recorded in the statement.
+    llvm::SmallPtrSet<const VarDecl *, 8> tracked;
+    llvm::SmallPtrSet<const LabelDecl *, 4> labels;
+  };
+
+  /// \brief Hides the enclosing loops for its lifetime.
+  class Isolation {
+  public:
+    explicit Isolation(LoopScanner &scanner) : scanner(scanner) {
+      std::swap(activeLoops, scanner.activeLoops);
+      std::swap(breakTargets, scanner.breakTargets);
+    }
+    ~Isolation() {
+      std::swap(activeLoops, scanner.activeLoops);
+      std::swap(breakTargets, scanner.breakTargets);
+    }
+
+  private:
+    LoopScanner &scanner;
+    std::vector<ActiveLoop> activeLoops;
+    std::vector<unsigned> breakTargets;
+  };
+
+  EvaluationCache &evaluations;
+  std::vector<LoopRecord> &loops;
+  std::vector<LoopViolation> &violations;
+  std::vector<ActiveLoop> activeLoops;
+  /// Index of the loop each enclosing breakable statement is, none for a
+  /// switch.
+  std::vector<unsigned> breakTargets;
+  /// Operands of the relational operators of the current for condition.
+  llvm::SmallPtrSet<const Expr *, 8> relationalOperands;
+
+  void enter(const Stmt *loop, LoopRecord::Kind kind) {
+    const unsigned index = loops.size();
+    loops.push_back(LoopRecord());
+    loops.back().loop = loop;
+    loops.back().kind = kind;
+    activeLoops.push_back(ActiveLoop());
+    activeLoops.back().index = index;
+    activeLoops.back().kind = kind;
+    activeLoops.back().region = LoopModification::Statement;
+    activeLoops.back().isInInit = false;
+    breakTargets.push_back(index);
+  }
+
+  void setRegion(LoopModification::Region region) {
+    activeLoops.back().region = region;
+  }
+
+  bool isInForCondition() const {
+    return !activeLoops.empty() &&
+           activeLoops.back().kind == LoopRecord::For &&
+           activeLoops.back().region == LoopModification::Condition;
+  }
+
+  void addRelationalOperand(const Expr *operand) {
+    if (isInForCondition()) {
+      relationalOperands.insert(operand->IgnoreParenImpCasts());
+    }
+  }
+
+  void addModification(const Expr *target, const Expr *expr,
+                       LoopModification::Kind kind,
+                       const Expr *step = nullptr) {
+    const VarDecl *variable = getVariable(target);
+    if (variable == nullptr) {
+      return;
+    }
+    for (const ActiveLoop &active : activeLoops) {
+      if (active.kind != LoopRecord::For || active.isInInit ||
+          (active.region == LoopModification::Statement &&
+           active.tracked.count(variable) == 0)) {
+        continue;
+      }
+      loops[active.index].modifications.push_back(
+          LoopModification{variable, expr, step, kind, active.region});
+    }
+  }
+
+  /// \brief Identify the counters of the current for loop, once its
+  /// condition and expression have been scanned.
+  void identifyCounters() {
+    ActiveLoop &active = activeLoops.back();
+    LoopRecord &record = loops[active.index];
+    addCounters(record, true);
+    if (record.counters.empty()) {
+      addCounters(record, false);
+    }
+    for (const LoopModification &modification : record.modifications) {
+      if (modification.step != nullptr &&
+          contains(record.counters, modification.variable)) {
+        collectVariables(modification.step, record.stepVariables);
+      }
+    }
+    active.tracked.insert(record.controlVariables.begin(),
+                          record.controlVariables.end());
+    active.tracked.insert(record.stepVariables.begin(),
+                          record.stepVariables.end());
+    relationalOperands.clear();
+  }
+
+  void addCounters(LoopRecord &record, bool isRelationalOperandRequired) {
+    for (const LoopModification &modification : record.modifications) {
+      if (modification.region != LoopModification::Expression ||
+          contains(record.counters, modification.variable)) {
+        continue;
+      }
+      for (const LoopConditionUse &use : record.conditionUses) {
+        if (use.ref->getDecl() == modification.variable &&
+            (use.isRelationalOperand || !isRelationalOperandRequired)) {
+          record.counters.push_back(modification.variable);
+          break;
+        }
+      }
+    }
+  }
+
+  void leave() {
+    const ActiveLoop active = std::move(activeLoops.back());
+    activeLoops.pop_back();
+    breakTargets.pop_back();
+    LoopRecord &record = loops[active.index];
+    record.exits.erase(
+        std::remove_if(record.exits.begin(), record.exits.end(),
+                       [&active](const Stmt *exit) {
+                         const GotoStmt *gotoStmt = dyn_cast<GotoStmt>(exit);
+                         return gotoStmt != nullptr &&
+                                active.labels.count(gotoStmt->getLabel()) != 0;
+                       }),
+        record.exits.end());
+
+    const size_t violationCount = violations.size();
+    if (record.kind == LoopRecord::For) {
+      checkForLoop(record);
+    }
+    const bool isWellFormed = violations.size() == violationCount &&
+                              (record.kind == LoopRecord::For ||
+                               record.kind == LoopRecord::RangeFor);
+    if (!isWellFormed) {
+      for (const Stmt *stmt : record.continues) {
+        addViolation("6-6-3", stmt->getLocStart());
+      }
+    }
+    for (size_t i = 1; i < record.exits.size(); ++i) {
+      addViolation("6-6-4", record.exits[i]->getLocStart());
+    }
+  }
+
+  void checkForLoop(const LoopRecord &record) {
+    if (record.counters.size() != 1 ||
+        record.counters.front()->getType()->isRealFloatingType()) {
+      addViolation("6-5-1", cast<ForStmt>(record.loop)->getForLoc());
+    }
+
+    for (const VarDecl *counter : record.counters) {
+      bool isIncremented = true;
+      for (const LoopModification &modification : record.modifications) {
+        if (modification.variable != counter) {
+          continue;
+        }
+        if (modification.region != LoopModification::Expression) {
+          addViolation("6-5-3", modification.expr->getLocStart());
+          continue;
+        }
+        isIncremented &= modification.kind == LoopModification::Increment;
+        if (modification.kind == LoopModification::Other ||
+            (modification.kind == LoopModification::Step &&
+             !isConstantStep(record, *modification.step))) {
+          addViolation("6-5-4", modification.expr->getLocStart());
+        }
+      }
+      if (isIncremented) {
+        continue;
+      }
+      for (const LoopConditionUse &use : record.conditionUses) {
+        if (use.ref->getDecl() == counter && !use.isRelationalOperand) {
+          addViolation("6-5-2", use.ref->getLocation());
+        }
+      }
+    }
+
+    for (const LoopModification &modification : record.modifications) {
+      if (!contains(record.controlVariables, modification.variable) ||
+          contains(record.counters, modification.variable)) {
+        continue;
+      }
+      if (modification.region != LoopModification::Statement) {
+        addViolation("6-5-5", modification.expr->getLocStart());
+      } else if (!modification.variable->getType()->isBooleanType()) {
+        addViolation("6-5-6", modification.expr->getLocStart());
+      }
+    }
+  }
+
+  /// \brief Tell whether \c step remains constant for the duration of the
+  /// loop: it is a constant, or made of variables the loop does not modify.
+  bool isConstantStep(const LoopRecord &record, const Expr &step) const {
+    if (evaluations.evaluate(&step, false) != nullptr) {
+      return true;
+    }
+    std::vector<const VarDecl *> variables;
+    if (!collectVariables(&step, variables)) {
+      return false;
+    }
+    for (const LoopModification &modification : record.modifications) {
+      if (contains(variables, modification.variable)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void addViolation(llvm::StringRef rule, SourceLocation loc) {
+    violations.push_back(LoopViolation{rule, loc});
+  }
+};
+}
+
+LoopControl::LoopControl(CompilerInstance &CI) : CI(CI) {}
+
+llvm::ArrayRef<LoopRecord>
+LoopControl::getLoops(EvaluationCache &evaluations) {
+  scan(evaluations);
+  return loops;
+}
+
+llvm::ArrayRef<LoopViolation>
+LoopControl::getViolations(EvaluationCache &evaluations) {
+  scan(evaluations);
+  return violations;
+}
+
+void LoopControl::printStatistics(llvm::raw_ostream &OS) const {
+  size_t modificationCount = 0;
+  for (const LoopRecord &record : loops) {
+    modificationCount += record.modifications.size();
+  }
+  OS << "Loop control: " << loops.size() << " loops, " << modificationCount
+     << " modifications, " << violations.size() << " violations\n";
+}
+
+void LoopControl::scan(EvaluationCache &evaluations) {
+  if (isScanned) {
+    return;
+  }
+  isScanned = true;
+  LoopScanner scanner(evaluations, loops, violations);
+  scanner.TraverseDecl(CI.getASTContext().getTranslationUnitDecl());
+}
+}
@@ -0,0 +1,119 @@
+//===-  LoopControl.h - Loop counters and loop-control variables-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef LOOP_CONTROL_H
+#define LOOP_CONTROL_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include <cstdint>
+#include <vector>
+
+namespace clang {
+class DeclRefExpr;
+class Expr;
+class Stmt;
+class VarDecl;
+}
+
+namespace misracpp2008 {
+
+class EvaluationCache;
+
+/// \brief A modification of a variable within a loop, in the terms of MISRA:
+/// the condition, expression and statement of a for loop are its condition,
+/// increment and body.
+struct LoopModification {
+  enum Kind : uint8_t {
+    Increment, ///< ++ or --
+    Step,      ///< += or -=
+    Other
+  };
+  enum Region : uint8_t { Condition, Expression, Statement };
+
+  const clang::VarDecl *variable;
+  const clang::Expr *expr;
+  const clang::Expr *step; ///< Right operand of a Step, nullptr otherwise.
+  Kind kind;
+  Region region;
+};
+
+/// \brief Use of a variable within the condition of a for loop.
+struct LoopConditionUse {
+  const clang::DeclRefExpr *ref;
+  bool isRelationalOperand; ///< Operand of <, <=, > or >=.
+};
+
+/// \brief What the iteration rules need to know about a loop.
+struct LoopRecord {
+  enum Kind : uint8_t { For, RangeFor, While, Do };
+
+  const clang::Stmt *loop;
+  Kind kind;
+  /// Variables occurring in the condition of a for loop.
+  std::vector<const clang::VarDecl *> controlVariables;
+  /// Control variables modified in the expression, see LoopControl.
+  std::vector<const clang::VarDecl *> counters;
+  /// Variables the steps of the counters depend on.
+  std::vector<const clang::VarDecl *> stepVariables;
+  std::vector<LoopConditionUse> conditionUses;
+  /// Modifications of the control and step variables, in the order of
+  /// the source. Only recorded for for loops.
+  std::vector<LoopModification> modifications;
+  /// break and goto statements leaving the loop.
+  std::vector<const clang::Stmt *> exits;
+  /// continue statements of the loop.
+  std::vector<const clang::Stmt *> continues;
+};
+
+/// \brief Violation of one of the iteration rules 6-5-1 to 6-5-6, 6-6-3 and
+/// 6-6-4.
+struct LoopViolation {
+  llvm::StringRef rule;
+  clang::SourceLocation loc;
+};
+
+/// \brief Shared analysis identifying the loop counters and loop-control
+/// variables of all the loops of the translation unit.
+///
+/// The counters of a for loop are the variables modified in its expression
+/// which are operand of a relational operator in its condition, or failing
+/// that, the ones modified in its expression and used in its condition.
+///
+/// The translation unit is scanned once, with the loops enclosing the
+/// current statement at hand, so the body of a nested loop is not scanned
+/// again for each enclosing loop. A modification is recorded in the table
+/// of each enclosing loop it concerns, and the rules are checked from the
+/// table when the scan leaves the loop.
+class LoopControl : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit LoopControl(clang::CompilerInstance &CI);
+
+  /// \brief The loops of the translation unit, in the order of the source.
+  /// \param evaluations The values of the constant loop steps.
+  llvm::ArrayRef<LoopRecord> getLoops(EvaluationCache &evaluations);
+
+  /// \brief The violations of the iteration rules, inner loops first.
+  /// \param evaluations The values of the constant loop steps.
+  llvm::ArrayRef<LoopViolation> getViolations(EvaluationCache &evaluations);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  bool isScanned = false;
+  std::vector<LoopRecord> loops;
+  std::vector<LoopViolation> violations;
+
+  void scan(EvaluationCache &evaluations);
+};
+}
+
+#endif
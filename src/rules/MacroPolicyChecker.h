@@ -0,0 +1,51 @@
+//===-  MacroPolicyChecker.h - Helper class--------------------------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MACRO_POLICY_CHECKER_H
+#define MACRO_POLICY_CHECKER_H
+
+#include "MacroTable.h"
+#include "clang/Lex/MacroInfo.h"
+#include "clang/Lex/PPCallbacks.h"
+#include "clang/Lex/Token.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+/// \brief Auxiliary for easier implementation of a checker which checks the
+/// \#define and \#undef directives. The directives are classified by the
+/// MacroTable, subclasses check the records.
+class MacroPolicyChecker : public RuleCheckerPPCallback {
+public:
+  virtual void MacroDefined(const Token &MacroNameTok,
+                            const MacroDirective *MD) override final {
+    if (doIgnore(MacroNameTok.getLocation())) {
+      return;
+    }
+    checkMacro(getSharedAnalysis<MacroTable>().recordDefinition(
+        MacroNameTok.getLocation(), *MD->getMacroInfo()));
+  }
+
+  virtual void MacroUndefined(const Token &MacroNameTok,
+                              const MacroDefinition &MD) override final {
+    if (doIgnore(MacroNameTok.getLocation())) {
+      return;
+    }
+    checkMacro(getSharedAnalysis<MacroTable>().recordUndefinition(
+        MacroNameTok.getLocation()));
+  }
+
+protected:
+  /// \brief To be implemented by the subclass: Check a directive which is not
+  /// to be ignored.
+  /// \param record Record of the directive.
+  virtual void checkMacro(const MacroRecord &record) {}
+};
+}
+
+#endif
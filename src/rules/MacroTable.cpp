@@ -0,0 +1,104 @@
+//===-  MacroTable.cpp - Macro definitions of a translation unit-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "MacroTable.h"
+#include "clang/Basic/TokenKinds.h"
+#include "clang/Lex/MacroInfo.h"
+#include "clang/Lex/Token.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char MacroTable::ID = 0;
+
+namespace {
+
+bool isSpecifier(const Token &token) {
+  return token.isOneOf(tok::kw_const, tok::kw_volatile, tok::kw_static,
+                       tok::kw_extern, tok::kw_register, tok::kw_mutable,
+                       tok::kw_thread_local);
+}
+
+/// \brief Tell whether the parameter at \c index of \c tokens is enclosed in
+/// parentheses or an operand of # or ##.
+bool isProtectedParameter(llvm::ArrayRef<Token> tokens, size_t index) {
+  const Token *previous = index > 0 ? &tokens[index - 1] : nullptr;
+  const Token *next = index + 1 < tokens.size() ? &tokens[index + 1] : nullptr;
+  if (previous && previous->isOneOf(tok::hash, tok::hashhash)) {
+    return true;
+  }
+  if (next && next->is(tok::hashhash)) {
+    return true;
+  }
+  return previous && previous->is(tok::l_paren) && next &&
+         next->is(tok::r_paren);
+}
+}
+
+MacroTable::MacroTable(CompilerInstance &CI) {}
+
+const MacroRecord &MacroTable::recordDefinition(SourceLocation nameLoc,
+                                                const MacroInfo &macroInfo) {
+  if (!records.empty() && records.back().nameLoc == nameLoc) {
+    return records.back();
+  }
+  records.push_back(MacroRecord{nameLoc, SourceLocation(), SourceLocation(),
+                                SourceLocation(), 0, 0});
+  classifyBody(macroInfo, records.back());
+  return records.back();
+}
+
+const MacroRecord &MacroTable::recordUndefinition(SourceLocation nameLoc) {
+  if (!records.empty() && records.back().nameLoc == nameLoc) {
+    return records.back();
+  }
+  records.push_back(MacroRecord{nameLoc, SourceLocation(), SourceLocation(),
+                                SourceLocation(), 0,
+                                MacroRecord::IsUndefinition});
+  return records.back();
+}
+
+void MacroTable::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Macro table: " << records.size() << " directives, " << tokenCount
+     << " body tokens\n";
+}
+
+void MacroTable::classifyBody(const MacroInfo &macroInfo, MacroRecord &record) {
+  const llvm::ArrayRef<Token> tokens(macroInfo.tokens_begin(),
+                                     macroInfo.tokens_end());
+  tokenCount += tokens.size();
+  const bool isFunctionLike = macroInfo.isFunctionLike();
+  if (isFunctionLike) {
+    record.flags |= MacroRecord::IsFunctionLike;
+  }
+
+  bool onlySpecifiers = !isFunctionLike;
+  for (size_t i = 0, e = tokens.size(); i != e; ++i) {
+    const Token &token = tokens[i];
+    onlySpecifiers = onlySpecifiers && isSpecifier(token);
+    if (token.isOneOf(tok::hash, tok::hashhash)) {
+      ++record.operatorCount;
+      if (record.operatorCount == 1) {
+        record.firstOperatorLoc = token.getLocation();
+      } else if (record.operatorCount == 2) {
+        record.secondOperatorLoc = token.getLocation();
+      }
+    } else if (isFunctionLike && token.is(tok::identifier) &&
+               !record.is(MacroRecord::HasUnparenthesizedParameter) &&
+               macroInfo.getArgumentNum(token.getIdentifierInfo()) >= 0 &&
+               !isProtectedParameter(tokens, i)) {
+      record.flags |= MacroRecord::HasUnparenthesizedParameter;
+      record.unparenthesizedParameterLoc = token.getLocation();
+    }
+  }
+  if (onlySpecifiers) {
+    record.flags |= MacroRecord::ExpandsToSpecifiers;
+  }
+}
+}
@@ -0,0 +1,82 @@
+//===-  MacroTable.h - Macro definitions of a translation unit-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef MACRO_TABLE_H
+#define MACRO_TABLE_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include <cstdint>
+#include <vector>
+
+namespace clang {
+class MacroInfo;
+}
+
+namespace misracpp2008 {
+
+/// \brief What the macro related rules need to know about a \#define or an
+/// \#undef directive.
+struct MacroRecord {
+  enum Flag : uint8_t {
+    IsUndefinition = 1 << 0,
+    IsFunctionLike = 1 << 1,
+    /// A parameter is used neither in parentheses nor as operand of # or ##,
+    /// see rule 16-0-6.
+    HasUnparenthesizedParameter = 1 << 2,
+    /// Object-like macro with a body which is empty or consists of type
+    /// qualifiers and storage class specifiers only, see rule 16-2-2.
+    ExpandsToSpecifiers = 1 << 3
+  };
+
+  clang::SourceLocation nameLoc;
+  clang::SourceLocation firstOperatorLoc;  ///< First # or ## of the body.
+  clang::SourceLocation secondOperatorLoc; ///< Second # or ## of the body.
+  clang::SourceLocation unparenthesizedParameterLoc;
+  unsigned operatorCount; ///< Number of # and ## tokens in the body.
+  uint8_t flags;
+
+  bool is(Flag flag) const { return (flags & flag) != 0; }
+};
+
+/// \brief Shared analysis classifying each \#define and \#undef directive of
+/// the translation unit once.
+///
+/// Like the IncludeTracker, the table is fed by the checkers which get told
+/// about the directives, the first one records a directive and the others
+/// get the same record. Directives the checkers ignore are not recorded.
+class MacroTable : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit MacroTable(clang::CompilerInstance &CI);
+
+  /// \brief Record a \#define directive.
+  /// \return The record of the directive, valid until the next directive gets
+  /// recorded.
+  const MacroRecord &recordDefinition(clang::SourceLocation nameLoc,
+                                      const clang::MacroInfo &macroInfo);
+
+  /// \brief Record an \#undef directive.
+  /// \return The record of the directive, valid until the next directive gets
+  /// recorded.
+  const MacroRecord &recordUndefinition(clang::SourceLocation nameLoc);
+
+  /// \brief The directives recorded so far, in the order of preprocessing.
+  llvm::ArrayRef<MacroRecord> getRecords() const { return records; }
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  std::vector<MacroRecord> records;
+  unsigned tokenCount = 0;
+
+  void classifyBody(const clang::MacroInfo &macroInfo, MacroRecord &record);
+};
+}
+
+#endif
@@ -0,0 +1,528 @@
+//===-  PointerProvenance.cpp - Objects the pointers point into------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "PointerProvenance.h"
+#include "ControlFlowCache.h"
+#include "Dataflow.h"
+#include "EvaluationCache.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Analysis/CFG.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/APSInt.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char PointerProvenance::ID = 0;
+
+namespace {
+
+const unsigned NoVariable = ~0u;
+
+/// \brief What an expression of a function points into: a provenance, or the
+/// one of a tracked variable, which is only known once all the assignments
+/// of the function have been seen.
+struct Term {
+  Provenance provenance;
+  unsigned variable;
+
+  static Term unknown() { return Term{Provenance::unknown(), NoVariable}; }
+};
+
+bool isSameObject(const Provenance &a, const Provenance &b) {
+  return a.kind == b.kind && a.base == b.base;
+}
+
+/// \brief The provenance of a pointer which may be either \c a or \c b.
+Provenance join(const Provenance &a, const Provenance &b) {
+  if (!isSameObject(a, b)) {
+    return Provenance::unknown();
+  }
+  Provenance result = a;
+  result.hasOffset = a.hasOffset && b.hasOffset && a.offset == b.offset;
+  return result;
+}
+
+/// \brief Tell whether \c op is pointer arithmetic, the subtraction of two
+/// pointers excepted.
+bool isPointerArithmetic(const BinaryOperator *op) {
+  switch (op->getOpcode()) {
+  case BO_Add:
+  case BO_Sub:
+    return op->getType()->isPointerType();
+  case BO_AddAssign:
+  case BO_SubAssign:
+    return op->getLHS()->getType()->isPointerType();
+  default:
+    return false;
+  }
+}
+
+bool isPointerDifference(const BinaryOperator *op) {
+  return op->getOpcode() == BO_Sub &&
+         op->getLHS()->getType()->isPointerType() &&
+         op->getRHS()->getType()->isPointerType();
+}
+
+/// \brief Tell whether \c expr is an argument decaying from an array named
+/// by an identifier.
+bool isDecayedArrayName(const Expr *expr) {
+  const ImplicitCastExpr *cast = nullptr;
+  while ((cast = dyn_cast<ImplicitCastExpr>(expr->IgnoreParens())) &&
+         cast->getCastKind() == CK_NoOp) {
+    expr = cast->getSubExpr();
+  }
+  if (cast == nullptr || cast->getCastKind() != CK_ArrayToPointerDecay) {
+    return false;
+  }
+  const Expr *array = cast->getSubExpr()->IgnoreParens();
+  return isa<DeclRefExpr>(array) || isa<MemberExpr>(array);
+}
+
+/// \brief Provenances of the pointers of one function.
+///
+/// The tracked variables are the elements of a union-find structure: copying
+/// a variable into another one merges their classes, and each class holds
+/// the join of the provenances assigned to its variables.
+class FunctionProvenance {
+public:
+  FunctionProvenance(ASTContext &context, EvaluationCache &evaluations,
+                     const TrackedVariables &variables,
+                     llvm::DenseMap<const Expr *, Provenance> &provenances,
+                     std::vector<PointerViolation> &violations)
+      : context(context), evaluations(evaluations), variables(variables),
+        provenances(provenances), violations(violations),
+        parents(variables.size()), classes(variables.size()) {
+    for (unsigned index = 0; index < variables.size(); ++index) {
+      parents[index] = index;
+      // The arguments may point anywhere.
+      if (isa<ParmVarDecl>(variables.getVariable(index))) {
+        classes[index] = ClassState{Provenance::unknown(), true};
+      }
+    }
+  }
+
+  /// \brief Record the assignment of \c stmt, an element of the CFG, to a
+  /// tracked pointer variable, or the subscript \c stmt takes the address of.
+  /// \return Whether \c stmt assigns a pointer variable.
+  bool collect(const Stmt *stmt);
+
+  /// \brief Check the rules on \c stmt, an element of the CFG, once all the
+  /// assignments have been collected.
+  void check(const Stmt *stmt);
+
+private:
+  struct ClassState {
+    Provenance provenance;
+    /// Whether a value has been assigned to one of the variables yet.
+    bool isAssigned;
+  };
+
+  ASTContext &context;
+  EvaluationCache &evaluations;
+  const TrackedVariables &variables;
+  llvm::DenseMap<const Expr *, Provenance> &provenances;
+  std::vector<PointerViolation> &violations;
+  std::vector<unsigned> parents;
+  std::vector<ClassState> classes;
+  llvm::DenseMap<const Expr *, Term> terms;
+  /// Subscripts whose result only has its address taken, e.g. \c &a[10].
+  llvm::SmallPtrSet<const ArraySubscriptExpr *, 8> addressedSubscripts;
+
+  unsigned find(unsigned index);
+  void unite(unsigned a, unsigned b);
+  void assign(unsigned index, const Expr *value);
+  bool evaluate(const Expr *expr, int64_t &value) const;
+  uint64_t getElementCount(const Provenance &provenance) const;
+  Term getTerm(const Expr *expr);
+  Term computeTerm(const Expr *expr);
+  Provenance resolve(const Expr *expr);
+  void checkBounds(const Provenance &provenance, SourceLocation loc,
+                   bool mayBeEnd);
+  void checkDistinct(const BinaryOperator *op, StringRef rule);
+};
+
+unsigned FunctionProvenance::find(unsigned index) {
+  while (parents[index] != index) {
+    parents[index] = parents[parents[index]];
+    index = parents[index];
+  }
+  return index;
+}
+
+void FunctionProvenance::unite(unsigned a, unsigned b) {
+  a = find(a);
+  b = find(b);
+  if (a == b) {
+    return;
+  }
+  parents[a] = b;
+  const ClassState &from = classes[a];
+  ClassState &to = classes[b];
+  if (!to.isAssigned) {
+    to = from;
+  } else if (from.isAssigned) {
+    to.provenance = join(to.provenance, from.provenance);
+  }
+}
+
+void FunctionProvenance::assign(unsigned index, const Expr *value) {
+  const Term term = getTerm(value);
+  if (term.variable != NoVariable) {
+    unite(index, term.variable);
+    return;
+  }
+  // The offset of a variable changes with its arithmetic, only the object
+  // is kept.
+  Provenance provenance = term.provenance;
+  provenance.hasOffset = false;
+  ClassState &state = classes[find(index)];
+  state.provenance =
+      state.isAssigned ? join(state.provenance, provenance) : provenance;
+  state.isAssigned = true;
+}
+
+bool FunctionProvenance::collect(const Stmt *stmt) {
+  if (const UnaryOperator *op = dyn_cast<UnaryOperator>(stmt)) {
+    if (op->getOpcode() == UO_AddrOf) {
+      if (const ArraySubscriptExpr *subscript = dyn_cast<ArraySubscriptExpr>(
+              op->getSubExpr()->IgnoreParens())) {
+        addressedSubscripts.insert(subscript);
+      }
+    }
+  }
+
+  const TrackedVariables::Access access = variables.getAccess(stmt);
+  if (access.variable == nullptr ||
+      !access.variable->getType()->isPointerType() ||
+      !access.is(TrackedVariables::Access::Write)) {
+    return false;
+  }
+  // Compound assignments and increments keep the object pointed into.
+  if (const BinaryOperator *op = dyn_cast<BinaryOperator>(stmt)) {
+    if (op->getOpcode() == BO_Assign) {
+      assign(access.index, op->getRHS());
+    }
+  } else if (isa<DeclStmt>(stmt)) {
+    assign(access.index, access.variable->getInit());
+  }
+  return true;
+}
+
+bool FunctionProvenance::evaluate(const Expr *expr, int64_t &value) const {
+  const APValue *result = evaluations.evaluate(expr, false);
+  if (result == nullptr || !result->isInt()) {
+    return false;
+  }
+  value = result->getInt().getExtValue();
+  return true;
+}
+
+uint64_t FunctionProvenance::getElementCount(
+    const Provenance &provenance) const {
+  if (provenance.kind == Provenance::Object) {
+    return 1;
+  }
+  const ConstantArrayType *type =
+      context.getAsConstantArrayType(provenance.base->getType());
+  return type ? type->getSize().getZExtValue() : 0;
+}
+
+Term FunctionProvenance::getTerm(const Expr *expr) {
+  auto it = terms.find(expr);
+  if (it != terms.end()) {
+    return it->second;
+  }
+  const Term term = computeTerm(expr);
+  terms[expr] = term;
+  return term;
+}
+
+Term FunctionProvenance::computeTerm(const Expr *expr) {
+  expr = expr->IgnoreParens();
+
+  if (const CastExpr *cast = dyn_cast<CastExpr>(expr)) {
+    switch (cast->getCastKind()) {
+    case CK_ArrayToPointerDecay: {
+      const DeclRefExpr *ref =
+          dyn_cast<DeclRefExpr>(cast->getSubExpr()->IgnoreParens());
+      const VarDecl *var = ref ? dyn_cast<VarDecl>(ref->getDecl()) : nullptr;
+      if (var && context.getAsConstantArrayType(var->getType())) {
+        return Term{Provenance{Provenance::Array, var, true, 0}, NoVariable};
+      }
+      return Term::unknown();
+    }
+    case CK_LValueToRValue: {
+      const TrackedVariables::Access access = variables.getAccess(cast);
+      return access.variable ? Term{Provenance::unknown(), access.index}
+                             : Term::unknown();
+    }
+    case CK_NoOp:
+      return getTerm(cast->getSubExpr());
+    case CK_BitCast:
+    case CK_DerivedToBase:
+    case CK_UncheckedDerivedToBase:
+    case CK_BaseToDerived: {
+      // The object is the same, the elements are not.
+      Term term = getTerm(cast->getSubExpr());
+      term.provenance.hasOffset = false;
+      return term;
+    }
+    default:
+      return Term::unknown();
+    }
+  }
+
+  if (const UnaryOperator *op = dyn_cast<UnaryOperator>(expr)) {
+    if (op->isIncrementDecrementOp()) {
+      const TrackedVariables::Access access = variables.getAccess(op);
+      return access.variable ? Term{Provenance::unknown(), access.index}
+                             : Term::unknown();
+    }
+    if (op->getOpcode() != UO_AddrOf) {
+      return Term::unknown();
+    }
+    const Expr *object = op->getSubExpr()->IgnoreParens();
+    if (const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(object)) {
+      const VarDecl *var = dyn_cast<VarDecl>(ref->getDecl());
+      if (var && !var->getType()->isArrayType()) {
+        return Term{Provenance{Provenance::Object, var, true, 0}, NoVariable};
+      }
+      return Term::unknown();
+    }
+    if (const ArraySubscriptExpr *subscript =
+            dyn_cast<ArraySubscriptExpr>(object)) {
+      Term term = getTerm(subscript->getBase());
+      int64_t index;
+      if (term.provenance.hasOffset && evaluate(subscript->getIdx(), index)) {
+        term.provenance.offset += index;
+      } else {
+        term.provenance.hasOffset = false;
+      }
+      return term;
+    }
+    return Term::unknown();
+  }
+
+  if (const BinaryOperator *op = dyn_cast<BinaryOperator>(expr)) {
+    if (op->isAssignmentOp()) {
+      const TrackedVariables::Access access = variables.getAccess(op);
+      return access.variable ? Term{Provenance::unknown(), access.index}
+                             : Term::unknown();
+    }
+    if (op->getOpcode() == BO_Comma) {
+      return getTerm(op->getRHS());
+    }
+    if (!isPointerArithmetic(op)) {
+      return Term::unknown();
+    }
+    const bool isPointerLeft = op->getLHS()->getType()->isPointerType();
+    Term term = getTerm(isPointerLeft ? op->getLHS() : op->getRHS());
+    if (term.variable != NoVariable) {
+      // Only the object of a variable is known, see assign().
+      return term;
+    }
+    int64_t offset;
+    if (term.provenance.hasOffset &&
+        evaluate(isPointerLeft ? op->getRHS() : op->getLHS(), offset)) {
+      term.provenance.offset +=
+          op->getOpcode() == BO_Sub ? -offset : offset;
+    } else {
+      term.provenance.hasOffset = false;
+    }
+    return term;
+  }
+
+  if (const ConditionalOperator *op = dyn_cast<ConditionalOperator>(expr)) {
+    const Term trueTerm = getTerm(op->getTrueExpr());
+    const Term falseTerm = getTerm(op->getFalseExpr());
+    if (trueTerm.variable != NoVariable || falseTerm.variable != NoVariable) {
+      return trueTerm.variable == falseTerm.variable ? trueTerm
+                                                     : Term::unknown();
+    }
+    return Term{join(trueTerm.provenance, falseTerm.provenance), NoVariable};
+  }
+
+  return Term::unknown();
+}
+
+Provenance FunctionProvenance::resolve(const Expr *expr) {
+  const Term term = getTerm(expr);
+  Provenance provenance = term.provenance;
+  if (term.variable != NoVariable) {
+    const ClassState &state = classes[find(term.variable)];
+    provenance = state.isAssigned ? state.provenance : Provenance::unknown();
+    provenance.hasOffset = false;
+  }
+  provenances[expr] = provenance;
+  return provenance;
+}
+
+void FunctionProvenance::checkBounds(const Provenance &provenance,
+                                     SourceLocation loc, bool mayBeEnd) {
+  if (!provenance.isKnown() || !provenance.hasOffset) {
+    return;
+  }
+  // The end of an array may be pointed to, but not dereferenced.
+  const uint64_t count = getElementCount(provenance);
+  const uint64_t limit = mayBeEnd ? count + 1 : count;
+  if (count != 0 && (provenance.offset < 0 ||
+                     static_cast<uint64_t>(provenance.offset) >= limit)) {
+    violations.push_back(PointerViolation{"5-0-16", loc});
+  }
+}
+
+void FunctionProvenance::checkDistinct(const BinaryOperator *op,
+                                       StringRef rule) {
+  const Provenance left = resolve(op->getLHS());
+  const Provenance right = resolve(op->getRHS());
+  if (left.isKnown() && right.isKnown() && !isSameObject(left, right)) {
+    violations.push_back(PointerViolation{rule, op->getOperatorLoc()});
+  }
+}
+
+void FunctionProvenance::check(const Stmt *stmt) {
+  if (const BinaryOperator *op = dyn_cast<BinaryOperator>(stmt)) {
+    if (isPointerArithmetic(op)) {
+      violations.push_back(PointerViolation{"5-0-15", op->getOperatorLoc()});
+      checkBounds(resolve(op), op->getOperatorLoc(), true);
+    } else if (isPointerDifference(op)) {
+      checkDistinct(op, "5-0-17");
+    } else if (op->isRelationalOp() &&
+               op->getLHS()->getType()->isPointerType() &&
+               op->getRHS()->getType()->isPointerType()) {
+      checkDistinct(op, "5-0-18");
+    }
+    return;
+  }
+
+  if (const UnaryOperator *op = dyn_cast<UnaryOperator>(stmt)) {
+    if (op->isIncrementDecrementOp() &&
+        op->getSubExpr()->getType()->isPointerType()) {
+      violations.push_back(PointerViolation{"5-0-15", op->getOperatorLoc()});
+    }
+    return;
+  }
+
+  if (const ArraySubscriptExpr *subscript =
+          dyn_cast<ArraySubscriptExpr>(stmt)) {
+    Provenance provenance = resolve(subscript->getBase());
+    int64_t index;
+    if (provenance.hasOffset && evaluate(subscript->getIdx(), index)) {
+      provenance.offset += index;
+      checkBounds(provenance, subscript->getRBracketLoc(),
+                  addressedSubscripts.count(subscript) != 0);
+    }
+    return;
+  }
+
+  llvm::ArrayRef<const Expr *> arguments;
+  if (const CallExpr *call = dyn_cast<CallExpr>(stmt)) {
+    arguments = llvm::makeArrayRef(call->getArgs(), call->getNumArgs());
+  } else if (const CXXConstructExpr *construct =
+                 dyn_cast<CXXConstructExpr>(stmt)) {
+    arguments =
+        llvm::makeArrayRef(construct->getArgs(), construct->getNumArgs());
+  }
+  for (const Expr *argument : arguments) {
+    if (isDecayedArrayName(argument)) {
+      violations.push_back(
+          PointerViolation{"5-2-12", argument->getLocStart()});
+    }
+  }
+}
+
+class FunctionCollector : public RecursiveASTVisitor<FunctionCollector> {
+public:
+  explicit FunctionCollector(std::vector<const FunctionDecl *> &functions)
+      : functions(functions) {}
+
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (decl->doesThisDeclarationHaveABody()) {
+      functions.push_back(decl);
+    }
+    return true;
+  }
+
+  bool VisitLambdaExpr(LambdaExpr *expr) {
+    functions.push_back(expr->getCallOperator());
+    return true;
+  }
+
+private:
+  std::vector<const FunctionDecl *> &functions;
+};
+}
+
+PointerProvenance::PointerProvenance(CompilerInstance &CI) : CI(CI) {}
+
+Provenance PointerProvenance::getProvenance(const Expr *expr) const {
+  auto it = provenances.find(expr);
+  return it == provenances.end() ? Provenance::unknown() : it->second;
+}
+
+llvm::ArrayRef<PointerViolation>
+PointerProvenance::getViolations(ControlFlowCache &cache,
+                                 EvaluationCache &evaluations) {
+  scan(cache, evaluations);
+  return violations;
+}
+
+void PointerProvenance::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Pointer provenance: " << functionCount << " functions, "
+     << assignmentCount << " pointer assignments, " << provenances.size()
+     << " operands, " << violations.size() << " violations\n";
+}
+
+void PointerProvenance::scan(ControlFlowCache &cache,
+                             EvaluationCache &evaluations) {
+  if (isScanned) {
+    return;
+  }
+  isScanned = true;
+  std::vector<const FunctionDecl *> functions;
+  FunctionCollector(functions)
+      .TraverseDecl(CI.getASTContext().getTranslationUnitDecl());
+  for (const FunctionDecl *function : functions) {
+    scanFunction(*function, cache, evaluations);
+  }
+}
+
+void PointerProvenance::scanFunction(const FunctionDecl &function,
+                                     ControlFlowCache &cache,
+                                     EvaluationCache &evaluations) {
+  const CFG *cfg = cache.getCFG(&function);
+  if (cfg == nullptr) {
+    return;
+  }
+  ++functionCount;
+  FunctionProvenance provenance(CI.getASTContext(), evaluations,
+                                cache.getTrackedVariables(&function),
+                                provenances, violations);
+  for (const CFGBlock *block : *cfg) {
+    for (const CFGElement &element : *block) {
+      if (Optional<CFGStmt> stmt = element.getAs<CFGStmt>()) {
+        if (provenance.collect(stmt->getStmt())) {
+          ++assignmentCount;
+        }
+      }
+    }
+  }
+  for (const CFGBlock *block : *cfg) {
+    for (const CFGElement &element : *block) {
+      if (Optional<CFGStmt> stmt = element.getAs<CFGStmt>()) {
+        provenance.check(stmt->getStmt());
+      }
+    }
+  }
+}
+}
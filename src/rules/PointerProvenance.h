@@ -0,0 +1,102 @@
+//===-  PointerProvenance.h - Objects the pointers point into--------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef POINTER_PROVENANCE_H
+#define POINTER_PROVENANCE_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/StringRef.h"
+#include <cstdint>
+#include <vector>
+
+namespace clang {
+class Expr;
+class FunctionDecl;
+class VarDecl;
+}
+
+namespace misracpp2008 {
+
+class ControlFlowCache;
+class EvaluationCache;
+
+/// \brief The object a pointer points into, as far as it can be determined.
+struct Provenance {
+  enum Kind : uint8_t {
+    Unknown,
+    Object, ///< A variable which is not an array.
+    Array
+  };
+
+  Kind kind;
+  const clang::VarDecl *base;
+  /// Whether the position of the pointer in \c base is known.
+  bool hasOffset;
+  /// Position of the pointer in \c base, in elements.
+  int64_t offset;
+
+  static Provenance unknown() { return Provenance{Unknown, nullptr, false, 0}; }
+
+  bool isKnown() const { return kind != Unknown; }
+};
+
+/// \brief Violation of one of the pointer rules 5-0-15 to 5-0-18 and 5-2-12.
+struct PointerViolation {
+  llvm::StringRef rule;
+  clang::SourceLocation loc;
+};
+
+/// \brief Shared analysis determining which object each pointer-valued
+/// expression of a function points into.
+///
+/// The elements of the control flow graph of each function are walked twice.
+/// The first walk collects the assignments to the local pointer variables
+/// which have no aliases, the second one checks the pointer arithmetic, the
+/// pointer differences and comparisons, and the arguments decaying from
+/// arrays.
+///
+/// The analysis is flow-insensitive within a function: variables copied into
+/// each other share their provenance, kept in a union-find structure, and a
+/// variable assigned pointers into different objects has an unknown one.
+/// So every assignment is looked at once, whatever the order of the
+/// assignments and the shape of the graph. Offsets are only known within an
+/// expression, e.g. for <tt>&a[2] + 3</tt>.
+class PointerProvenance : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit PointerProvenance(clang::CompilerInstance &CI);
+
+  /// \brief The provenance of \c expr, a pointer operand of the rules, as
+  /// found by the last call to getViolations().
+  Provenance getProvenance(const clang::Expr *expr) const;
+
+  /// \brief The violations of the pointer rules, function by function.
+  /// \param cache The control flow graphs of the functions.
+  /// \param evaluations The values of the constant offsets and subscripts.
+  llvm::ArrayRef<PointerViolation> getViolations(ControlFlowCache &cache,
+                                                 EvaluationCache &evaluations);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  bool isScanned = false;
+  llvm::DenseMap<const clang::Expr *, Provenance> provenances;
+  std::vector<PointerViolation> violations;
+  unsigned functionCount = 0;
+  unsigned assignmentCount = 0;
+
+  void scan(ControlFlowCache &cache, EvaluationCache &evaluations);
+  void scanFunction(const clang::FunctionDecl &function,
+                    ControlFlowCache &cache, EvaluationCache &evaluations);
+};
+}
+
+#endif
@@ -0,0 +1,89 @@
+//===-  Rule_0_1_1.cpp - Checker for MISRA C++ 2008 rule 0-1-1-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "Dataflow.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Analysis/CFG.h"
+#include "llvm/ADT/BitVector.h"
+#include "llvm/ADT/SmallVector.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_0_1_1 : public RuleCheckerASTContext,
+                   public RecursiveASTVisitor<Rule_0_1_1> {
+public:
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (!decl->doesThisDeclarationHaveABody() || decl->isImplicit() ||
+        doIgnore(decl->getLocation())) {
+      return true;
+    }
+    const CFG *cfg = getCFG(decl);
+    if (cfg == nullptr) {
+      return true;
+    }
+
+    // The blocks are numbered backwards, so going down from the highest ID
+    // meets the start of an unreachable region before the rest of it. Each
+    // region is reported once, at its first statement.
+    const llvm::BitVector reachable = findReachableBlocks(*cfg);
+    llvm::BitVector covered(reachable);
+    llvm::SmallVector<const CFGBlock *, 16> blocks(cfg->begin(), cfg->end());
+    for (auto it = blocks.rbegin(), ie = blocks.rend(); it != ie; ++it) {
+      const CFGBlock *block = *it;
+      if (covered.test(block->getBlockID())) {
+        continue;
+      }
+      const Stmt *firstStmt = getFirstStmt(*block);
+      if (firstStmt == nullptr) {
+        continue;
+      }
+      cover(block, covered);
+      if (!doIgnore(firstStmt->getLocStart())) {
+        reportError(firstStmt->getLocStart());
+      }
+    }
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+
+private:
+  static const Stmt *getFirstStmt(const CFGBlock &block) {
+    for (const CFGElement &element : block) {
+      if (Optional<CFGStmt> stmt = element.getAs<CFGStmt>()) {
+        return stmt->getStmt();
+      }
+    }
+    return nullptr;
+  }
+
+  /// \brief Mark \c block and the unreachable blocks following it.
+  static void cover(const CFGBlock *block, llvm::BitVector &covered) {
+    llvm::SmallVector<const CFGBlock *, 16> worklist(1, block);
+    covered.set(block->getBlockID());
+    while (!worklist.empty()) {
+      const CFGBlock *current = worklist.pop_back_val();
+      for (const CFGBlock *successor : current->succs()) {
+        if (successor && !covered.test(successor->getBlockID())) {
+          covered.set(successor->getBlockID());
+          worklist.push_back(successor);
+        }
+      }
+    }
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_0_1_1> X("0-1-1", "");
+}
@@ -0,0 +1,68 @@
+//===-  Rule_0_1_6.cpp - Checker for MISRA C++ 2008 rule 0-1-6-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ControlFlowCache.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Analysis/CFG.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// A value is given but never used if the variable is not live after the
+// assignment, i.e. no path from it reads the variable before it is assigned
+// again.
+class Rule_0_1_6 : public RuleCheckerASTContext,
+                   public RecursiveASTVisitor<Rule_0_1_6> {
+public:
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (!decl->doesThisDeclarationHaveABody() || decl->isImplicit() ||
+        doIgnore(decl->getLocation())) {
+      return true;
+    }
+    const CFG *cfg = getCFG(decl);
+    if (cfg == nullptr) {
+      return true;
+    }
+    ControlFlowCache &cache = getSharedAnalysis<ControlFlowCache>();
+    const TrackedVariables &variables = cache.getTrackedVariables(decl);
+    if (variables.size() == 0) {
+      return true;
+    }
+
+    const LivenessProblem problem(variables);
+    const DataflowResult result = cache.solve(*cfg, problem);
+    for (const CFGBlock *block : *cfg) {
+      problem.replay(*block, result, [&](const CFGElement &element,
+                                         const llvm::BitVector &liveAfter) {
+        Optional<CFGStmt> stmt = element.getAs<CFGStmt>();
+        if (!stmt) {
+          return;
+        }
+        const TrackedVariables::Access access =
+            variables.getAccess(stmt->getStmt());
+        if (access.is(TrackedVariables::Access::Write) &&
+            !liveAfter.test(access.index) &&
+            !doIgnore(stmt->getStmt()->getLocStart())) {
+          reportError(stmt->getStmt()->getLocStart());
+        }
+      });
+    }
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_0_1_6> X("0-1-6", "");
+}
@@ -0,0 +1,17 @@
+//===-  Rule_10_1_2.cpp - Checker for MISRA C++ 2008 rule 10-1-2-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AnalysisRuleChecker.h"
+#include "ClassHierarchy.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+class Rule_10_1_2 : public AnalysisRuleChecker<ClassHierarchy> {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_10_1_2> X("10-1-2", "");
+}
@@ -5,54 +5,13 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "clang/AST/ASTContext.h"
-#include "clang/AST/RecursiveASTVisitor.h"
-#include "clang/Basic/Diagnostic.h"
+#include "AnalysisRuleChecker.h"
+#include "ClassHierarchy.h"
 #include "misracpp2008.h"
 
-using namespace clang;
-
 namespace misracpp2008 {
 
-class Rule_10_3_2 : public RuleCheckerASTContext,
-                    public RecursiveASTVisitor<Rule_10_3_2> {
-public:
-  Rule_10_3_2() : RuleCheckerASTContext() {}
-  bool VisitCXXRecordDecl(CXXRecordDecl *decl) {
-    if (doIgnore(decl->getLocStart())) {
-      return true;
-    }
-
-    for (const auto B : decl->methods()) {
-      if (!B->isImplicit() && B->isVirtual() && !B->isVirtualAsWritten()) {
-        reportError(B->getLocation());
-        break;
-      }
-    }
-    return true;
-  }
-  bool VisitCXXDestructorDecl(clang::CXXDestructorDecl *decl) {
-    if (doIgnore(decl->getLocStart())) {
-      return true;
-    }
-
-    // Definitions outside of the class body do not have the virtual keyword
-    if (decl->isThisDeclarationADefinition()) {
-      return true;
-    }
-
-    if (decl->isVirtual() && !decl->isVirtualAsWritten()) {
-      reportError(decl->getLocation());
-    }
-    return true;
-  }
-
-protected:
-  virtual void doWork() override {
-    RuleCheckerASTContext::doWork();
-    this->TraverseDecl(context->getTranslationUnitDecl());
-  }
-};
+class Rule_10_3_2 : public AnalysisRuleChecker<ClassHierarchy> {};
 
 static RuleCheckerASTContextRegistry::Add<Rule_10_3_2> X("10-3-2", "");
 }
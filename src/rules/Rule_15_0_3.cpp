@@ -0,0 +1,17 @@
+//===-  Rule_15_0_3.cpp - Checker for MISRA C++ 2008 rule 15-0-3-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AnalysisRuleChecker.h"
+#include "JumpTables.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+class Rule_15_0_3 : public AnalysisRuleChecker<JumpTables> {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_15_0_3> X("15-0-3", "");
+}
@@ -0,0 +1,46 @@
+//===-  Rule_15_1_1.cpp - Checker for MISRA C++ 2008 rule 15-1-1-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ExceptionSummaries.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// Reports the calls and throw expressions within the operand of a throw
+// expression which may throw, including the construction of the exception
+// object.
+class Rule_15_1_1 : public RuleCheckerASTContext,
+                    public RecursiveASTVisitor<Rule_15_1_1> {
+public:
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (!decl->doesThisDeclarationHaveABody() ||
+        doIgnore(decl->getLocation())) {
+      return true;
+    }
+    const ExceptionSummary &summary =
+        getSharedAnalysis<ExceptionSummaries>().getSummary(decl);
+    for (const Stmt *site : summary.throwingOperands) {
+      if (!doIgnore(site->getLocStart())) {
+        reportError(site->getLocStart());
+      }
+    }
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_15_1_1> X("15-1-1", "");
+}
@@ -0,0 +1,44 @@
+//===-  Rule_15_3_4.cpp - Checker for MISRA C++ 2008 rule 15-3-4-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ExceptionSummaries.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// All call paths start at main(), so an exception thrown on one of them
+// without a compatible handler leaves main(). Translation units without
+// main() are not checked.
+class Rule_15_3_4 : public RuleCheckerASTContext {
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    for (const Decl *decl : context->getTranslationUnitDecl()->decls()) {
+      const FunctionDecl *function = dyn_cast<FunctionDecl>(decl);
+      if (function == nullptr || !function->isMain() ||
+          !function->doesThisDeclarationHaveABody()) {
+        continue;
+      }
+      const ExceptionSummary &summary =
+          getSharedAnalysis<ExceptionSummaries>().getSummary(function);
+      for (const EscapingException &exception : summary.escaping) {
+        if (exception.origin != nullptr &&
+            exception.origin->getSubExpr() != nullptr &&
+            !doIgnore(exception.origin->getLocStart())) {
+          reportError(exception.origin->getLocStart());
+        }
+      }
+    }
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_15_3_4> X("15-3-4", "");
+}
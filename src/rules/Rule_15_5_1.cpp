@@ -5,37 +5,13 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "ExceptionSummaries.h"
 #include "clang/AST/ASTContext.h"
-#include "clang/AST/OperationKinds.h"
 #include "clang/AST/RecursiveASTVisitor.h"
-#include "clang/Basic/Diagnostic.h"
 #include "misracpp2008.h"
-#include <iostream>
 
 using namespace clang;
 
-namespace {
-template <typename T> Stmt *searchStmt(Stmt *S) {
-
-  Stmt *b{nullptr};
-  if (!S)
-    return b;
-
-  if (isa<T>(S)) {
-    return S;
-  }
-
-  for (auto c : S->children()) {
-    b = searchStmt<T>(c);
-    if (b) {
-      return b;
-    }
-  }
-
-  return b;
-}
-}
-
 namespace misracpp2008 {
 
 class Rule_15_5_1 : public RuleCheckerASTContext,
@@ -51,23 +27,11 @@ public:
       return true;
     }
 
-    Stmt *t{nullptr}, *p{nullptr};
-
-    p = D->getBody();
-
-    if (p) {
-      if (Stmt *throwStmt = searchStmt<CXXThrowExpr>(p)) {
-        t = throwStmt;
-      }
-    }
-    // dctor throws, check if there's a catch block
-    if (t && p) {
-      auto g = searchStmt<CXXCatchStmt>(p);
-      if (!g) {
-        reportError(t->getLocStart());
-      }
+    const ExceptionSummary &summary =
+        getSharedAnalysis<ExceptionSummaries>().getSummary(D);
+    for (const EscapingException &exception : summary.escaping) {
+      reportError(exception.site->getLocStart());
     }
-
     return true;
   };
 
@@ -0,0 +1,64 @@
+//===-  Rule_15_5_2.cpp - Checker for MISRA C++ 2008 rule 15-5-2-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ExceptionSummaries.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// Exceptions of unknown type, i.e. rethrown by catch-all handlers, are given
+// the benefit of the doubt.
+class Rule_15_5_2 : public RuleCheckerASTContext,
+                    public RecursiveASTVisitor<Rule_15_5_2> {
+public:
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (!decl->doesThisDeclarationHaveABody() ||
+        doIgnore(decl->getLocation())) {
+      return true;
+    }
+    const FunctionProtoType *proto =
+        decl->getType()->getAs<FunctionProtoType>();
+    if (proto == nullptr || !proto->hasDynamicExceptionSpec()) {
+      return true;
+    }
+
+    const ExceptionSummary &summary =
+        getSharedAnalysis<ExceptionSummaries>().getSummary(decl);
+    for (const EscapingException &exception : summary.escaping) {
+      if (!exception.type.isNull() && !isAllowed(*proto, exception.type)) {
+        reportError(exception.site->getLocStart());
+      }
+    }
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+
+private:
+  bool isAllowed(const FunctionProtoType &proto, QualType thrown) const {
+    for (QualType allowed : proto.exceptions()) {
+      if (ExceptionSummaries::isCaughtAs(
+              *context, thrown, allowed.getNonReferenceType()
+                                    .getCanonicalType()
+                                    .getUnqualifiedType())) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_15_5_2> X("15-5-2", "");
+}
@@ -0,0 +1,53 @@
+//===-  Rule_15_5_3.cpp - Checker for MISRA C++ 2008 rule 15-5-3-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ExceptionSummaries.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// terminate() is called when an exception leaves a function which may not
+// throw, e.g. one declared noexcept or throw(). The exception specification
+// of a destructor is only known once the destructor is used, the others are
+// left to rule 15-5-1.
+class Rule_15_5_3 : public RuleCheckerASTContext,
+                    public RecursiveASTVisitor<Rule_15_5_3> {
+public:
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (!decl->doesThisDeclarationHaveABody() ||
+        doIgnore(decl->getLocation())) {
+      return true;
+    }
+    const FunctionProtoType *proto =
+        decl->getType()->getAs<FunctionProtoType>();
+    if (proto == nullptr ||
+        isUnresolvedExceptionSpec(proto->getExceptionSpecType()) ||
+        !proto->isNothrow(*context)) {
+      return true;
+    }
+
+    const ExceptionSummary &summary =
+        getSharedAnalysis<ExceptionSummaries>().getSummary(decl);
+    for (const EscapingException &exception : summary.escaping) {
+      reportError(exception.site->getLocStart());
+    }
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_15_5_3> X("15-5-3", "");
+}
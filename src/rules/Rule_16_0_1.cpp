@@ -0,0 +1,24 @@
+//===-  Rule_16_0_1.cpp - Checker for MISRA C++ 2008 rule 16-0-1-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IncludePolicyChecker.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_16_0_1 : public IncludePolicyChecker {
+protected:
+  virtual void checkInclusion(const InclusionRecord &inclusion) override {
+    if (inclusion.is(InclusionRecord::FollowsCode)) {
+      reportError(inclusion.hashLoc);
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_0_1> X("16-0-1", "");
+}
@@ -0,0 +1,83 @@
+//===-  Rule_16_0_2.cpp - Checker for MISRA C++ 2008 rule 16-0-2-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "MacroPolicyChecker.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Decl.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/Basic/SourceManager.h"
+#include <algorithm>
+#include <vector>
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// The preprocessor does not know about namespaces, so the directives recorded
+// while preprocessing are compared to the top level declarations of the
+// translation unit afterwards.
+class Rule_16_0_2 : public MacroPolicyChecker, public RuleCheckerASTContext {
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    const SourceManager &SM = context->getSourceManager();
+    std::vector<SourceRange> scopes;
+    collectScopes(context->getTranslationUnitDecl(), scopes);
+    std::sort(scopes.begin(), scopes.end(),
+              [&SM](const SourceRange &lhs, const SourceRange &rhs) {
+                return SM.isBeforeInTranslationUnit(lhs.getBegin(),
+                                                    rhs.getBegin());
+              });
+
+    // Both the directives and the scopes are in translation unit order, so a
+    // single sweep finds the scopes a directive is located in.
+    auto scope = scopes.begin();
+    SourceLocation scopesEnd;
+    for (const MacroRecord &record :
+         getSharedAnalysis<MacroTable>().getRecords()) {
+      for (; scope != scopes.end() &&
+             SM.isBeforeInTranslationUnit(scope->getBegin(), record.nameLoc);
+           ++scope) {
+        if (scopesEnd.isInvalid() ||
+            SM.isBeforeInTranslationUnit(scopesEnd, scope->getEnd())) {
+          scopesEnd = scope->getEnd();
+        }
+      }
+      if (scopesEnd.isValid() &&
+          SM.isBeforeInTranslationUnit(record.nameLoc, scopesEnd)) {
+        reportError(record.nameLoc);
+      }
+    }
+  }
+
+private:
+  /// \brief Collect the source ranges of the declarations at global scope.
+  /// Linkage specifications do not open a namespace.
+  void collectScopes(const DeclContext *declContext,
+                     std::vector<SourceRange> &scopes) {
+    const SourceManager &SM = context->getSourceManager();
+    for (const Decl *decl : declContext->decls()) {
+      if (const LinkageSpecDecl *linkageSpec =
+              dyn_cast<LinkageSpecDecl>(decl)) {
+        collectScopes(linkageSpec, scopes);
+        continue;
+      }
+      if (decl->isImplicit()) {
+        continue;
+      }
+      const SourceRange range(SM.getExpansionLoc(decl->getLocStart()),
+                              SM.getExpansionRange(decl->getLocEnd()).second);
+      if (range.isValid()) {
+        scopes.push_back(range);
+      }
+    }
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_16_0_2> X("16-0-2", "");
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_0_2> Y("16-0-2", "");
+}
@@ -0,0 +1,24 @@
+//===-  Rule_16_0_6.cpp - Checker for MISRA C++ 2008 rule 16-0-6-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "MacroPolicyChecker.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_16_0_6 : public MacroPolicyChecker {
+protected:
+  virtual void checkMacro(const MacroRecord &record) override {
+    if (record.is(MacroRecord::HasUnparenthesizedParameter)) {
+      reportError(record.unparenthesizedParameterLoc);
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_0_6> X("16-0-6", "");
+}
@@ -0,0 +1,30 @@
+//===-  Rule_16_0_7.cpp - Checker for MISRA C++ 2008 rule 16-0-7-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ConditionalDirectiveChecker.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_16_0_7 : public ConditionalDirectiveChecker {
+protected:
+  virtual void checkDirective(const ConditionalDirective &directive) override {
+    if (directive.kind != ConditionalDirective::If &&
+        directive.kind != ConditionalDirective::Elif) {
+      return;
+    }
+    for (SourceLocation loc :
+         getSharedAnalysis<ConditionalDirectiveTracker>()
+             .getUndefinedIdentifiers(directive)) {
+      reportError(loc);
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_0_7> X("16-0-7", "");
+}
@@ -0,0 +1,28 @@
+//===-  Rule_16_1_1.cpp - Checker for MISRA C++ 2008 rule 16-1-1-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ConditionalDirectiveChecker.h"
+#include "clang/Basic/SourceManager.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// Malformed uses of the defined operator do not compile, the one left is
+// defined being the result of a macro expansion.
+class Rule_16_1_1 : public ConditionalDirectiveChecker {
+protected:
+  virtual void checkDirective(const ConditionalDirective &directive) override {
+    const SourceManager &SM = CI->getSourceManager();
+    for (SourceLocation loc : directive.expandedDefinedOperators) {
+      reportError(SM.getExpansionLoc(loc));
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_1_1> X("16-1-1", "");
+}
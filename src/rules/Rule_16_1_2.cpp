@@ -0,0 +1,27 @@
+//===-  Rule_16_1_2.cpp - Checker for MISRA C++ 2008 rule 16-1-2-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ConditionalDirectiveChecker.h"
+#include "clang/Basic/SourceManager.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_16_1_2 : public ConditionalDirectiveChecker {
+protected:
+  virtual void checkDirective(const ConditionalDirective &directive) override {
+    const SourceManager &SM = CI->getSourceManager();
+    if (directive.kind != ConditionalDirective::If &&
+        SM.getFileID(directive.loc) != SM.getFileID(directive.ifLoc)) {
+      reportError(directive.loc);
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_1_2> X("16-1-2", "");
+}
@@ -0,0 +1,26 @@
+//===-  Rule_16_2_2.cpp - Checker for MISRA C++ 2008 rule 16-2-2-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "MacroPolicyChecker.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// Include guards are empty object-like macros.
+class Rule_16_2_2 : public MacroPolicyChecker {
+protected:
+  virtual void checkMacro(const MacroRecord &record) override {
+    if (!record.is(MacroRecord::IsUndefinition) &&
+        !record.is(MacroRecord::ExpandsToSpecifiers)) {
+      reportError(record.nameLoc);
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_2_2> X("16-2-2", "");
+}
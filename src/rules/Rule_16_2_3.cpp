@@ -0,0 +1,41 @@
+//===-  Rule_16_2_3.cpp - Checker for MISRA C++ 2008 rule 16-2-3-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IncludePolicyChecker.h"
+#include "clang/Basic/SourceManager.h"
+#include "llvm/ADT/SmallPtrSet.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// Whether a header is guarded is only known once the preprocessor has left it,
+// so the headers get checked at the end of the translation unit.
+class Rule_16_2_3 : public IncludePolicyChecker {
+public:
+  virtual void EndOfMainFile() override {
+    const IncludeTracker &tracker = getSharedAnalysis<IncludeTracker>();
+    const SourceManager &SM = CI->getSourceManager();
+    llvm::SmallPtrSet<const FileEntry *, 32> checkedFiles;
+    for (const InclusionRecord &inclusion : tracker.getInclusions()) {
+      if (inclusion.file == nullptr ||
+          checkedFiles.insert(inclusion.file).second == false) {
+        continue;
+      }
+      if (doIgnore(inclusion.hashLoc) ||
+          doIgnore(SM.translateFileLineCol(inclusion.file, 1, 1))) {
+        continue;
+      }
+      if (tracker.isGuarded(inclusion.file) == false) {
+        reportError(inclusion.hashLoc);
+      }
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_2_3> X("16-2-3", "");
+}
@@ -0,0 +1,27 @@
+//===-  Rule_16_2_4.cpp - Checker for MISRA C++ 2008 rule 16-2-4-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IncludePolicyChecker.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_16_2_4 : public IncludePolicyChecker {
+protected:
+  virtual void checkInclusion(const InclusionRecord &inclusion) override {
+    const StringRef fileName = inclusion.fileName;
+    if (fileName.find_first_of("'\"") != StringRef::npos ||
+        fileName.find("/*") != StringRef::npos ||
+        fileName.find("//") != StringRef::npos) {
+      reportError(inclusion.hashLoc);
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_2_4> X("16-2-4", "");
+}
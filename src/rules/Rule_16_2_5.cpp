@@ -0,0 +1,24 @@
+//===-  Rule_16_2_5.cpp - Checker for MISRA C++ 2008 rule 16-2-5-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IncludePolicyChecker.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_16_2_5 : public IncludePolicyChecker {
+protected:
+  virtual void checkInclusion(const InclusionRecord &inclusion) override {
+    if (inclusion.fileName.find('\\') != StringRef::npos) {
+      reportError(inclusion.hashLoc);
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_2_5> X("16-2-5", "");
+}
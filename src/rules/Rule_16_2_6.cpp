@@ -0,0 +1,26 @@
+//===-  Rule_16_2_6.cpp - Checker for MISRA C++ 2008 rule 16-2-6-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IncludePolicyChecker.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// A macro expanding to a header name is fine, but nothing may follow the
+// header name.
+class Rule_16_2_6 : public IncludePolicyChecker {
+protected:
+  virtual void checkInclusion(const InclusionRecord &inclusion) override {
+    if (inclusion.is(InclusionRecord::HasTrailingTokens)) {
+      reportError(inclusion.hashLoc);
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_16_2_6> X("16-2-6", "");
+}
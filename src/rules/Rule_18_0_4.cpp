@@ -5,19 +5,17 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "clang/AST/ASTContext.h"
+#include "BannedFunctionUsageChecker.h"
+#include "IncludeTracker.h"
 #include "clang/Lex/PPCallbacks.h"
-#include "misracpp2008.h"
-#include <string>
 
 using namespace clang;
 
 namespace misracpp2008 {
 
-class Rule_18_0_4 : public RuleCheckerPPCallback {
-private:
-  static const std::set<std::string> illegalIncludes;
-
+// Besides including <ctime>, using the time handling functions gets reported,
+// as they may be declared by other headers, too.
+class Rule_18_0_4 : public BannedFunctionUsageChecker {
 public:
   virtual void InclusionDirective(SourceLocation HashLoc,
                                   const Token &IncludeTok, StringRef FileName,
@@ -25,17 +23,15 @@ public:
                                   const FileEntry *File, StringRef SearchPath,
                                   StringRef RelativePath,
                                   const Module *Imported) override {
-    if (doIgnore(HashLoc)) {
-      return;
-    }
-
-    if (illegalIncludes.count(FileName)) {
+    const InclusionRecord &inclusion =
+        getSharedAnalysis<IncludeTracker>().record(HashLoc, FileName, IsAngled,
+                                                   FilenameRange, File);
+    if (inclusion.banningRule == name && doIgnore(HashLoc) == false) {
       reportError(HashLoc);
     }
   }
 };
 
-const std::set<std::string> Rule_18_0_4::illegalIncludes = {"ctime"};
-
-static RuleCheckerPreprocessorRegistry::Add<Rule_18_0_4> X("18-0-4", "");
+static RuleCheckerASTContextRegistry::Add<Rule_18_0_4> X("18-0-4", "");
+static RuleCheckerPreprocessorRegistry::Add<Rule_18_0_4> Y("18-0-4", "");
 }
@@ -5,36 +5,14 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "clang/Basic/IdentifierTable.h"
-#include "clang/Lex/Token.h"
-#include "misracpp2008.h"
-#include <string>
+#include "BannedFunctionUsageChecker.h"
 
 using namespace clang;
 
 namespace misracpp2008 {
 
-class Rule_19_3_1 : public RuleCheckerPPCallback {
-private:
-  static const std::string illegalMacroName;
-
-public:
-  // errno is a macro.
-  virtual void MacroExpands(const Token &MacroNameTok,
-                            const MacroDefinition &MD, SourceRange Range,
-                            const MacroArgs *Args) override {
-    const std::string &name = MacroNameTok.getIdentifierInfo()->getName();
-    if (name == illegalMacroName) {
-      if (doIgnore(MacroNameTok.getLastLoc())) {
-        return;
-      }
-
-      reportError(Range.getBegin());
-    }
-  }
-};
-
-const std::string Rule_19_3_1::illegalMacroName = "errno";
+// errno is a macro.
+class Rule_19_3_1 : public BannedFunctionUsageChecker {};
 
 static RuleCheckerPreprocessorRegistry::Add<Rule_19_3_1> X("19-3-1", "");
 }
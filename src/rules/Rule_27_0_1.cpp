@@ -5,36 +5,20 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "clang/Basic/SourceManager.h"
-#include "misracpp2008.h"
-#include <string>
+#include "IncludePolicyChecker.h"
 
 using namespace clang;
 
 namespace misracpp2008 {
 
-class Rule_27_0_1 : public RuleCheckerPPCallback {
-private:
-  static const std::set<std::string> illegalIncludes;
-
-public:
-  virtual void InclusionDirective(SourceLocation HashLoc,
-                                  const Token &IncludeTok, StringRef FileName,
-                                  bool IsAngled, CharSourceRange FilenameRange,
-                                  const FileEntry *File, StringRef SearchPath,
-                                  StringRef RelativePath,
-                                  const Module *Imported) override {
-    if (doIgnore(HashLoc)) {
-      return;
-    }
-
-    if (illegalIncludes.count(FileName)) {
-      reportError(HashLoc);
+class Rule_27_0_1 : public IncludePolicyChecker {
+protected:
+  virtual void checkInclusion(const InclusionRecord &inclusion) override {
+    if (inclusion.banningRule == name) {
+      reportError(inclusion.hashLoc);
     }
   }
 };
 
-const std::set<std::string> Rule_27_0_1::illegalIncludes = {"cstdio"};
-
 static RuleCheckerPreprocessorRegistry::Add<Rule_27_0_1> X("27-0-1", "");
 }
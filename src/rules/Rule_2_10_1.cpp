@@ -5,144 +5,153 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "clang/AST/ASTContext.h"
-#include "clang/AST/RecursiveASTVisitor.h"
+#include "DeclaredIdentifiers.h"
+#include "clang/AST/Decl.h"
 #include "clang/Basic/Diagnostic.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/Hashing.h"
+#include "llvm/ADT/SmallString.h"
+#include "llvm/ADT/SmallVector.h"
 #include "misracpp2008.h"
-#include <algorithm>
-#include <cstring>
-#include <functional>
-#include <locale>
-#include <map>
-#include <string>
+#include <cstdint>
+#include <utility>
 
 using namespace clang;
-using std::string;
+using llvm::StringRef;
 
 namespace misracpp2008 {
 
-class Rule_2_10_1 : public RuleCheckerASTContext,
-                    public RecursiveASTVisitor<Rule_2_10_1> {
+/// \brief Checker for rule 2-10-1.
+///
+/// Replays the declaration walk shared with the other identifier rules.
+/// Identifiers are compared with the ones of the same semantic scope, so
+/// look-alike identifiers of different namespaces or classes do not collide,
+/// just as if their qualified names were compared. The skeletons are indexed
+/// by scope and hash of the skeleton of the plain identifier.
+class Rule_2_10_1 : public RuleCheckerASTContext {
 public:
   Rule_2_10_1() : RuleCheckerASTContext() {}
 
-  bool TraverseDecl(Decl *D) {
-    const DeclContext *DC = dyn_cast_or_null<DeclContext>(D);
-    const bool isNewContext = DC && !DC->isTransparentContext();
+  void scopeEntered(const DeclContext *DC, bool isSemanticParent) {}
 
-    if (isNewContext) {
-      str2decls.emplace_back(Str2Decls());
-    }
-
-    const bool retVal = RecursiveASTVisitor<Rule_2_10_1>::TraverseDecl(D);
+  void scopeLeft(const DeclContext *DC) {}
 
-    if (isNewContext) {
-      str2decls.pop_back();
-    }
-
-    return retVal;
-  }
-
-  bool VisitNamedDecl(const NamedDecl *D) {
+  void declared(const NamedDecl *D, unsigned depth) {
     if (doIgnore(D->getLocation())) {
-      return true;
+      return;
     }
 
-    assert(!str2decls.empty() &&
-           "At least one DeclContext must be on the stack!");
-
     // If the decl has no name, no collision can happen. Bail out.
     // This may be the case for constructs like this:
     // typedef struct { int i; } MyStruct;
     if (!D->getIdentifier() || D->getName().empty()) {
-      return true;
+      return;
     }
 
     // FunctionDecl which belong to a FunctionTemplateDecl should not be
     // checked separately
     if (const FunctionDecl *FD = dyn_cast<FunctionDecl>(D)) {
       if (FD->getTemplatedKind() != FunctionDecl::TK_NonTemplate) {
-        return true;
+        return;
       }
     }
 
-    const string fullQualIdent = D->getQualifiedNameAsString();
-    const string normalizedIdent = normalizeIdent(fullQualIdent);
+    // Reopened namespaces and the definition of a class share their primary
+    // context with the other declarations.
+    const DeclContext *scope =
+        D->getDeclContext()->getRedeclContext()->getPrimaryContext();
+    llvm::SmallString<64> skeleton;
+    computeSkeleton(D->getName(), skeleton);
+    auto &lookalikeIdentifiers =
+        skeletons[std::make_pair(scope, hashSkeleton(skeleton))];
 
     bool reportedError = false;
-    for (const Str2Decls &s2d : str2decls) {
-      auto lookalikeIdentifiers = s2d.equal_range(normalizedIdent);
-      // Add notes about ambiguous identifiers
-      for (Str2Decls::const_iterator I = lookalikeIdentifiers.first;
-           I != lookalikeIdentifiers.second; ++I) {
-        const NamedDecl *previousNamedDecl = I->second;
-        // Do not report errors on identifiers with exact the same name, e.g.
-        // overloads
-        if (previousNamedDecl->getName() == D->getName()) {
-          continue;
-        }
-        // Report error just once, even when multiple typographically close
-        // identifiers are in one of the parent decl contextes.
-        if (!reportedError) {
-          reportError(D->getLocation());
-          reportedError = true;
-        }
-        report(previousNamedDecl->getLocation(),
-               "Typographically too close to '%0'",
-               clang::DiagnosticsEngine::Note)
-            << D->getName();
+    for (const SkeletonEntry &entry : lookalikeIdentifiers) {
+      // Equal hashes do not guarantee equal skeletons.
+      if (entry.skeleton != skeleton) {
+        continue;
+      }
+      const NamedDecl *previousNamedDecl = entry.decl;
+      // Do not report errors on identifiers with exact the same name, e.g.
+      // overloads
+      if (previousNamedDecl->getName() == D->getName()) {
+        continue;
+      }
+      // Report error just once, even when multiple typographically close
+      // identifiers are in the scope.
+      if (!reportedError) {
+        reportError(D->getLocation());
+        reportedError = true;
       }
+      report(previousNamedDecl->getLocation(),
+             "Typographically too close to '%0'",
+             clang::DiagnosticsEngine::Note)
+          << D->getName();
     }
 
-    str2decls.back().insert(std::make_pair(normalizedIdent, D));
-
-    return true;
+    lookalikeIdentifiers.push_back(SkeletonEntry{copyToArena(skeleton), D});
   }
 
 private:
-  const std::vector<std::pair<string, string>> replaceMap = {
-      {"RN", "M"}, // rn (string) to m (letter)
-      {"O", "0"},  // O (letter) to 0 (number)
-      {"L", "1"},  // l (letter) to 1 (number)
-      {"I", "1"},  // I (letter) to 1 (number)
-      {"S", "5"},  // S (letter) to 5 (number)
-      {"Z", "2"},  // Z (letter) to 2 (number)
-      {"N", "H"},  // n (letter) to h (number)
-      {"B", "8"},  // B (letter) to 8 (number)
-      {"_", ""}    // remove the underscore
+  struct SkeletonEntry {
+    StringRef skeleton; ///< Skeleton, allocated in the checker arena.
+    const NamedDecl *decl;
   };
-  using Str2Decls = std::multimap<string, const NamedDecl *>;
-  std::vector<Str2Decls> str2decls;
-
-  static void replaceSubStr(string &str, const string &from, const string &to) {
-    for (string::size_type pos = str.find(from); pos != string::npos;
-         pos = str.find(from)) {
-      str.replace(pos, from.length(), to);
+  llvm::DenseMap<std::pair<const DeclContext *, uint64_t>,
+                 llvm::SmallVector<SkeletonEntry, 1>>
+      skeletons;
+
+  /// \brief Translation table for computeSkeleton(). Maps each character to
+  /// its upper case look-alike, or to '\0' if it is to be dropped.
+  struct SkeletonTable {
+    char map[256];
+
+    SkeletonTable() {
+      for (unsigned c = 0; c < 256; ++c) {
+        map[c] = (c >= 'a' && c <= 'z') ? static_cast<char>(c - 'a' + 'A')
+                                         : static_cast<char>(c);
+      }
+      map['O'] = map['o'] = '0'; // O (letter) to 0 (number)
+      map['L'] = map['l'] = '1'; // l (letter) to 1 (number)
+      map['I'] = map['i'] = '1'; // I (letter) to 1 (number)
+      map['S'] = map['s'] = '5'; // S (letter) to 5 (number)
+      map['Z'] = map['z'] = '2'; // Z (letter) to 2 (number)
+      map['N'] = map['n'] = 'H'; // n (letter) to h (letter)
+      map['B'] = map['b'] = '8'; // B (letter) to 8 (number)
+      map['_'] = '\0';           // remove the underscore
     }
-  }
+  };
 
-  string normalizeIdent(const string inputStr) {
-    string preparedString;
-    // Make string uppercase
-    std::transform(inputStr.begin(), inputStr.end(),
-                   std::back_inserter(preparedString),
-                   std::bind(&std::toupper<string::value_type>,
-                             std::placeholders::_1, std::locale()));
-
-    // Apply substitutions
-    for (const auto &replace : replaceMap) {
-      const string &from = replace.first;
-      const string &to = replace.second;
-      replaceSubStr(preparedString, from, to);
+  /// \brief Compute the skeleton of \c ident in a single pass. Identifiers
+  /// with the same skeleton are typographically ambiguous.
+  static void computeSkeleton(StringRef ident,
+                              llvm::SmallVectorImpl<char> &skeleton) {
+    static const SkeletonTable table;
+    skeleton.clear();
+    for (size_t i = 0, e = ident.size(); i != e; ++i) {
+      const char c = ident[i];
+      // rn (string) to m (letter)
+      if ((c == 'r' || c == 'R') && i + 1 != e &&
+          (ident[i + 1] == 'n' || ident[i + 1] == 'N')) {
+        skeleton.push_back('M');
+        ++i;
+        continue;
+      }
+      const char mapped = table.map[static_cast<unsigned char>(c)];
+      if (mapped != '\0') {
+        skeleton.push_back(mapped);
+      }
     }
+  }
 
-    return preparedString;
+  static uint64_t hashSkeleton(StringRef skeleton) {
+    return static_cast<uint64_t>(llvm::hash_value(skeleton));
   }
 
 protected:
   virtual void doWork() override {
     RuleCheckerASTContext::doWork();
-    this->TraverseDecl(context->getTranslationUnitDecl());
+    getSharedAnalysis<DeclaredIdentifiers>().replay(*this);
   }
 };
 
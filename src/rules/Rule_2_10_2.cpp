@@ -5,97 +5,164 @@
 //
 //===----------------------------------------------------------------------===//
 
-#include "clang/AST/ASTContext.h"
-#include "clang/AST/RecursiveASTVisitor.h"
+#include "DeclaredIdentifiers.h"
+#include "clang/AST/Decl.h"
+#include "clang/AST/DeclTemplate.h"
 #include "clang/Basic/Diagnostic.h"
+#include "clang/Basic/IdentifierTable.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
 #include "misracpp2008.h"
 #include <algorithm>
-#include <cstring>
-#include <functional>
-#include <map>
-#include <string>
 
 using namespace clang;
 
 namespace misracpp2008 {
 
-class Rule_2_10_2 : public RuleCheckerASTContext,
-                    public RecursiveASTVisitor<Rule_2_10_2> {
+/// \brief Checker for rule 2-10-2.
+///
+/// Instead of looking up every declared name in all the enclosing
+/// DeclContexts, the checker keeps the names declared in each of the scopes
+/// entered during the traversal. For each identifier, the declarations still
+/// in scope are kept ordered by scope depth, so finding a declaration in an
+/// outer scope usually boils down to looking at the last entry. The scopes
+/// and declarations come from the declaration walk shared with the other
+/// identifier rules.
+class Rule_2_10_2 : public RuleCheckerASTContext {
 public:
   Rule_2_10_2() : RuleCheckerASTContext() {}
 
-  bool VisitNamedDecl(const NamedDecl *decl) {
-    // Bail out early if this location should not be checked.
-    if (doIgnore(decl->getLocation())) {
-      return true;
+  void scopeEntered(const DeclContext *DC, bool isSemanticParent) {
+    scopes.emplace_back();
+    // Members of a class are in scope in the whole class, not only after
+    // their declaration. For out-of-line definitions, the members of the
+    // semantic parents are in scope as well, even though the traversal never
+    // entered them.
+    if (isSemanticParent || isa<RecordDecl>(DC)) {
+      declareMembers(DC);
     }
+  }
 
-    const DeclarationName &declN = decl->getDeclName();
-    // Bail out if the declaration is an operator (while all having the name
-    // "operator", none of them constitute a violation)
-    if (declN.getCXXOverloadedOperator() != OO_None) {
-      return true;
+  void scopeLeft(const DeclContext *DC) {
+    const unsigned depth = scopes.size() - 1;
+    for (const IdentifierInfo *identifier : scopes.back().names) {
+      auto it = declarations.find(identifier);
+      assert(it != declarations.end() && "Declared names must be indexed.");
+      auto &decls = it->second;
+      decls.erase(std::remove_if(decls.begin(), decls.end(),
+                                 [depth](const Declaration &declaration) {
+                                   return declaration.depth >= depth;
+                                 }),
+                  decls.end());
+      if (decls.empty()) {
+        declarations.erase(it);
+      }
     }
+    scopes.pop_back();
+  }
 
-    // Walk up till we reach the outermost scope, check each one for a
-    // declaration with the same name.
-    for (const DeclContext *outerScope = decl->getDeclContext()->getParent();
-         outerScope != nullptr; outerScope = outerScope->getParent()) {
-      // If e.g. extern "C" gets found, simply continue with the surrounding
-      // scope.
-      if (isa<LinkageSpecDecl>(outerScope)) {
-        continue;
-      }
+  void declared(const NamedDecl *decl, unsigned depth) {
+    // Declarations without a plain identifier, e.g. operators, constructors
+    // or unnamed entities, can not hide anything.
+    const IdentifierInfo *identifier = decl->getIdentifier();
+    if (!identifier) {
+      return;
+    }
 
-      // If we can not find a declaration with the same name as we have,
-      // move one scope up.
-      DeclContext::lookup_result result = outerScope->lookup(declN);
-      if (result.empty()) {
-        continue;
-      }
+    // Out-of-line definitions have already been dealt with when their
+    // declaration has been visited.
+    if (decl->getDeclContext() != decl->getLexicalDeclContext()) {
+      return;
+    }
 
-      // Move one scope up if we find ourselves.
-      if (std::find(result.begin(), result.end(), decl) != result.end()) {
-        continue;
+    // Bail out early if this location should not be checked. The name is
+    // nevertheless recorded, it may be hidden by checked code.
+    if (!doIgnore(decl->getLocation())) {
+      if (const NamedDecl *hiddenDecl =
+              findOuterDeclaration(identifier, depth, decl)) {
+        // Report location of the offending and the shadowed declaration.
+        reportError(decl->getLocation());
+        report(hiddenDecl->getLocation(),
+               "Previous occurence of identifier '%0'",
+               clang::DiagnosticsEngine::Note)
+            << identifier->getName();
       }
+    }
 
-      // Deal with linkage declarations e.g. 'extern "C"'
-      if (isRedeclaration<FunctionDecl>(decl, result) ||
-          isRedeclaration<VarDecl>(decl, result) ||
-          isRedeclaration<TagDecl>(decl, result)) {
-        continue;
+    // Template parameters are not members of their DeclContext and
+    // therefore can not be hidden by an inner declaration.
+    if (!isa<TemplateTypeParmDecl>(decl) &&
+        !isa<NonTypeTemplateParmDecl>(decl) &&
+        !isa<TemplateTemplateParmDecl>(decl)) {
+      declare(identifier, depth, decl);
+    }
+  }
+
+private:
+  /// \brief Names declared in a scope entered during the traversal, used to
+  /// clean up on leaving it.
+  struct Scope {
+    llvm::SmallPtrSet<const IdentifierInfo *, 8> names;
+  };
+
+  /// \brief A declaration which is still in scope.
+  struct Declaration {
+    unsigned depth;
+    const NamedDecl *decl;
+  };
+
+  llvm::SmallVector<Scope, 16> scopes;
+  llvm::DenseMap<const IdentifierInfo *, llvm::SmallVector<Declaration, 2>>
+      declarations;
+
+  void declareMembers(const DeclContext *DC) {
+    const unsigned depth = scopes.size() - 1;
+    for (const Decl *member : DC->decls()) {
+      const NamedDecl *namedMember = dyn_cast<NamedDecl>(member);
+      if (namedMember && !namedMember->isImplicit() &&
+          namedMember->getIdentifier()) {
+        declare(namedMember->getIdentifier(), depth, namedMember);
       }
+    }
+  }
 
-      // All hope is lost - we have a shadowing declaration.
-      // Report location of the offending and the shadowed declaration.
-      reportError(decl->getLocation());
-      report(result[0]->getLocation(), "Previous occurence of identifier '%0'",
-             clang::DiagnosticsEngine::Note)
-          << declN.getAsString();
+  void declare(const IdentifierInfo *identifier, unsigned depth,
+               const NamedDecl *decl) {
+    // Only the first declaration of a name per scope is of interest.
+    if (scopes[depth].names.insert(identifier).second) {
+      declarations[identifier].push_back(Declaration{depth, decl});
     }
-    return true;
   }
 
-private:
-  template <typename TDeclType>
-  bool isRedeclaration(const NamedDecl *declUnderTest,
-                       DeclContext::lookup_result results) {
-    using T = Redeclarable<TDeclType>;
-    for (const NamedDecl *d : results) {
-      if (auto i = dyn_cast<TDeclType>(d)) {
-        typename T::redecl_range r = i->redecls();
-        if (std::find(r.begin(), r.end(), declUnderTest) != r.end()) {
-          return true;
-        }
+  /// \brief Find the innermost declaration of \c identifier in a scope
+  /// enclosing the one at \c depth which is not a redeclaration of \c decl.
+  const NamedDecl *findOuterDeclaration(const IdentifierInfo *identifier,
+                                        unsigned depth,
+                                        const NamedDecl *decl) const {
+    auto it = declarations.find(identifier);
+    if (it == declarations.end()) {
+      return nullptr;
+    }
+    const auto &decls = it->second;
+    for (auto I = decls.rbegin(), E = decls.rend(); I != E; ++I) {
+      if (I->depth >= depth) {
+        continue;
+      }
+      // Deal with redeclarations, e.g. in linkage declarations like
+      // 'extern "C"' or block scope extern declarations.
+      if (I->decl->getCanonicalDecl() == decl->getCanonicalDecl()) {
+        continue;
       }
+      return I->decl;
     }
-    return false;
+    return nullptr;
   }
 
 protected:
   virtual void doWork() override {
     RuleCheckerASTContext::doWork();
-    this->TraverseDecl(context->getTranslationUnitDecl());
+    getSharedAnalysis<DeclaredIdentifiers>().replay(*this);
   }
 };
 
@@ -0,0 +1,17 @@
+//===-  Rule_2_10_3.cpp - Checker for MISRA C++ 2008 rule 2-10-3-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IdentifierCollisionChecker.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+/// \brief Checker for rule 2-10-3, reporting reused typedef names.
+class Rule_2_10_3 : public IdentifierCollisionChecker {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_2_10_3> X("2-10-3", "");
+}
@@ -0,0 +1,17 @@
+//===-  Rule_2_10_4.cpp - Checker for MISRA C++ 2008 rule 2-10-4-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IdentifierCollisionChecker.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+/// \brief Checker for rule 2-10-4, reporting reused class, union and enum names.
+class Rule_2_10_4 : public IdentifierCollisionChecker {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_2_10_4> X("2-10-4", "");
+}
@@ -0,0 +1,20 @@
+//===-  Rule_2_10_5.cpp - Checker for MISRA C++ 2008 rule 2-10-5-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "IdentifierCollisionChecker.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+/// \brief Checker for rule 2-10-5, reporting reused names of non-member
+/// objects and functions declared static or in an unnamed namespace, including
+/// static local variables. Names with external linkage are not checked, they
+/// name the same entity in all translation units anyway.
+class Rule_2_10_5 : public IdentifierCollisionChecker {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_2_10_5> X("2-10-5", "");
+}
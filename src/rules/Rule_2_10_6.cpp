@@ -0,0 +1,71 @@
+//===-  Rule_2_10_6.cpp - Checker for MISRA C++ 2008 rule 2-10-6-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "DeclaredIdentifiers.h"
+#include "clang/AST/Decl.h"
+#include "clang/Basic/Diagnostic.h"
+#include "clang/Basic/IdentifierTable.h"
+#include "llvm/ADT/DenseMap.h"
+#include "misracpp2008.h"
+#include <utility>
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+/// \brief Checker for rule 2-10-6.
+///
+/// Works on the identifiers collected for the uniqueness rules. Only
+/// namespace and class scopes are checked: the declarations of all the blocks
+/// of a function share the function as their DeclContext, so their scopes
+/// can not be told apart from the records.
+class Rule_2_10_6 : public RuleCheckerASTContext {
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    DeclaredIdentifiers &identifiers = getSharedAnalysis<DeclaredIdentifiers>();
+
+    // First type and first object or function of each name per scope.
+    llvm::DenseMap<std::pair<const DeclContext *, const IdentifierInfo *>,
+                   std::pair<const NamedDecl *, const NamedDecl *>>
+        firstDecls;
+    for (const IdentifierRecord &record : identifiers.getRecords()) {
+      const bool isType = record.kind == IdentifierKind::Typedef ||
+                          record.kind == IdentifierKind::Tag;
+      const bool isObjectOrFunction = record.kind == IdentifierKind::Object ||
+                                      record.kind == IdentifierKind::Function ||
+                                      record.kind == IdentifierKind::Member;
+      if (!isType && !isObjectOrFunction) {
+        continue;
+      }
+
+      const NamedDecl *decl = identifiers.getDecl(record);
+      const DeclContext *scope = decl->getDeclContext()->getRedeclContext();
+      if (!scope->isFileContext() && !scope->isRecord()) {
+        continue;
+      }
+
+      auto &entry = firstDecls[std::make_pair(scope, decl->getIdentifier())];
+      const NamedDecl *&first = isType ? entry.first : entry.second;
+      if (first) {
+        continue;
+      }
+      first = decl;
+
+      const NamedDecl *other = isType ? entry.second : entry.first;
+      if (other && !doIgnore(decl->getLocation())) {
+        reportError(decl->getLocation());
+        report(other->getLocation(), "Previous occurence of identifier '%0'",
+               clang::DiagnosticsEngine::Note)
+            << record.name;
+      }
+    }
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_2_10_6> X("2-10-6", "");
+}
@@ -0,0 +1,39 @@
+//===-  Rule_2_13_2.cpp - Checker for MISRA C++ 2008 rule 2-13-2-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "LexicalTokenTable.h"
+#include "clang/Basic/SourceManager.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+/// \brief Checker for rule 2-13-2.
+class Rule_2_13_2 : public RuleCheckerASTContext {
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    const SourceManager &sm = context->getSourceManager();
+    LexicalTokenTable &tokens = getSharedAnalysis<LexicalTokenTable>();
+    for (FileID fileID : tokens.getFiles()) {
+      const SourceLocation fileStart = sm.getLocForStartOfFile(fileID);
+      if (doIgnore(fileStart)) {
+        continue;
+      }
+      for (const LiteralToken &literal : tokens.getLexedFile(fileID).literals) {
+        if (literal.is(LiteralToken::IsNonZeroOctal) ||
+            literal.is(LiteralToken::HasOctalEscape)) {
+          reportError(fileStart.getLocWithOffset(literal.offset));
+        }
+      }
+    }
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_2_13_2> X("2-13-2", "");
+}
@@ -5,14 +5,12 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "LexicalTokenTable.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/Basic/Diagnostic.h"
-#include "clang/Lex/Lexer.h"
 #include "llvm/ADT/APInt.h"
 #include "misracpp2008.h"
-#include <algorithm>
-#include <sstream>
 
 using namespace clang;
 
@@ -91,18 +89,18 @@ private:
     return true;
   }
 
-  bool isUnsignedIntegerLiteral(const IntegerLiteral *il) {
-    llvm::APSInt result;
-    il->EvaluateAsInt(result, *context, Expr::SE_NoSideEffects);
-    return result.isUnsigned();
+  /// \brief The signedness of a literal is the one of its type, there is
+  /// nothing to evaluate.
+  static bool isUnsignedIntegerLiteral(const IntegerLiteral *il) {
+    return il->getType()->isUnsignedIntegerType();
   }
 
   /// \brief Make sure the suffix 'U' exists.
   /// \param il Unsigned integer literal.
   void dealWithUnsignedInteger(const IntegerLiteral *il) {
-    // See if one char after the integer literal is a "U"
-    std::string lexem = srcLocToString(il->getLocStart());
-    if (lexem.rfind("U") == std::string::npos) {
+    const LiteralToken *literal =
+        getSharedAnalysis<LexicalTokenTable>().getLiteral(il->getLocStart());
+    if (literal && !literal->is(LiteralToken::HasUpperCaseUSuffix)) {
       reportError(il->getLocation());
     }
   }
@@ -5,13 +5,10 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "LexicalTokenTable.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/RecursiveASTVisitor.h"
-#include "clang/Basic/SourceLocation.h"
-#include "clang/Basic/SourceManager.h"
-#include "clang/Lex/LiteralSupport.h"
 #include "misracpp2008.h"
-#include <string>
 
 using namespace clang;
 
@@ -33,15 +30,9 @@ public:
       return true;
     }
 
-    using std::string;
-    const SourceManager &sm = context->getSourceManager();
-    const SourceLocation spellingLoc = sm.getSpellingLoc(expr->getLocStart());
-    const string lexem = srcLocToString(spellingLoc);
-    const NumericLiteralParser nlp(lexem, spellingLoc, CI->getPreprocessor());
-
-    if ((nlp.isUnsigned && lexem.find("u") != string::npos) ||
-        (nlp.isFloat && lexem.find("f") != string::npos) ||
-        ((nlp.isLong || nlp.isLongLong) && lexem.find("l") != string::npos)) {
+    const LiteralToken *literal =
+        getSharedAnalysis<LexicalTokenTable>().getLiteral(expr->getLocStart());
+    if (literal && literal->is(LiteralToken::HasLowerCaseSuffix)) {
       reportError(expr->getLocEnd());
     }
 
@@ -5,11 +5,11 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "LexicalTokenTable.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/Basic/Diagnostic.h"
 #include "misracpp2008.h"
-#include <string>
 
 using namespace clang;
 
@@ -48,12 +48,9 @@ protected:
   }
 
   bool isWideStringLiteralPart(const SourceLocation &loc) {
-    const clang::SourceManager &sm = context->getSourceManager();
-    const SourceLocation spellingLoc = sm.getSpellingLoc(loc);
-    const std::string lexem = srcLocToString(spellingLoc);
-    assert(lexem.size() > 0 &&
-           "Lexems for string literals are at least 2 chars wide.");
-    return lexem[0] == 'L';
+    const LiteralToken *literal =
+        getSharedAnalysis<LexicalTokenTable>().getLiteral(loc);
+    return literal && literal->prefix == LiteralToken::WidePrefix;
   }
 };
 
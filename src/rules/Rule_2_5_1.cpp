@@ -0,0 +1,36 @@
+//===-  Rule_2_5_1.cpp - Checker for MISRA C++ 2008 rule 2-5-1-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "LexicalTokenTable.h"
+#include "clang/Basic/SourceManager.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+/// \brief Checker for rule 2-5-1.
+class Rule_2_5_1 : public RuleCheckerASTContext {
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    const SourceManager &sm = context->getSourceManager();
+    LexicalTokenTable &tokens = getSharedAnalysis<LexicalTokenTable>();
+    for (FileID fileID : tokens.getFiles()) {
+      const SourceLocation fileStart = sm.getLocForStartOfFile(fileID);
+      if (doIgnore(fileStart)) {
+        continue;
+      }
+      for (unsigned offset : tokens.getLexedFile(fileID).digraphs) {
+        reportError(fileStart.getLocWithOffset(offset));
+      }
+    }
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_2_5_1> X("2-5-1", "");
+}
@@ -0,0 +1,26 @@
+//===-  Rule_2_7_2.cpp - Checker for MISRA C++ 2008 rule 2-7-2-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "CommentChecker.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_2_7_2 : public CommentChecker {
+protected:
+  virtual void checkComment(const CommentRecord &comment,
+                            SourceLocation loc) override {
+    if (comment.is(CommentRecord::IsCStyle) &&
+        comment.is(CommentRecord::LooksLikeCode)) {
+      reportError(loc);
+    }
+  }
+};
+
+static RuleCheckerPreprocessorRegistry::Add<Rule_2_7_2> X("2-7-2", "");
+}
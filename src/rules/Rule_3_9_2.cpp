@@ -5,10 +5,10 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "TypeClassification.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/Basic/Diagnostic.h"
-#include "llvm/ADT/StringExtras.h"
 #include "misracpp2008.h"
 
 using namespace clang;
@@ -26,38 +26,17 @@ public:
       return true;
     }
 
-    const QualType qualType = D->getType();
+    const TypeClass typeClass =
+        getSharedAnalysis<TypeClassification>().classify(D->getType());
     // Bail out if this type is either an enum or does not look like a real
     // value.
-    if (qualType->isEnumeralType() || qualType->isBooleanType() ||
-        qualType->isArithmeticType() == false) {
+    if (typeClass.is(TypeClass::IsEnum) || typeClass.is(TypeClass::IsBool) ||
+        !typeClass.is(TypeClass::IsArithmetic)) {
       return true;
     }
 
-    const Type *t = qualType.getTypePtrOrNull();
-    assert(t && "Type of arithmetic types has to be available.");
-    const std::string typeName = qualType.getAsString();
-    // If it is of the same type as "size_t" and does have "size_t" somewhere in
-    // its name we can go with it.
-    // Please note: This also allows a typedef for "unsigned long" to be named
-    // e.g. "size_type" without any size indicator - which may or may not be a
-    // good thing.
-    if (context->hasSameUnqualifiedType(qualType, context->getSizeType()) &&
-        typeName.find("size_t") != std::string::npos) {
-      return true;
-    }
-
-    // char_t and wchar_t are not subject to this rule.
-    const std::string needle = "char_t";
-    if (std::equal(needle.rbegin(), needle.rend(), typeName.rbegin())) {
-      return true;
-    }
-
-    const uint64_t typeSize = context->getTypeSize(t);
-    const std::string sizeStr = llvm::utostr(typeSize);
-    // For all remaining types, the number of occupied bits must be embedded in
-    // the typename.
-    if (typeName.rfind(sizeStr) == std::string::npos) {
+    // Types named after their size, size_t and the character types are fine.
+    if (!typeClass.is(TypeClass::HasSizeIndicatingName)) {
       reportError(D->getLocation());
     }
 
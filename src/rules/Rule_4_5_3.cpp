@@ -5,11 +5,13 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "TypeClassification.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/Basic/Diagnostic.h"
 #include "misracpp2008.h"
 #include <cctype>
+#include <set>
 
 using namespace clang;
 
@@ -80,19 +82,11 @@ private:
       clang::UO_AddrOf};
   const std::set<BinaryOperator::Opcode> legalBinaryOperators = {
       clang::BO_Assign, clang::BO_EQ, clang::BO_NE};
-  const std::set<std::string> plainCharTypeNames = {
-      "char",     "unsigned char", "signed char", "char_t", "wchar_t",
-      "char16_t", "char32_t",      "__wchar_t"}; ///< TODO: Is there a better
-                                                 /// way to bann all the plain
-                                                 /// char types?
 
   bool isPlainCharType(const Expr *expr) {
-    const QualType t = expr->getType();
-
-    if (!t->isAnyCharacterType()) {
-      return false;
-    }
-    return plainCharTypeNames.find(t.getAsString()) != plainCharTypeNames.end();
+    return getSharedAnalysis<TypeClassification>()
+        .classify(expr->getType())
+        .is(TypeClass::IsPlainChar);
   }
 
 protected:
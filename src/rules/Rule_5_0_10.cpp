@@ -0,0 +1,87 @@
+//===-  Rule_5_0_10.cpp - Checker for MISRA C++ 2008 rule 5-0-10-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "UnderlyingTypes.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Basic/Diagnostic.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_5_0_10 : public RuleCheckerASTContext,
+                    public RecursiveASTVisitor<Rule_5_0_10> {
+public:
+  Rule_5_0_10()
+      : RuleCheckerASTContext(),
+        castOperators(std::less<const Expr *>(),
+                      getArenaAllocator<const Expr *>()) {}
+
+  bool VisitExplicitCastExpr(const ExplicitCastExpr *cast) {
+    // Casts are visited before their operands, remember the operators cast
+    // back to the underlying type of their operand.
+    const Expr *operand = cast->getSubExpr()->IgnoreParenImpCasts();
+    if (isShiftedOrComplemented(operand) &&
+        getSharedAnalysis<UnderlyingTypes>().get(operand).type ==
+            cast->getType().getCanonicalType().getUnqualifiedType()) {
+      castOperators.insert(operand);
+    }
+    return true;
+  }
+
+  bool VisitUnaryOperator(const UnaryOperator *UO) {
+    if (UO->getOpcode() == UO_Not) {
+      checkOperator(UO);
+    }
+    return true;
+  }
+
+  bool VisitBinaryOperator(const BinaryOperator *BO) {
+    if (BO->getOpcode() == BO_Shl) {
+      checkOperator(BO);
+    }
+    return true;
+  }
+
+private:
+  ArenaSet<const Expr *> castOperators;
+
+  static bool isShiftedOrComplemented(const Expr *expr) {
+    if (const UnaryOperator *UO = dyn_cast<UnaryOperator>(expr)) {
+      return UO->getOpcode() == UO_Not;
+    }
+    if (const BinaryOperator *BO = dyn_cast<BinaryOperator>(expr)) {
+      return BO->getOpcode() == BO_Shl;
+    }
+    return false;
+  }
+
+  void checkOperator(const Expr *op) {
+    if (doIgnore(op->getLocStart())) {
+      return;
+    }
+
+    const QualType type = getSharedAnalysis<UnderlyingTypes>().get(op).type;
+    if ((type->isSpecificBuiltinType(BuiltinType::UChar) ||
+         type->isSpecificBuiltinType(BuiltinType::UShort)) &&
+        castOperators.count(op) == 0) {
+      reportError(op->getLocStart());
+    }
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_5_0_10> X("5-0-10", "");
+}
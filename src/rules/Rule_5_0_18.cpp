@@ -0,0 +1,21 @@
+//===-  Rule_5_0_18.cpp - Checker for MISRA C++ 2008 rule 5-0-18-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AnalysisRuleChecker.h"
+#include "ControlFlowCache.h"
+#include "EvaluationCache.h"
+#include "PointerProvenance.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+class Rule_5_0_18
+    : public AnalysisRuleChecker<PointerProvenance, ControlFlowCache,
+                                 EvaluationCache> {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_5_0_18> X("5-0-18", "");
+}
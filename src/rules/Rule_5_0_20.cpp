@@ -0,0 +1,54 @@
+//===-  Rule_5_0_20.cpp - Checker for MISRA C++ 2008 rule 5-0-20-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "UnderlyingTypes.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Basic/Diagnostic.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_5_0_20 : public RuleCheckerASTContext,
+                    public RecursiveASTVisitor<Rule_5_0_20> {
+public:
+  Rule_5_0_20() : RuleCheckerASTContext() {}
+
+  bool VisitBinaryOperator(const BinaryOperator *BO) {
+    const BinaryOperator::Opcode opCode = BO->getOpcode();
+    if (opCode != BO_And && opCode != BO_Xor && opCode != BO_Or &&
+        opCode != BO_AndAssign && opCode != BO_XorAssign &&
+        opCode != BO_OrAssign) {
+      return true;
+    }
+    if (doIgnore(BO->getLocStart())) {
+      return true;
+    }
+
+    UnderlyingTypes &underlyingTypes = getSharedAnalysis<UnderlyingTypes>();
+    const UnderlyingTypeInfo lhs = underlyingTypes.getOperand(BO->getLHS());
+    const UnderlyingTypeInfo rhs = underlyingTypes.getOperand(BO->getRHS());
+    if (!lhs.is(UnderlyingTypeInfo::IsConstant) &&
+        !rhs.is(UnderlyingTypeInfo::IsConstant) && lhs.type != rhs.type) {
+      reportError(BO->getLocStart());
+    }
+
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_5_0_20> X("5-0-20", "");
+}
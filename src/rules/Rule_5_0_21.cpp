@@ -0,0 +1,78 @@
+//===-  Rule_5_0_21.cpp - Checker for MISRA C++ 2008 rule 5-0-21-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "UnderlyingTypes.h"
+#include "TypeClassification.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Basic/Diagnostic.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_5_0_21 : public RuleCheckerASTContext,
+                    public RecursiveASTVisitor<Rule_5_0_21> {
+public:
+  Rule_5_0_21() : RuleCheckerASTContext() {}
+
+  bool VisitUnaryOperator(const UnaryOperator *UO) {
+    if (UO->getOpcode() == UO_Not && !doIgnore(UO->getLocStart()) &&
+        isSigned(UO->getSubExpr())) {
+      reportError(UO->getLocStart());
+    }
+    return true;
+  }
+
+  bool VisitBinaryOperator(const BinaryOperator *BO) {
+    if (!isBitwiseOperator(BO->getOpcode()) || doIgnore(BO->getLocStart())) {
+      return true;
+    }
+
+    if (isSigned(BO->getLHS()) || isSigned(BO->getRHS())) {
+      reportError(BO->getLocStart());
+    }
+    return true;
+  }
+
+private:
+  static bool isBitwiseOperator(BinaryOperator::Opcode opCode) {
+    switch (opCode) {
+    case BO_And:
+    case BO_Xor:
+    case BO_Or:
+    case BO_Shl:
+    case BO_Shr:
+    case BO_AndAssign:
+    case BO_XorAssign:
+    case BO_OrAssign:
+    case BO_ShlAssign:
+    case BO_ShrAssign:
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  bool isSigned(const Expr *operand) {
+    const QualType type =
+        getSharedAnalysis<UnderlyingTypes>().getOperand(operand).type;
+    return getSharedAnalysis<TypeClassification>().classify(type).is(
+        TypeClass::IsSigned);
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_5_0_21> X("5-0-21", "");
+}
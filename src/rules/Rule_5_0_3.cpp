@@ -0,0 +1,147 @@
+//===-  Rule_5_0_3.cpp - Checker for MISRA C++ 2008 rule 5-0-3-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "UnderlyingTypes.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/DeclCXX.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Basic/Diagnostic.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_5_0_3 : public RuleCheckerASTContext,
+                   public RecursiveASTVisitor<Rule_5_0_3> {
+  typedef RecursiveASTVisitor<Rule_5_0_3> Base;
+
+public:
+  Rule_5_0_3() : RuleCheckerASTContext() {}
+
+  bool TraverseDecl(Decl *decl) {
+    const FunctionDecl *enclosingFunction = function;
+    if (const FunctionDecl *functionDecl =
+            dyn_cast_or_null<FunctionDecl>(decl)) {
+      function = functionDecl;
+    }
+    const bool result = Base::TraverseDecl(decl);
+    function = enclosingFunction;
+    return result;
+  }
+
+  bool TraverseLambdaExpr(LambdaExpr *expr) {
+    const FunctionDecl *enclosingFunction = function;
+    function = expr->getCallOperator();
+    const bool result = Base::TraverseLambdaExpr(expr);
+    function = enclosingFunction;
+    return result;
+  }
+
+  bool VisitImplicitCastExpr(const ImplicitCastExpr *cast) {
+    if (doIgnore(cast->getLocStart())) {
+      return true;
+    }
+
+    UnderlyingTypes &underlyingTypes = getSharedAnalysis<UnderlyingTypes>();
+    if (!underlyingTypes.isImplicitConversion(cast)) {
+      return true;
+    }
+    const UnderlyingTypeInfo source = underlyingTypes.get(cast->getSubExpr());
+    if (source.is(UnderlyingTypeInfo::IsCValue) &&
+        source.type != underlyingTypes.get(cast).type) {
+      reportError(cast->getLocStart());
+    }
+
+    return true;
+  }
+
+  bool VisitVarDecl(const VarDecl *var) {
+    if (var->getInit() != nullptr) {
+      checkSite(var->getInit(), var->getType());
+    }
+    return true;
+  }
+
+  bool VisitBinaryOperator(const BinaryOperator *op) {
+    if (op->getOpcode() == BO_Assign) {
+      checkSite(op->getRHS(), op->getLHS()->getType());
+    }
+    return true;
+  }
+
+  bool VisitCallExpr(const CallExpr *call) {
+    const FunctionDecl *callee = call->getDirectCallee();
+    if (callee == nullptr) {
+      return true;
+    }
+    // The object of a member operator is its first argument.
+    const CXXMethodDecl *method = dyn_cast<CXXMethodDecl>(callee);
+    const unsigned first =
+        isa<CXXOperatorCallExpr>(call) && method && method->isInstance() ? 1
+                                                                         : 0;
+    for (unsigned i = first, e = call->getNumArgs(); i < e; ++i) {
+      if (i - first < callee->getNumParams()) {
+        checkSite(call->getArg(i),
+                  callee->getParamDecl(i - first)->getType());
+      }
+    }
+    return true;
+  }
+
+  bool VisitCXXConstructExpr(const CXXConstructExpr *construct) {
+    const CXXConstructorDecl *ctor = construct->getConstructor();
+    for (unsigned i = 0, e = construct->getNumArgs();
+         i < e && i < ctor->getNumParams(); ++i) {
+      checkSite(construct->getArg(i), ctor->getParamDecl(i)->getType());
+    }
+    return true;
+  }
+
+  bool VisitReturnStmt(const ReturnStmt *returnStmt) {
+    if (function != nullptr && returnStmt->getRetValue() != nullptr) {
+      checkSite(returnStmt->getRetValue(), function->getReturnType());
+    }
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+
+private:
+  const FunctionDecl *function = nullptr;
+
+  /// \brief Check \c value, which initializes an object of type \c target.
+  /// A cvalue of a different underlying type may reach it without any cast,
+  /// e.g. the promoted sum of two int8_t initializing an int32_t. Values
+  /// converted by a cast are checked by VisitImplicitCastExpr() instead.
+  void checkSite(const Expr *value, QualType target) {
+    if (!target->isArithmeticType() || value->isInstantiationDependent()) {
+      return;
+    }
+    UnderlyingTypes &underlyingTypes = getSharedAnalysis<UnderlyingTypes>();
+    const ImplicitCastExpr *cast =
+        dyn_cast<ImplicitCastExpr>(value->IgnoreParens());
+    if (cast != nullptr && underlyingTypes.isImplicitConversion(cast)) {
+      return;
+    }
+    const UnderlyingTypeInfo source = underlyingTypes.get(value);
+    if (source.is(UnderlyingTypeInfo::IsCValue) &&
+        source.type != target.getCanonicalType().getUnqualifiedType() &&
+        !doIgnore(value->getLocStart())) {
+      reportError(value->getLocStart());
+    }
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_5_0_3> X("5-0-3", "");
+}
@@ -0,0 +1,65 @@
+//===-  Rule_5_0_4.cpp - Checker for MISRA C++ 2008 rule 5-0-4-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "UnderlyingTypes.h"
+#include "TypeClassification.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Basic/Diagnostic.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_5_0_4 : public RuleCheckerASTContext,
+                   public RecursiveASTVisitor<Rule_5_0_4> {
+public:
+  Rule_5_0_4() : RuleCheckerASTContext() {}
+
+  bool VisitImplicitCastExpr(const ImplicitCastExpr *cast) {
+    if (cast->getCastKind() != CK_IntegralCast ||
+        doIgnore(cast->getLocStart())) {
+      return true;
+    }
+
+    UnderlyingTypes &underlyingTypes = getSharedAnalysis<UnderlyingTypes>();
+    if (!underlyingTypes.isImplicitConversion(cast)) {
+      return true;
+    }
+    // The values of constants are known, the compiler warns about the ones
+    // which do not fit.
+    const UnderlyingTypeInfo source = underlyingTypes.get(cast->getSubExpr());
+    if (source.is(UnderlyingTypeInfo::IsConstant)) {
+      return true;
+    }
+
+    TypeClassification &types = getSharedAnalysis<TypeClassification>();
+    const TypeClass sourceClass = types.classify(source.type);
+    const TypeClass targetClass = types.classify(cast->getType());
+    if (sourceClass.is(TypeClass::IsBool) ||
+        targetClass.is(TypeClass::IsBool)) {
+      return true;
+    }
+    if (sourceClass.is(TypeClass::IsSigned) !=
+        targetClass.is(TypeClass::IsSigned)) {
+      reportError(cast->getLocStart());
+    }
+
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_5_0_4> X("5-0-4", "");
+}
@@ -5,6 +5,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "UnderlyingTypes.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/Expr.h"
 #include "clang/AST/RecursiveASTVisitor.h"
@@ -18,25 +19,25 @@ namespace misracpp2008 {
 class Rule_5_0_5 : public RuleCheckerASTContext,
                    public RecursiveASTVisitor<Rule_5_0_5> {
 public:
-  bool TraverseStmt(Stmt *S) {
-    if (CastExpr *CE = dyn_cast_or_null<CastExpr>(S)) {
-      const CastKind ck = CE->getCastKind();
-      const SourceLocation loc = CE->getLocStart();
-      const bool isExplicitCast = isa<ExplicitCastExpr>(CE);
-      if (!hasExplicitParentCastExpr && !isExplicitCast && !doIgnore(loc) &&
-          (ck == CK_IntegralToFloating || ck == CK_FloatingToIntegral)) {
-        reportError(loc);
-      }
-      hasExplicitParentCastExpr = isExplicitCast;
-    } else {
-      hasExplicitParentCastExpr = false;
+  Rule_5_0_5() : RuleCheckerASTContext() {}
+
+  bool VisitImplicitCastExpr(const ImplicitCastExpr *cast) {
+    const CastKind kind = cast->getCastKind();
+    if (kind != CK_IntegralToFloating && kind != CK_FloatingToIntegral) {
+      return true;
+    }
+    const SourceLocation loc = cast->getLocStart();
+    if (doIgnore(loc)) {
+      return true;
     }
 
-    return RecursiveASTVisitor<Rule_5_0_5>::TraverseStmt(S);
-  }
+    // Conversions done on behalf of an explicit cast are fine.
+    if (getSharedAnalysis<UnderlyingTypes>().isImplicitConversion(cast)) {
+      reportError(loc);
+    }
 
-private:
-  bool hasExplicitParentCastExpr = false;
+    return true;
+  }
 
 protected:
   virtual void doWork() override {
@@ -0,0 +1,63 @@
+//===-  Rule_5_0_8.cpp - Checker for MISRA C++ 2008 rule 5-0-8-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "UnderlyingTypes.h"
+#include "TypeClassification.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Basic/Diagnostic.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+class Rule_5_0_8 : public RuleCheckerASTContext,
+                   public RecursiveASTVisitor<Rule_5_0_8> {
+public:
+  Rule_5_0_8() : RuleCheckerASTContext() {}
+
+  bool VisitExplicitCastExpr(const ExplicitCastExpr *cast) {
+    if (doIgnore(cast->getLocStart())) {
+      return true;
+    }
+
+    UnderlyingTypes &underlyingTypes = getSharedAnalysis<UnderlyingTypes>();
+    const UnderlyingTypeInfo source =
+        underlyingTypes.get(UnderlyingTypes::getConvertedExpr(cast));
+    if (!source.is(UnderlyingTypeInfo::IsCValue)) {
+      return true;
+    }
+
+    TypeClassification &types = getSharedAnalysis<TypeClassification>();
+    const TypeClass sourceClass = types.classify(source.type);
+    const TypeClass targetClass = types.classify(cast->getType());
+    if (!sourceClass.is(TypeClass::IsArithmetic) ||
+        !targetClass.is(TypeClass::IsArithmetic) ||
+        sourceClass.is(TypeClass::IsBool) ||
+        targetClass.is(TypeClass::IsBool)) {
+      return true;
+    }
+    if (sourceClass.is(TypeClass::IsFloating) ==
+            targetClass.is(TypeClass::IsFloating) &&
+        targetClass.bitWidth > sourceClass.bitWidth) {
+      reportError(cast->getLocStart());
+    }
+
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_5_0_8> X("5-0-8", "");
+}
@@ -5,6 +5,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "clang/AST/APValue.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/Basic/Diagnostic.h"
@@ -36,10 +37,10 @@ protected:
     const Expr *rhsExpr = S->getRHS();
     const Expr *lhsExpr = S->getLHS();
     const bool lhsIsInteger = lhsExpr->getType()->isIntegerType();
-    const bool rhsIsEvaluatable = rhsExpr->isEvaluatable(*context);
+    const APValue *rhsValue = evaluateConstant(rhsExpr);
 
-    if (lhsIsInteger && rhsIsEvaluatable) {
-      const llvm::APSInt bitsToShift = rhsExpr->EvaluateKnownConstInt(*context);
+    if (lhsIsInteger && rhsValue && rhsValue->isInt()) {
+      const llvm::APSInt &bitsToShift = rhsValue->getInt();
       const unsigned integerSize = getBitWidthOfInteger(lhsExpr);
 
       // Report an error if we can be sure (statically checked), that the number
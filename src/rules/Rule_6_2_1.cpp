@@ -9,7 +9,6 @@
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/Basic/Diagnostic.h"
 #include "misracpp2008.h"
-#include <set>
 
 using namespace clang;
 
@@ -18,7 +17,10 @@ namespace misracpp2008 {
 class Rule_6_2_1 : public RuleCheckerASTContext,
                    public RecursiveASTVisitor<Rule_6_2_1> {
 public:
-  Rule_6_2_1() : RuleCheckerASTContext() {}
+  Rule_6_2_1()
+      : RuleCheckerASTContext(),
+        reportedStatements(std::less<const Stmt *>(),
+                           getArenaAllocator<const Stmt *>()) {}
 
   bool VisitExpr(Expr *E) {
     if (doIgnore(E->getLocStart())) {
@@ -42,7 +44,7 @@ public:
   }
 
 private:
-  std::set<const Stmt *> reportedStatements;
+  ArenaSet<const Stmt *> reportedStatements;
   void reportViolatingStatement(const Stmt *stmt) {
     if (reportedStatements.find(stmt) == reportedStatements.end()) {
       reportedStatements.insert(stmt);
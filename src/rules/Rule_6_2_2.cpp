@@ -5,6 +5,7 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "clang/AST/APValue.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/RecursiveASTVisitor.h"
 #include "clang/Basic/Diagnostic.h"
@@ -128,18 +129,16 @@ private:
   };
   using FloatEmiterSet = std::set<FloatEmiter>;
 
-  bool extractAPInt(const Expr *expr, llvm::APInt &aPInt) const {
-    Expr::EvalResult evalResult;
-    if (expr->EvaluateAsRValue(evalResult, *this->context)) {
-      if (evalResult.Val.isInt()) {
-        aPInt = evalResult.Val.getInt();
-        return true;
-      }
+  bool extractAPInt(const Expr *expr, llvm::APInt &aPInt) {
+    const APValue *value = evaluateConstant(expr, true);
+    if (value && value->isInt()) {
+      aPInt = value->getInt();
+      return true;
     }
     return false;
   }
 
-  bool extractConstInt(const Expr *expr, int64_t &sizeValue) const {
+  bool extractConstInt(const Expr *expr, int64_t &sizeValue) {
     llvm::APInt i;
     if (extractAPInt(expr, i)) {
       sizeValue = i.getSExtValue();
@@ -148,7 +147,7 @@ private:
     return false;
   }
 
-  bool extractConstUnsignedInt(const Expr *expr, uint64_t &sizeValue) const {
+  bool extractConstUnsignedInt(const Expr *expr, uint64_t &sizeValue) {
     llvm::APInt i;
     if (extractAPInt(expr, i) && i.isNonNegative()) {
       sizeValue = i.getLimitedValue();
@@ -192,7 +191,8 @@ private:
 
     // Report error only when on the left and on the right side the same two
     // values (constants, method calls, etc.) have been found.
-    if (std::equal(lhsChildren.begin(), lhsChildren.end(),
+    if (lhsChildren.size() == rhsChildren.size() &&
+        std::equal(lhsChildren.begin(), lhsChildren.end(),
                    rhsChildren.begin())) {
       reportError(binOp->getLocStart());
     }
@@ -228,23 +228,21 @@ private:
         {extractFloatEmiter(bo->getRHS()), extractFloatEmiter(bo->getLHS())});
   }
 
-  bool extractConstDouble(const Expr *expr, double &dblValue) const {
-    Expr::EvalResult evalResult;
-    if (expr->EvaluateAsRValue(evalResult, *this->context)) {
-      if (evalResult.Val.isFloat()) {
-        using namespace llvm;
-        APFloat APF = evalResult.Val.getFloat();
-        bool unused;
-        APF.convert(APFloat::IEEEdouble, APFloat::rmNearestTiesToEven, &unused);
-        dblValue = APF.convertToDouble();
-        return true;
-      }
+  bool extractConstDouble(const Expr *expr, double &dblValue) {
+    const APValue *value = evaluateConstant(expr, true);
+    if (value && value->isFloat()) {
+      using namespace llvm;
+      APFloat APF = value->getFloat();
+      bool unused;
+      APF.convert(APFloat::IEEEdouble, APFloat::rmNearestTiesToEven, &unused);
+      dblValue = APF.convertToDouble();
+      return true;
     }
     return false;
   }
 
   /// Trying to describe/classify an expression which emits a float value.
-  FloatEmiter extractFloatEmiter(const Expr *expr) const {
+  FloatEmiter extractFloatEmiter(const Expr *expr) {
     const Expr *coreExpr = expr->IgnoreParenImpCasts();
 
     // Check if this value can be evaluated at compile time.
@@ -263,16 +261,12 @@ private:
       return FloatEmiter(declRef->getDecl());
     }
     if (const auto *arraySub = dyn_cast<ArraySubscriptExpr>(coreExpr)) {
+      // Arrays reached through e.g. members or function calls are not
+      // tracked.
       const auto *decl =
           dyn_cast<DeclRefExpr>(arraySub->getBase()->IgnoreParenImpCasts());
-      if (decl == nullptr) {
-        arraySub->dump();
-      }
-      assert(decl &&
-             "Base of an ArraySubscriptExpr is expected to be a DeclRefExpr.");
-
       uint64_t arrayIndex;
-      if (extractConstUnsignedInt(arraySub->getIdx(), arrayIndex)) {
+      if (decl && extractConstUnsignedInt(arraySub->getIdx(), arrayIndex)) {
         return FloatEmiter(decl->getDecl(), static_cast<size_t>(arrayIndex));
       }
       // Without knowing the index we can not be sure if the same index gets
@@ -280,9 +274,9 @@ private:
       return FloatEmiter();
     }
 
-    expr->dumpColor();
-    assert(false && "Unsupported kind of floating value source!");
-    return FloatEmiter(0.0);
+    // Function calls, member accesses, arithmetic etc. can not be proven to
+    // yield the same value twice.
+    return FloatEmiter();
   }
 
 protected:
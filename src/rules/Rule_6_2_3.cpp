@@ -5,66 +5,151 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include "CommentIndex.h"
 #include "clang/AST/ASTContext.h"
 #include "clang/AST/RecursiveASTVisitor.h"
-#include "clang/Basic/Diagnostic.h"
+#include "clang/Basic/CharInfo.h"
+#include "clang/Basic/SourceManager.h"
+#include "clang/Lex/PPCallbacks.h"
+#include "llvm/ADT/DenseMap.h"
 #include "misracpp2008.h"
-#include <set>
+#include <algorithm>
+#include <limits>
+#include <vector>
 
 using namespace clang;
 
 namespace misracpp2008 {
 
+// The comments are recorded by the preprocessor, which needs the comment
+// index in place before it enters the main file. The null statements are
+// checked against a table of the lines of their file, built once per file.
 class Rule_6_2_3 : public RuleCheckerASTContext,
+                   public RuleCheckerPPCallback,
                    public RecursiveASTVisitor<Rule_6_2_3> {
-private:
-  std::set<clang::SourceRange> commentLocations;
-
 public:
-  Rule_6_2_3() : RuleCheckerASTContext() {}
+  virtual void FileChanged(SourceLocation Loc, FileChangeReason Reason,
+                           SrcMgr::CharacteristicKind FileType,
+                           FileID PrevFID) override {
+    getSharedAnalysis<CommentIndex>();
+  }
 
   bool VisitNullStmt(NullStmt *stmt) {
-    if (doIgnore(stmt->getLocStart())) {
+    const SourceLocation semiLoc = stmt->getSemiLoc();
+    if (semiLoc.isMacroID() || doIgnore(semiLoc)) {
       return true;
     }
 
-    if (hasNonWhitespaceBeforeNullStmt(stmt) ||
-        hasNonWhitespaceAfterNullStmt(stmt)) {
-      reportError(stmt->getLocStart());
+    const std::pair<FileID, unsigned> decomposedLoc =
+        context->getSourceManager().getDecomposedLoc(semiLoc);
+    if (!getLineTable(decomposedLoc.first)
+             .isOnLineByItself(decomposedLoc.second)) {
+      reportError(semiLoc);
     }
     return true;
   }
 
-  bool hasNonWhitespaceAfterNullStmt(const NullStmt *ns) {
-    return hasNonWhitespace(ns, 1, 1);
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
   }
 
-  bool hasNonWhitespaceBeforeNullStmt(const NullStmt *ns) {
-    unsigned nullStmtColumnNumber =
-        context->getFullLoc(ns->getLocStart()).getSpellingColumnNumber();
-    return hasNonWhitespace(ns, nullStmtColumnNumber,
-                            -1 * nullStmtColumnNumber);
-  }
+private:
+  /// \brief The text of a line as far as this rule is concerned.
+  struct LineSpan {
+    static const unsigned none = std::numeric_limits<unsigned>::max();
+
+    unsigned start;
+    /// Offset of the first character which is neither white-space nor line
+    /// break, comments included.
+    unsigned firstNonBlank;
+    /// Offset past the last character which is neither white-space nor part
+    /// of a comment.
+    unsigned codeEnd;
+  };
 
-  bool hasNonWhitespace(const NullStmt *ns, size_t commentLength, int offset) {
-    clang::SourceManager &sm = context->getSourceManager();
+  struct LineTable {
+    llvm::StringRef text;
+    std::vector<LineSpan> lines;
 
-    SourceLocation offsetToStmtLocation =
-        ns->getLocEnd().getLocWithOffset(offset);
-    std::pair<FileID, unsigned> startLoc =
-        sm.getDecomposedLoc(offsetToStmtLocation);
-    llvm::StringRef fileData = sm.getBufferData(startLoc.first);
-    llvm::StringRef commentString =
-        fileData.substr(startLoc.second, commentLength).trim();
-    return commentString.size() > 0;
+    /// \brief Tell whether the null statement at \c offset is on a line by
+    /// itself, followed by nothing or by white-space and a comment.
+    bool isOnLineByItself(unsigned offset) const {
+      auto line = std::upper_bound(
+          lines.begin(), lines.end(), offset,
+          [](unsigned value, const LineSpan &span) {
+            return value < span.start;
+          });
+      if (line == lines.begin()) {
+        return true;
+      }
+      --line;
+      return line->firstNonBlank == offset && line->codeEnd == offset + 1 &&
+             (offset + 1 == text.size() || isWhitespace(text[offset + 1]));
+    }
+  };
+
+  llvm::DenseMap<FileID, LineTable> lineTables;
+
+  const LineTable &getLineTable(FileID FID) {
+    auto it = lineTables.find(FID);
+    if (it != lineTables.end()) {
+      return it->second;
+    }
+    LineTable &table = lineTables[FID];
+    bool invalid = false;
+    table.text = context->getSourceManager().getBufferData(FID, &invalid);
+    if (!invalid) {
+      buildLineTable(
+          table, getSharedAnalysis<CommentIndex>().getComments(FID));
+    }
+    return table;
   }
 
-protected:
-  virtual void doWork() override {
-    RuleCheckerASTContext::doWork();
-    this->TraverseDecl(context->getTranslationUnitDecl());
+  /// \brief Scan the text of a file once, skipping its comments.
+  static void buildLineTable(LineTable &table,
+                             llvm::ArrayRef<CommentRecord> comments) {
+    const llvm::StringRef text = table.text;
+    auto comment = comments.begin();
+    LineSpan line{0, LineSpan::none, 0};
+    unsigned offset = 0;
+    const unsigned size = static_cast<unsigned>(text.size());
+    while (offset < size) {
+      while (comment != comments.end() && comment->offset < offset) {
+        ++comment;
+      }
+      if (comment != comments.end() && comment->offset == offset) {
+        if (line.firstNonBlank == LineSpan::none) {
+          line.firstNonBlank = offset;
+        }
+        // Lines continuing a comment start with the comment.
+        const unsigned commentEnd = std::min(offset + comment->length, size);
+        for (; offset < commentEnd; ++offset) {
+          if (text[offset] == '\n') {
+            table.lines.push_back(line);
+            line = LineSpan{offset + 1, offset + 1, 0};
+          }
+        }
+        ++comment;
+        continue;
+      }
+      const char character = text[offset];
+      if (character == '\n') {
+        table.lines.push_back(line);
+        line = LineSpan{offset + 1, LineSpan::none, 0};
+      } else if (!isWhitespace(character)) {
+        if (line.firstNonBlank == LineSpan::none) {
+          line.firstNonBlank = offset;
+        }
+        line.codeEnd = offset + 1;
+      }
+      ++offset;
+    }
+    table.lines.push_back(line);
   }
 };
 
 static RuleCheckerASTContextRegistry::Add<Rule_6_2_3> X("6-2-3", "");
+static RuleCheckerPreprocessorRegistry::Add<Rule_6_2_3> Y("6-2-3", "");
 }
@@ -0,0 +1,19 @@
+//===-  Rule_6_4_6.cpp - Checker for MISRA C++ 2008 rule 6-4-6-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AnalysisRuleChecker.h"
+#include "EvaluationCache.h"
+#include "SwitchStatements.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+class Rule_6_4_6
+    : public AnalysisRuleChecker<SwitchStatements, EvaluationCache> {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_6_4_6> X("6-4-6", "");
+}
@@ -0,0 +1,18 @@
+//===-  Rule_6_5_1.cpp - Checker for MISRA C++ 2008 rule 6-5-1-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AnalysisRuleChecker.h"
+#include "EvaluationCache.h"
+#include "LoopControl.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+class Rule_6_5_1 : public AnalysisRuleChecker<LoopControl, EvaluationCache> {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_6_5_1> X("6-5-1", "");
+}
@@ -0,0 +1,17 @@
+//===-  Rule_6_6_2.cpp - Checker for MISRA C++ 2008 rule 6-6-2--------------===/
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AnalysisRuleChecker.h"
+#include "JumpTables.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+class Rule_6_6_2 : public AnalysisRuleChecker<JumpTables> {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_6_6_2> X("6-6-2", "");
+}
@@ -0,0 +1,17 @@
+//===-  Rule_7_5_3.cpp - Checker for MISRA C++ 2008 rule 7-5-3-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AddressEscapes.h"
+#include "AnalysisRuleChecker.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+class Rule_7_5_3 : public AnalysisRuleChecker<AddressEscapes> {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_7_5_3> X("7-5-3", "");
+}
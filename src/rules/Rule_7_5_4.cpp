@@ -0,0 +1,40 @@
+//===-  Rule_7_5_4.cpp - Checker for MISRA C++ 2008 rule 7-5-4-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "FunctionCalls.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// Reports the recursion within the translation unit, the one spanning several
+// translation units is found by misracpp2008-merge.
+class Rule_7_5_4 : public RuleCheckerASTContext {
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    FunctionCalls &calls = getSharedAnalysis<FunctionCalls>();
+    const CallGraphRecords &records = calls.getRecords();
+    for (const RecursiveCycle &cycle : calls.getCycles()) {
+      const CallRecord &first = records.calls[cycle.calls.front()];
+      if (doIgnore(calls.getLocation(first))) {
+        continue;
+      }
+      reportError(calls.getLocation(first));
+      for (unsigned call : llvm::makeArrayRef(cycle.calls).slice(1)) {
+        report(calls.getLocation(records.calls[call]),
+               "Call of '%0' continuing the recursion",
+               DiagnosticsEngine::Note)
+            << records.calls[call].calleeName;
+      }
+    }
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_7_5_4> X("7-5-4", "");
+}
@@ -0,0 +1,75 @@
+//===-  Rule_8_5_1.cpp - Checker for MISRA C++ 2008 rule 8-5-1-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ControlFlowCache.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Analysis/CFG.h"
+#include "llvm/ADT/BitVector.h"
+#include "misracpp2008.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+// A variable is used before it has a defined value if its declaration without
+// an initializer reaches a read of it on some path.
+class Rule_8_5_1 : public RuleCheckerASTContext,
+                   public RecursiveASTVisitor<Rule_8_5_1> {
+public:
+  bool VisitFunctionDecl(FunctionDecl *decl) {
+    if (!decl->doesThisDeclarationHaveABody() || decl->isImplicit() ||
+        doIgnore(decl->getLocation())) {
+      return true;
+    }
+    const CFG *cfg = getCFG(decl);
+    if (cfg == nullptr) {
+      return true;
+    }
+    ControlFlowCache &cache = getSharedAnalysis<ControlFlowCache>();
+    const TrackedVariables &variables = cache.getTrackedVariables(decl);
+    if (variables.size() == 0) {
+      return true;
+    }
+
+    const UninitializedProblem problem(variables);
+    const DataflowResult result = cache.solve(*cfg, problem);
+    const llvm::BitVector reachable = findReachableBlocks(*cfg);
+    // Every variable is reported once, at its first read found.
+    llvm::BitVector reported(variables.size());
+    for (const CFGBlock *block : *cfg) {
+      if (!reachable.test(block->getBlockID())) {
+        continue;
+      }
+      problem.replay(*block, result, [&](const CFGElement &element,
+                                         const llvm::BitVector &undefined) {
+        Optional<CFGStmt> stmt = element.getAs<CFGStmt>();
+        if (!stmt) {
+          return;
+        }
+        const TrackedVariables::Access access =
+            variables.getAccess(stmt->getStmt());
+        if (access.is(TrackedVariables::Access::Read) &&
+            undefined.test(access.index) && !reported.test(access.index) &&
+            !doIgnore(stmt->getStmt()->getLocStart())) {
+          reported.set(access.index);
+          reportError(stmt->getStmt()->getLocStart());
+        }
+      });
+    }
+    return true;
+  }
+
+protected:
+  virtual void doWork() override {
+    RuleCheckerASTContext::doWork();
+    this->TraverseDecl(context->getTranslationUnitDecl());
+  }
+};
+
+static RuleCheckerASTContextRegistry::Add<Rule_8_5_1> X("8-5-1", "");
+}
@@ -0,0 +1,17 @@
+//===-  Rule_9_3_3.cpp - Checker for MISRA C++ 2008 rule 9-3-3-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AnalysisRuleChecker.h"
+#include "ConstInference.h"
+#include "misracpp2008.h"
+
+namespace misracpp2008 {
+
+class Rule_9_3_3 : public AnalysisRuleChecker<ConstInference> {};
+
+static RuleCheckerASTContextRegistry::Add<Rule_9_3_3> X("9-3-3", "");
+}
@@ -0,0 +1,116 @@
+//===-  ScopeTrackingVisitor.h - Visitor keeping track of scopes-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef SCOPE_TRACKING_VISITOR_H
+#define SCOPE_TRACKING_VISITOR_H
+
+#include "clang/AST/Decl.h"
+#include "clang/AST/DeclBase.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/ADT/SmallVector.h"
+
+namespace misracpp2008 {
+
+/// \brief RecursiveASTVisitor keeping track of the scopes entered during the
+/// traversal.
+///
+/// Every non-transparent DeclContext opens a scope. Out-of-line definitions
+/// additionally open the scopes of their semantic parents which are not
+/// entered yet, e.g. the class of a member function defined at namespace
+/// scope. Derived classes get notified by shadowing scopeEntered() and
+/// scopeLeft(), just like the Visit methods of the RecursiveASTVisitor.
+template <typename Derived>
+class ScopeTrackingVisitor : public clang::RecursiveASTVisitor<Derived> {
+public:
+  bool TraverseDecl(clang::Decl *D) {
+    clang::DeclContext *DC = llvm::dyn_cast_or_null<clang::DeclContext>(D);
+    const bool isNewScope = DC && !DC->isTransparentContext();
+    const unsigned scopeCount = getScopeCount();
+
+    if (isNewScope) {
+      enterScope(DC);
+    }
+
+    const bool retVal = clang::RecursiveASTVisitor<Derived>::TraverseDecl(D);
+
+    while (getScopeCount() > scopeCount) {
+      leaveScope();
+    }
+    return retVal;
+  }
+
+  /// \brief Called after \c DC has been entered as the innermost scope.
+  /// \param DC Entered scope.
+  /// \param isSemanticParent True if \c DC is not traversed but entered on
+  /// behalf of an out-of-line definition.
+  void scopeEntered(const clang::DeclContext *DC, bool isSemanticParent) {}
+
+  /// \brief Called before the innermost scope \c DC is left.
+  void scopeLeft(const clang::DeclContext *DC) {}
+
+protected:
+  /// \brief Number of scopes entered, the depth of the innermost one plus one.
+  unsigned getScopeCount() const { return scopes.size(); }
+
+  /// \brief Entered scope at \c depth, 0 being the translation unit.
+  const clang::DeclContext *getScope(unsigned depth) const {
+    return scopes[depth];
+  }
+
+  /// \brief Depth of the scope \c decl has been declared in.
+  unsigned getScopeDepth(const clang::Decl *decl) const {
+    const clang::DeclContext *DC = decl->getLexicalDeclContext();
+    while (DC && DC->isTransparentContext()) {
+      DC = DC->getLexicalParent();
+    }
+    auto it = scopeDepths.find(DC);
+    if (it != scopeDepths.end()) {
+      return it->second;
+    }
+    // E.g. the parameters of a lambda: they belong to the innermost scope.
+    return scopes.size() - 1;
+  }
+
+private:
+  llvm::SmallVector<const clang::DeclContext *, 16> scopes;
+  llvm::DenseMap<const clang::DeclContext *, unsigned> scopeDepths;
+
+  void pushScope(const clang::DeclContext *DC, bool isSemanticParent) {
+    scopeDepths[DC] = scopes.size();
+    scopes.push_back(DC);
+    this->getDerived().scopeEntered(DC, isSemanticParent);
+  }
+
+  void enterScope(const clang::DeclContext *DC) {
+    const clang::Decl *D = llvm::dyn_cast<clang::Decl>(DC);
+    if (D && D->getDeclContext() != D->getLexicalDeclContext()) {
+      llvm::SmallVector<const clang::DeclContext *, 4> semanticParents;
+      for (const clang::DeclContext *parent = DC->getParent();
+           parent && scopeDepths.count(parent) == 0;
+           parent = parent->getParent()) {
+        if (!parent->isTransparentContext()) {
+          semanticParents.push_back(parent);
+        }
+      }
+      for (auto I = semanticParents.rbegin(), E = semanticParents.rend();
+           I != E; ++I) {
+        pushScope(*I, true);
+      }
+    }
+    pushScope(DC, false);
+  }
+
+  void leaveScope() {
+    const clang::DeclContext *DC = scopes.back();
+    this->getDerived().scopeLeft(DC);
+    scopeDepths.erase(DC);
+    scopes.pop_back();
+  }
+};
+}
+
+#endif
@@ -0,0 +1,279 @@
+//===-  SwitchStatements.cpp - Clauses of the switch statements------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "SwitchStatements.h"
+#include "EvaluationCache.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/APSInt.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/raw_ostream.h"
+#include <algorithm>
+#include <utility>
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char SwitchStatements::ID = 0;
+
+namespace {
+
+/// \brief Tell whether \c stmt is a break or a throw expression, or a
+/// compound statement ending with one.
+bool isTerminating(const Stmt *stmt) {
+  while (const CompoundStmt *compound = dyn_cast_or_null<CompoundStmt>(stmt)) {
+    stmt = compound->body_empty() ? nullptr : compound->body_back();
+  }
+  if (stmt == nullptr) {
+    return false;
+  }
+  if (const Expr *expr = dyn_cast<Expr>(stmt)) {
+    return isa<CXXThrowExpr>(expr->IgnoreImplicit());
+  }
+  return isa<BreakStmt>(stmt);
+}
+
+/// \brief Splits the body of a switch statement into its clauses.
+class ClauseBuilder {
+public:
+  explicit ClauseBuilder(SwitchRecord &record) : record(record) {}
+
+  void add(const Stmt *stmt) {
+    const SwitchCase *label = dyn_cast<SwitchCase>(stmt);
+    if (label == nullptr) {
+      if (record.clauses.empty()) {
+        record.flags |= SwitchRecord::HasLeadingStatements;
+      } else {
+        addStatement(stmt);
+      }
+      return;
+    }
+
+    finishClause();
+    SwitchClause clause{label, SwitchClause::IsEmpty};
+    // Labels following each other directly are nested in the AST.
+    for (; label != nullptr;
+         label = dyn_cast_or_null<SwitchCase>(label->getSubStmt())) {
+      clauseLabels.insert(label);
+      if (isa<DefaultStmt>(label)) {
+        clause.flags |= SwitchClause::IsDefault;
+      } else {
+        record.flags |= SwitchRecord::HasCaseClause;
+      }
+      stmt = label->getSubStmt();
+    }
+    record.clauses.push_back(clause);
+    addStatement(stmt);
+  }
+
+  void finish() {
+    finishClause();
+    if (!record.clauses.empty()) {
+      record.clauses.back().flags |= SwitchClause::IsLast;
+    }
+  }
+
+  bool isClauseLabel(const SwitchCase *label) const {
+    return clauseLabels.count(label) != 0;
+  }
+
+private:
+  SwitchRecord &record;
+  llvm::SmallPtrSet<const SwitchCase *, 16> clauseLabels;
+  const Stmt *lastStmt = nullptr;
+
+  void addStatement(const Stmt *stmt) {
+    if (stmt == nullptr || isa<NullStmt>(stmt)) {
+      return;
+    }
+    record.clauses.back().flags &= ~SwitchClause::IsEmpty;
+    lastStmt = stmt;
+  }
+
+  void finishClause() {
+    if (!record.clauses.empty() && isTerminating(lastStmt)) {
+      record.clauses.back().flags |= SwitchClause::IsTerminated;
+    }
+    lastStmt = nullptr;
+  }
+};
+
+/// \brief Tell whether every enumerator of \c type is the value of one of
+/// the case labels of \c stmt.
+bool coversAllEnumerators(const SwitchStmt &stmt, const EnumType &type,
+                          EvaluationCache &evaluations) {
+  const EnumDecl *decl = type.getDecl()->getDefinition();
+  if (decl == nullptr) {
+    return false;
+  }
+
+  // Bounds of the labels, a single value unless it is a GNU case range.
+  typedef std::pair<llvm::APSInt, llvm::APSInt> CaseRange;
+  llvm::SmallVector<CaseRange, 16> ranges;
+  for (const SwitchCase *label = stmt.getSwitchCaseList(); label != nullptr;
+       label = label->getNextSwitchCase()) {
+    const CaseStmt *caseStmt = dyn_cast<CaseStmt>(label);
+    if (caseStmt == nullptr) {
+      continue;
+    }
+    const APValue *lhs = evaluations.evaluate(caseStmt->getLHS(), false);
+    const APValue *rhs = caseStmt->getRHS()
+                             ? evaluations.evaluate(caseStmt->getRHS(), false)
+                             : lhs;
+    if (lhs != nullptr && rhs != nullptr && lhs->isInt() && rhs->isInt()) {
+      ranges.push_back(std::make_pair(lhs->getInt(), rhs->getInt()));
+    }
+  }
+
+  for (const EnumConstantDecl *enumerator : decl->enumerators()) {
+    const llvm::APSInt &value = enumerator->getInitVal();
+    auto covers = [&value](const CaseRange &range) {
+      return llvm::APSInt::compareValues(range.first, value) <= 0 &&
+             llvm::APSInt::compareValues(value, range.second) <= 0;
+    };
+    if (std::none_of(ranges.begin(), ranges.end(), covers)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+SwitchRecord analyze(const SwitchStmt &stmt, EvaluationCache &evaluations) {
+  SwitchRecord record{&stmt, {}, {}, 0};
+  const Expr *cond = stmt.getCond();
+  if (cond != nullptr) {
+    const QualType condType = cond->IgnoreParenImpCasts()->getType();
+    if (condType->isBooleanType()) {
+      record.flags |= SwitchRecord::HasBoolCondition;
+    }
+    const EnumType *enumType = condType->getAs<EnumType>();
+    if (enumType != nullptr &&
+        coversAllEnumerators(stmt, *enumType, evaluations)) {
+      record.flags |= SwitchRecord::CoversAllEnumerators;
+    }
+  }
+
+  ClauseBuilder builder(record);
+  const CompoundStmt *body = dyn_cast_or_null<CompoundStmt>(stmt.getBody());
+  if (body != nullptr) {
+    record.flags |= SwitchRecord::HasCompoundBody;
+    for (const Stmt *child : body->body()) {
+      builder.add(child);
+    }
+  }
+  builder.finish();
+
+  // The list of labels is in the reverse order of the source.
+  for (const SwitchCase *label = stmt.getSwitchCaseList(); label != nullptr;
+       label = label->getNextSwitchCase()) {
+    if (!builder.isClauseLabel(label)) {
+      record.nestedLabels.push_back(label);
+    }
+  }
+  std::reverse(record.nestedLabels.begin(), record.nestedLabels.end());
+  return record;
+}
+
+class SwitchScanner : public RecursiveASTVisitor<SwitchScanner> {
+public:
+  SwitchScanner(std::vector<SwitchRecord> &switches,
+                EvaluationCache &evaluations)
+      : switches(switches), evaluations(evaluations) {}
+
+  bool VisitSwitchStmt(SwitchStmt *stmt) {
+    switches.push_back(analyze(*stmt, evaluations));
+    return true;
+  }
+
+private:
+  std::vector<SwitchRecord> &switches;
+  EvaluationCache &evaluations;
+};
+
+void check(const SwitchRecord &record,
+           std::vector<SwitchViolation> &violations) {
+  const size_t violationCount = violations.size();
+  const SourceLocation switchLoc = record.stmt->getSwitchLoc();
+  for (const SwitchCase *label : record.nestedLabels) {
+    violations.push_back(SwitchViolation{"6-4-4", label->getLocStart()});
+  }
+  for (const SwitchClause &clause : record.clauses) {
+    if (!clause.is(SwitchClause::IsEmpty) &&
+        !clause.is(SwitchClause::IsTerminated)) {
+      violations.push_back(
+          SwitchViolation{"6-4-5", clause.firstLabel->getLocStart()});
+    }
+  }
+  // A switch on an enumeration listing all the enumerators does not need a
+  // default-clause, but one it has is still to be the last.
+  const bool hasDefault =
+      std::any_of(record.clauses.begin(), record.clauses.end(),
+                  [](const SwitchClause &clause) {
+                    return clause.is(SwitchClause::IsDefault);
+                  });
+  const bool endsWithDefault =
+      !record.clauses.empty() &&
+      record.clauses.back().is(SwitchClause::IsDefault);
+  if (!endsWithDefault &&
+      (hasDefault || !record.is(SwitchRecord::CoversAllEnumerators))) {
+    violations.push_back(SwitchViolation{"6-4-6", switchLoc});
+  }
+  if (record.is(SwitchRecord::HasBoolCondition)) {
+    violations.push_back(
+        SwitchViolation{"6-4-7", record.stmt->getCond()->getLocStart()});
+  }
+  if (!record.is(SwitchRecord::HasCaseClause)) {
+    violations.push_back(SwitchViolation{"6-4-8", switchLoc});
+  }
+
+  if (violations.size() != violationCount ||
+      !record.is(SwitchRecord::HasCompoundBody) ||
+      record.is(SwitchRecord::HasLeadingStatements)) {
+    violations.push_back(SwitchViolation{"6-4-3", switchLoc});
+  }
+}
+}
+
+SwitchStatements::SwitchStatements(CompilerInstance &CI) : CI(CI) {}
+
+llvm::ArrayRef<SwitchRecord>
+SwitchStatements::getSwitches(EvaluationCache &evaluations) {
+  scan(evaluations);
+  return switches;
+}
+
+llvm::ArrayRef<SwitchViolation>
+SwitchStatements::getViolations(EvaluationCache &evaluations) {
+  scan(evaluations);
+  return violations;
+}
+
+void SwitchStatements::printStatistics(llvm::raw_ostream &OS) const {
+  size_t clauseCount = 0;
+  for (const SwitchRecord &record : switches) {
+    clauseCount += record.clauses.size();
+  }
+  OS << "Switch statements: " << switches.size() << " switches, "
+     << clauseCount << " clauses, " << violations.size() << " violations\n";
+}
+
+void SwitchStatements::scan(EvaluationCache &evaluations) {
+  if (isScanned) {
+    return;
+  }
+  isScanned = true;
+  SwitchScanner scanner(switches, evaluations);
+  scanner.TraverseDecl(CI.getASTContext().getTranslationUnitDecl());
+  for (const SwitchRecord &record : switches) {
+    check(record, violations);
+  }
+}
+}
@@ -0,0 +1,108 @@
+//===-  SwitchStatements.h - Clauses of the switch statements--------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef SWITCH_STATEMENTS_H
+#define SWITCH_STATEMENTS_H
+
+#include "misracpp2008.h"
+#include "clang/Basic/SourceLocation.h"
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringRef.h"
+#include <cstdint>
+#include <vector>
+
+namespace clang {
+class SwitchCase;
+class SwitchStmt;
+}
+
+namespace misracpp2008 {
+
+class EvaluationCache;
+
+/// \brief A switch-clause: a list of labels and the statements following
+/// them up to the next label of the switch body.
+struct SwitchClause {
+  enum Flag : uint8_t {
+    IsDefault = 1 << 0,
+    /// No statements but null statements follow the labels.
+    IsEmpty = 1 << 1,
+    /// The last statement is a break or a throw expression.
+    IsTerminated = 1 << 2,
+    IsLast = 1 << 3
+  };
+
+  const clang::SwitchCase *firstLabel;
+  uint8_t flags;
+
+  bool is(Flag flag) const { return (flags & flag) != 0; }
+};
+
+/// \brief What the switch rules need to know about a switch statement.
+struct SwitchRecord {
+  enum Flag : uint8_t {
+    HasCompoundBody = 1 << 0,
+    /// Statements precede the first label of the body.
+    HasLeadingStatements = 1 << 1,
+    HasCaseClause = 1 << 2,
+    HasBoolCondition = 1 << 3,
+    /// The condition is of enumeration type and every enumerator is the
+    /// value of a case label.
+    CoversAllEnumerators = 1 << 4
+  };
+
+  const clang::SwitchStmt *stmt;
+  std::vector<SwitchClause> clauses;
+  /// Labels of the switch which are not in its body, but nested in one of
+  /// its statements.
+  std::vector<const clang::SwitchCase *> nestedLabels;
+  uint8_t flags;
+
+  bool is(Flag flag) const { return (flags & flag) != 0; }
+};
+
+/// \brief Violation of one of the switch rules 6-4-3 to 6-4-8.
+struct SwitchViolation {
+  llvm::StringRef rule;
+  clang::SourceLocation loc;
+};
+
+/// \brief Shared analysis classifying the clauses of all the switch
+/// statements of the translation unit.
+///
+/// The statements of a switch body are walked once to split them into
+/// clauses, and the list of labels the switch keeps is walked once to find
+/// the labels outside of the clauses. The switch rules are all checked from
+/// the result, a switch violating one of 6-4-4 to 6-4-8 is not well-formed
+/// in terms of rule 6-4-3.
+class SwitchStatements : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit SwitchStatements(clang::CompilerInstance &CI);
+
+  /// \brief The switch statements of the translation unit, in the order of
+  /// the source.
+  /// \param evaluations The values of the case labels.
+  llvm::ArrayRef<SwitchRecord> getSwitches(EvaluationCache &evaluations);
+
+  /// \brief The violations of the switch rules.
+  /// \param evaluations The values of the case labels.
+  llvm::ArrayRef<SwitchViolation> getViolations(EvaluationCache &evaluations);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  bool isScanned = false;
+  std::vector<SwitchRecord> switches;
+  std::vector<SwitchViolation> violations;
+
+  void scan(EvaluationCache &evaluations);
+};
+}
+
+#endif
@@ -0,0 +1,123 @@
+//===-  TypeClassification.cpp - Properties of the types of a TU-----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "TypeClassification.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/ADT/StringRef.h"
+#include "llvm/ADT/StringSwitch.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+using llvm::StringRef;
+
+namespace misracpp2008 {
+
+char TypeClassification::ID = 0;
+
+namespace {
+
+/// \brief Strip the sugar which does not name a type.
+const Type *getNamingType(const Type *type) {
+  while (true) {
+    if (const ParenType *paren = dyn_cast<ParenType>(type)) {
+      type = paren->getInnerType().getTypePtr();
+    } else if (const ElaboratedType *elaborated =
+                   dyn_cast<ElaboratedType>(type)) {
+      type = elaborated->getNamedType().getTypePtr();
+    } else if (const SubstTemplateTypeParmType *subst =
+                   dyn_cast<SubstTemplateTypeParmType>(type)) {
+      type = subst->getReplacementType().getTypePtr();
+    } else {
+      return type;
+    }
+  }
+}
+
+/// \brief Tell whether a character type is a plain one: either one of the
+/// built-in character types or a typedef named after them.
+bool isPlainChar(const Type *type) {
+  type = getNamingType(type);
+  if (isa<BuiltinType>(type)) {
+    return true;
+  }
+  const TypedefType *typedefType = dyn_cast<TypedefType>(type);
+  return typedefType &&
+         llvm::StringSwitch<bool>(typedefType->getDecl()->getName())
+             .Cases("char_t", "wchar_t", "__wchar_t", true)
+             .Cases("char16_t", "char32_t", true)
+             .Default(false);
+}
+}
+
+TypeClassification::TypeClassification(CompilerInstance &CI) : CI(CI) {}
+
+TypeClass TypeClassification::classify(QualType type) {
+  ++lookupCount;
+  const Type *typePtr = type.getTypePtr();
+  auto it = classes.find(typePtr);
+  if (it == classes.end()) {
+    it = classes.insert(std::make_pair(typePtr, compute(typePtr))).first;
+  }
+  return it->second;
+}
+
+void TypeClassification::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Type classification: " << classes.size() << " types, " << lookupCount
+     << " lookups\n";
+}
+
+TypeClass TypeClassification::compute(const Type *type) const {
+  TypeClass typeClass;
+  if (type->isAnyCharacterType() && isPlainChar(type)) {
+    typeClass.flags |= TypeClass::IsPlainChar;
+  }
+  if (type->isBooleanType()) {
+    typeClass.flags |= TypeClass::IsBool;
+  }
+  if (type->isEnumeralType()) {
+    typeClass.flags |= TypeClass::IsEnum;
+  }
+  if (type->isRealFloatingType()) {
+    typeClass.flags |= TypeClass::IsFloating;
+  }
+  if (type->isSignedIntegerOrEnumerationType() || type->isRealFloatingType()) {
+    typeClass.flags |= TypeClass::IsSigned;
+  }
+  if (!type->isArithmeticType() || type->isDependentType()) {
+    return typeClass;
+  }
+
+  ASTContext &context = CI.getASTContext();
+  typeClass.flags |= TypeClass::IsArithmetic;
+  typeClass.bitWidth = context.getTypeSize(type);
+  if (typeClass.is(TypeClass::IsBool) || typeClass.is(TypeClass::IsEnum)) {
+    return typeClass;
+  }
+
+  const QualType unqualifiedType(type, 0);
+  const std::string typeName = unqualifiedType.getAsString();
+  // A type of the same type as "size_t" having "size_t" somewhere in its name
+  // is fine. Please note: This also allows a typedef for "unsigned long" to be
+  // named e.g. "size_type" without any size indicator - which may or may not
+  // be a good thing.
+  const bool isSizeType =
+      context.hasSameUnqualifiedType(unqualifiedType, context.getSizeType()) &&
+      typeName.find("size_t") != std::string::npos;
+  // char_t and wchar_t are not subject to rule 3-9-2.
+  const bool isCharType = StringRef(typeName).endswith("char_t");
+  // For all remaining types, the number of occupied bits must be embedded in
+  // the typename.
+  const bool hasBitWidth =
+      typeName.rfind(llvm::utostr(typeClass.bitWidth)) != std::string::npos;
+  if (isSizeType || isCharType || hasBitWidth) {
+    typeClass.flags |= TypeClass::HasSizeIndicatingName;
+  }
+  return typeClass;
+}
+}
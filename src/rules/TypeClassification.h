@@ -0,0 +1,61 @@
+//===-  TypeClassification.h - Properties of the types of a TU-------------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef TYPE_CLASSIFICATION_H
+#define TYPE_CLASSIFICATION_H
+
+#include "misracpp2008.h"
+#include "clang/AST/Type.h"
+#include "llvm/ADT/DenseMap.h"
+#include <cstdint>
+
+namespace misracpp2008 {
+
+/// \brief Properties of a type the rules ask for over and over again.
+struct TypeClass {
+  enum Flag : uint16_t {
+    IsPlainChar = 1 << 0, ///< Character type in the sense of rule 4-5-3.
+    IsBool = 1 << 1,
+    IsEnum = 1 << 2,
+    IsArithmetic = 1 << 3,
+    IsFloating = 1 << 4,
+    IsSigned = 1 << 5,
+    /// Name of the type indicates its size and signedness, see rule 3-9-2.
+    HasSizeIndicatingName = 1 << 6
+  };
+
+  uint16_t flags = 0;
+  unsigned bitWidth = 0; ///< Size of arithmetic types in bits, 0 otherwise.
+
+  bool is(Flag flag) const { return (flags & flag) != 0; }
+};
+
+/// \brief Shared analysis classifying every type of the translation unit once.
+///
+/// Types are keyed by their possibly sugared, unqualified type pointer, so the
+/// names given by typedefs are taken into account. Names of types are only
+/// formatted on the first request for a type.
+class TypeClassification : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit TypeClassification(clang::CompilerInstance &CI);
+
+  /// \brief Get the properties of \c type, qualifiers do not matter.
+  TypeClass classify(clang::QualType type);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  clang::CompilerInstance &CI;
+  llvm::DenseMap<const clang::Type *, TypeClass> classes;
+  unsigned lookupCount = 0;
+
+  TypeClass compute(const clang::Type *type) const;
+};
+}
+
+#endif
@@ -0,0 +1,371 @@
+//===-  UnderlyingTypes.cpp - MISRA underlying types of expressions--------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+
+#include "UnderlyingTypes.h"
+#include "clang/AST/ASTContext.h"
+#include "clang/AST/Expr.h"
+#include "clang/AST/ExprCXX.h"
+#include "clang/AST/RecursiveASTVisitor.h"
+#include "clang/Frontend/CompilerInstance.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace clang;
+
+namespace misracpp2008 {
+
+char UnderlyingTypes::ID = 0;
+
+namespace {
+
+const uint8_t inheritedFlags =
+    UnderlyingTypeInfo::IsCValue | UnderlyingTypeInfo::IsConstant;
+
+bool isArithmeticConversion(CastKind kind) {
+  switch (kind) {
+  case CK_IntegralCast:
+  case CK_FloatingCast:
+  case CK_IntegralToFloating:
+  case CK_FloatingToIntegral:
+    return true;
+  default:
+    return false;
+  }
+}
+
+QualType getIntegerType(QualType type) {
+  if (const EnumType *enumType = type->getAs<EnumType>()) {
+    const QualType integerType = enumType->getDecl()->getIntegerType();
+    if (!integerType.isNull()) {
+      return integerType.getCanonicalType();
+    }
+  }
+  return type;
+}
+
+/// \brief Collect the operands computeNode() needs the underlying types of.
+void getOperands(const Expr *expr, SmallVectorImpl<const Expr *> &operands) {
+  if (const ParenExpr *paren = dyn_cast<ParenExpr>(expr)) {
+    operands.push_back(paren->getSubExpr());
+  } else if (const CastExpr *cast = dyn_cast<CastExpr>(expr)) {
+    operands.push_back(cast->getSubExpr());
+  } else if (const UnaryOperator *unary = dyn_cast<UnaryOperator>(expr)) {
+    operands.push_back(unary->getSubExpr());
+  } else if (const BinaryOperator *binary = dyn_cast<BinaryOperator>(expr)) {
+    operands.push_back(binary->getLHS());
+    operands.push_back(binary->getRHS());
+  } else if (const ConditionalOperator *conditional =
+                 dyn_cast<ConditionalOperator>(expr)) {
+    operands.push_back(conditional->getCond());
+    operands.push_back(conditional->getTrueExpr());
+    operands.push_back(conditional->getFalseExpr());
+  }
+}
+}
+
+/// \brief Visits all the expressions, and the places outside of operators
+/// integral promotions happen at.
+class UnderlyingTypes::Collector
+    : public RecursiveASTVisitor<UnderlyingTypes::Collector> {
+public:
+  explicit Collector(UnderlyingTypes &underlyingTypes)
+      : underlyingTypes(underlyingTypes) {}
+
+  bool VisitExpr(Expr *expr) {
+    underlyingTypes.compute(expr);
+    return true;
+  }
+
+  bool VisitSwitchStmt(SwitchStmt *S) {
+    if (const Expr *cond = S->getCond()) {
+      underlyingTypes.visitOperand(cond);
+    }
+    return true;
+  }
+
+  bool VisitCallExpr(CallExpr *call) {
+    // Arguments passed through the ellipsis get promoted.
+    const FunctionDecl *callee = call->getDirectCallee();
+    if (callee && callee->isVariadic()) {
+      for (unsigned i = callee->getNumParams(), e = call->getNumArgs(); i < e;
+           ++i) {
+        underlyingTypes.visitOperand(call->getArg(i));
+      }
+    }
+    return true;
+  }
+
+private:
+  UnderlyingTypes &underlyingTypes;
+};
+
+UnderlyingTypes::UnderlyingTypes(CompilerInstance &CI) : CI(CI) {}
+
+UnderlyingTypeInfo UnderlyingTypes::get(const Expr *expr) {
+  if (!isCollected) {
+    isCollected = true;
+    Collector(*this).TraverseDecl(CI.getASTContext().getTranslationUnitDecl());
+  }
+  return compute(expr);
+}
+
+UnderlyingTypeInfo UnderlyingTypes::getOperand(const Expr *operand) {
+  const ImplicitCastExpr *cast = dyn_cast<ImplicitCastExpr>(operand);
+  while (cast && isArithmeticConversion(cast->getCastKind())) {
+    operand = cast->getSubExpr();
+    cast = dyn_cast<ImplicitCastExpr>(operand);
+  }
+  return get(operand);
+}
+
+bool UnderlyingTypes::isImplicitConversion(const ImplicitCastExpr *cast) {
+  if (!isArithmeticConversion(cast->getCastKind())) {
+    return false;
+  }
+  const UnderlyingTypeInfo info = get(cast);
+  return !info.is(UnderlyingTypeInfo::IsPromotion) &&
+         !info.is(UnderlyingTypeInfo::IsPartOfExplicitCast);
+}
+
+const Expr *UnderlyingTypes::getConvertedExpr(const ExplicitCastExpr *cast) {
+  const Expr *expr = cast->getSubExpr();
+  while (const ImplicitCastExpr *implicitCast =
+             dyn_cast<ImplicitCastExpr>(expr)) {
+    expr = implicitCast->getSubExpr();
+  }
+  return expr;
+}
+
+void UnderlyingTypes::printStatistics(llvm::raw_ostream &OS) const {
+  OS << "Underlying types: " << infos.size() << " expressions\n";
+}
+
+UnderlyingTypeInfo UnderlyingTypes::compute(const Expr *expr) {
+  auto it = infos.find(expr);
+  if (it != infos.end()) {
+    return it->second;
+  }
+
+  // The operands are computed first, with an explicit stack so that the
+  // depth of the native one does not grow with the length of the expression,
+  // e.g. a generated sum of thousands of terms.
+  struct Pending {
+    const Expr *expr;
+    bool isExpanded;
+  };
+  llvm::SmallVector<Pending, 16> stack;
+  llvm::SmallVector<const Expr *, 3> operands;
+  stack.push_back(Pending{expr, false});
+  while (!stack.empty()) {
+    Pending &pending = stack.back();
+    const Expr *current = pending.expr;
+    if (pending.isExpanded) {
+      stack.pop_back();
+      // The operands have been computed before, inserting the node last
+      // keeps the table free of entries under construction.
+      infos[current] = computeInfo(current);
+      continue;
+    }
+    pending.isExpanded = true;
+    operands.clear();
+    if (!current->isInstantiationDependent()) {
+      getOperands(current, operands);
+    }
+    for (const Expr *operand : operands) {
+      if (infos.count(operand) == 0) {
+        stack.push_back(Pending{operand, false});
+      }
+    }
+  }
+  return infos[expr];
+}
+
+UnderlyingTypeInfo UnderlyingTypes::computeInfo(const Expr *expr) {
+  UnderlyingTypeInfo info;
+  info.type = expr->getType().getCanonicalType().getUnqualifiedType();
+  if (!expr->isInstantiationDependent()) {
+    computeNode(expr, info);
+  }
+  // Constant expressions are evaluated by the compiler, they are no cvalues.
+  if (info.is(UnderlyingTypeInfo::IsConstant)) {
+    info.flags &= ~UnderlyingTypeInfo::IsCValue;
+  }
+  return info;
+}
+
+void UnderlyingTypes::computeNode(const Expr *expr, UnderlyingTypeInfo &info) {
+  if (const ParenExpr *paren = dyn_cast<ParenExpr>(expr)) {
+    const UnderlyingTypeInfo sub = compute(paren->getSubExpr());
+    info.type = sub.type;
+    info.flags = sub.flags & inheritedFlags;
+  } else if (const ImplicitCastExpr *cast = dyn_cast<ImplicitCastExpr>(expr)) {
+    const UnderlyingTypeInfo sub = compute(cast->getSubExpr());
+    if (cast->getCastKind() == CK_LValueToRValue ||
+        cast->getCastKind() == CK_NoOp) {
+      info.type = sub.type;
+      info.flags = sub.flags & inheritedFlags;
+    } else {
+      // Promotions get their underlying type from the operator they are an
+      // operand of, see visitOperand().
+      info.flags = sub.flags & UnderlyingTypeInfo::IsConstant;
+    }
+  } else if (const ExplicitCastExpr *cast = dyn_cast<ExplicitCastExpr>(expr)) {
+    info.flags =
+        compute(cast->getSubExpr()).flags & UnderlyingTypeInfo::IsConstant;
+    const Expr *step = cast->getSubExpr();
+    while (const ImplicitCastExpr *implicitCast =
+               dyn_cast<ImplicitCastExpr>(step)) {
+      infos[implicitCast].flags |= UnderlyingTypeInfo::IsPartOfExplicitCast;
+      step = implicitCast->getSubExpr();
+    }
+  } else if (const UnaryOperator *unary = dyn_cast<UnaryOperator>(expr)) {
+    const UnderlyingTypeInfo sub = compute(unary->getSubExpr());
+    const uint8_t constant = sub.flags & UnderlyingTypeInfo::IsConstant;
+    switch (unary->getOpcode()) {
+    case UO_Plus:
+    case UO_Minus:
+    case UO_Not:
+      if (expr->getType()->isArithmeticType()) {
+        info.type = visitOperand(unary->getSubExpr());
+        info.flags = UnderlyingTypeInfo::IsCValue | constant;
+      }
+      break;
+    case UO_LNot:
+      info.flags = constant;
+      break;
+    default:
+      break;
+    }
+  } else if (const BinaryOperator *binary = dyn_cast<BinaryOperator>(expr)) {
+    const Expr *lhs = binary->getLHS();
+    const Expr *rhs = binary->getRHS();
+    const UnderlyingTypeInfo lhsInfo = compute(lhs);
+    const UnderlyingTypeInfo rhsInfo = compute(rhs);
+    const uint8_t constant =
+        lhsInfo.flags & rhsInfo.flags & UnderlyingTypeInfo::IsConstant;
+    if (binary->getOpcode() == BO_Comma) {
+      info.type = rhsInfo.type;
+      info.flags = rhsInfo.flags & inheritedFlags;
+    } else if (binary->isAssignmentOp()) {
+      // The result has the type of the left hand side, only the right hand
+      // side of compound assignments gets promoted.
+      if (binary->isCompoundAssignmentOp()) {
+        visitOperand(rhs);
+      }
+    } else if (binary->isComparisonOp()) {
+      visitOperand(lhs);
+      visitOperand(rhs);
+      info.flags = constant;
+    } else if (binary->isLogicalOp()) {
+      info.flags = constant;
+    } else if (binary->isShiftOp()) {
+      info.type = visitOperand(lhs);
+      visitOperand(rhs);
+      info.flags = UnderlyingTypeInfo::IsCValue | constant;
+    } else if (expr->getType()->isArithmeticType()) {
+      // Multiplicative, additive and bitwise operators, but no pointer
+      // arithmetic.
+      info.type = balance(visitOperand(lhs), visitOperand(rhs));
+      info.flags = UnderlyingTypeInfo::IsCValue | constant;
+    }
+  } else if (const ConditionalOperator *conditional =
+                 dyn_cast<ConditionalOperator>(expr)) {
+    const UnderlyingTypeInfo cond = compute(conditional->getCond());
+    const UnderlyingTypeInfo trueInfo = compute(conditional->getTrueExpr());
+    const UnderlyingTypeInfo falseInfo = compute(conditional->getFalseExpr());
+    info.flags = cond.flags & trueInfo.flags & falseInfo.flags &
+                 UnderlyingTypeInfo::IsConstant;
+    if (expr->getType()->isArithmeticType()) {
+      info.type = balance(visitOperand(conditional->getTrueExpr()),
+                          visitOperand(conditional->getFalseExpr()));
+      info.flags |=
+          (trueInfo.flags | falseInfo.flags) & UnderlyingTypeInfo::IsCValue;
+    }
+  } else if (isa<IntegerLiteral>(expr) || isa<CharacterLiteral>(expr) ||
+             isa<FloatingLiteral>(expr) || isa<CXXBoolLiteralExpr>(expr) ||
+             isa<UnaryExprOrTypeTraitExpr>(expr)) {
+    info.flags = UnderlyingTypeInfo::IsConstant;
+  } else if (const DeclRefExpr *ref = dyn_cast<DeclRefExpr>(expr)) {
+    if (isa<EnumConstantDecl>(ref->getDecl())) {
+      info.flags = UnderlyingTypeInfo::IsConstant;
+    }
+  }
+}
+
+QualType UnderlyingTypes::visitOperand(const Expr *operand) {
+  const UnderlyingTypeInfo info = compute(operand);
+  const ImplicitCastExpr *cast = dyn_cast<ImplicitCastExpr>(operand);
+  if (!cast || !isArithmeticConversion(cast->getCastKind())) {
+    return info.type;
+  }
+
+  // The usual arithmetic conversions do not change the underlying type of
+  // the operand, integral promotions do not change it at all.
+  const QualType type = visitOperand(cast->getSubExpr());
+  if (isPromotion(cast)) {
+    const uint8_t cvalue =
+        compute(cast->getSubExpr()).flags & UnderlyingTypeInfo::IsCValue;
+    UnderlyingTypeInfo &castInfo = infos[cast];
+    castInfo.type = type;
+    castInfo.flags |= UnderlyingTypeInfo::IsPromotion | cvalue;
+  }
+  return type;
+}
+
+QualType UnderlyingTypes::balance(QualType lhs, QualType rhs) const {
+  if (lhs == rhs) {
+    return lhs;
+  }
+
+  ASTContext &context = CI.getASTContext();
+  if (lhs->isRealFloatingType() || rhs->isRealFloatingType()) {
+    if (!rhs->isRealFloatingType()) {
+      return lhs;
+    }
+    if (!lhs->isRealFloatingType()) {
+      return rhs;
+    }
+    return context.getFloatingTypeOrder(lhs, rhs) < 0 ? rhs : lhs;
+  }
+
+  lhs = getIntegerType(lhs);
+  rhs = getIntegerType(rhs);
+  if (!lhs->isIntegerType() || !rhs->isIntegerType()) {
+    return lhs;
+  }
+  const int order = context.getIntegerTypeOrder(lhs, rhs);
+  const bool isLhsSigned = lhs->isSignedIntegerType();
+  if (isLhsSigned == rhs->isSignedIntegerType()) {
+    return order < 0 ? rhs : lhs;
+  }
+
+  // Same as the usual arithmetic conversions, just without the promotions.
+  const QualType signedType = isLhsSigned ? lhs : rhs;
+  const QualType unsignedType = isLhsSigned ? rhs : lhs;
+  const int unsignedOrder = isLhsSigned ? -order : order;
+  if (unsignedOrder >= 0) {
+    return unsignedType;
+  }
+  if (context.getTypeSize(signedType) > context.getTypeSize(unsignedType)) {
+    return signedType;
+  }
+  return context.getCorrespondingUnsignedType(signedType);
+}
+
+bool UnderlyingTypes::isPromotion(const ImplicitCastExpr *cast) const {
+  if (cast->getCastKind() != CK_IntegralCast) {
+    return false;
+  }
+  const QualType sourceType = cast->getSubExpr()->getType();
+  if (!sourceType->isPromotableIntegerType()) {
+    return false;
+  }
+  ASTContext &context = CI.getASTContext();
+  return context.hasSameUnqualifiedType(
+      cast->getType(), context.getPromotedIntegerType(sourceType));
+}
+}
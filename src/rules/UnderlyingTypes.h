@@ -0,0 +1,93 @@
+//===-  UnderlyingTypes.h - MISRA underlying types of expressions----------===//
+//
+// This file is distributed under the University of Illinois Open Source
+// License. See LICENSE.TXT for details.
+//
+//===----------------------------------------------------------------------===//
+#ifndef UNDERLYING_TYPES_H
+#define UNDERLYING_TYPES_H
+
+#include "misracpp2008.h"
+#include "clang/AST/Type.h"
+#include "llvm/ADT/DenseMap.h"
+#include <cstdint>
+
+namespace clang {
+class Expr;
+class ExplicitCastExpr;
+class ImplicitCastExpr;
+}
+
+namespace misracpp2008 {
+
+/// \brief What the 5-0-x rules need to know about an expression.
+struct UnderlyingTypeInfo {
+  enum Flag : uint8_t {
+    /// Result of a built-in arithmetic, bitwise or shift operator, the value
+    /// of which shall not undergo further conversions.
+    IsCValue = 1 << 0,
+    /// Built from literals, enumerators and sizeof only.
+    IsConstant = 1 << 1,
+    /// Implicit cast performing an integral promotion, which does not change
+    /// the underlying type.
+    IsPromotion = 1 << 2,
+    /// Implicit cast performing a step of an explicit cast.
+    IsPartOfExplicitCast = 1 << 3
+  };
+
+  clang::QualType type; ///< Canonical, unqualified underlying type.
+  uint8_t flags = 0;
+
+  bool is(Flag flag) const { return (flags & flag) != 0; }
+};
+
+/// \brief Shared analysis computing the MISRA underlying type of the
+/// expressions of the translation unit.
+///
+/// The underlying type of an expression is the type it would have without
+/// integral promotions, e.g. the sum of two unsigned chars has the underlying
+/// type unsigned char. All the expressions are visited once on the first
+/// request, the underlying types are computed bottom-up and memoized, so the
+/// work stays linear in the size of the expressions. The operands are
+/// computed with an explicit stack, whatever the nesting of the operators.
+class UnderlyingTypes : public SharedAnalysis {
+public:
+  static char ID;
+
+  explicit UnderlyingTypes(clang::CompilerInstance &CI);
+
+  /// \brief Get the underlying type and the flags of \c expr.
+  UnderlyingTypeInfo get(const clang::Expr *expr);
+
+  /// \brief Get the underlying type of the operand of an operator before the
+  /// usual arithmetic conversions applied to it.
+  UnderlyingTypeInfo getOperand(const clang::Expr *operand);
+
+  /// \brief Tell whether \c cast is an arithmetic conversion the 5-0-x rules
+  /// are about: neither a promotion nor a step of an explicit cast.
+  bool isImplicitConversion(const clang::ImplicitCastExpr *cast);
+
+  /// \brief Get the expression the value of which \c cast converts, looking
+  /// through the implicit casts below it.
+  static const clang::Expr *
+  getConvertedExpr(const clang::ExplicitCastExpr *cast);
+
+  virtual void printStatistics(llvm::raw_ostream &OS) const override;
+
+private:
+  class Collector;
+
+  clang::CompilerInstance &CI;
+  bool isCollected = false;
+  llvm::DenseMap<const clang::Expr *, UnderlyingTypeInfo> infos;
+
+  UnderlyingTypeInfo compute(const clang::Expr *expr);
+  UnderlyingTypeInfo computeInfo(const clang::Expr *expr);
+  void computeNode(const clang::Expr *expr, UnderlyingTypeInfo &info);
+  clang::QualType visitOperand(const clang::Expr *operand);
+  clang::QualType balance(clang::QualType lhs, clang::QualType rhs) const;
+  bool isPromotion(const clang::ImplicitCastExpr *cast) const;
+};
+}
+
+#endif
@@ -0,0 +1,44 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 0-1-1 %s
+
+int f(int x) {
+  if (x > 0) {
+    return 1;
+    x = 2; // expected-error {{A project shall not contain unreachable code. (MISRA C++ 2008 rule 0-1-1)}}
+  }
+  while (x < 10) {
+    ++x;
+    continue;
+    x = 5; // expected-error {{A project shall not contain unreachable code. (MISRA C++ 2008 rule 0-1-1)}}
+    --x;
+  }
+  switch (x) {
+  case 10:
+    return 0;
+  default:
+    break;
+  }
+  if (false) {
+    x = 3;
+  }
+  throw x;
+  return x; // expected-error {{A project shall not contain unreachable code. (MISRA C++ 2008 rule 0-1-1)}}
+}
+
+template <typename T> T g(T t) {
+  return t;
+  t = 0;
+}
+
+void mayThrow();
+
+int h() {
+  try {
+    mayThrow();
+  } catch (int e) {
+    return e; // Compliant, mayThrow may throw
+  } catch (...) {
+    return 1;
+    mayThrow(); // expected-error {{A project shall not contain unreachable code. (MISRA C++ 2008 rule 0-1-1)}}
+  }
+  return 0;
+}
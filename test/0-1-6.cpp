@@ -0,0 +1,40 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 0-1-6 %s
+
+int f(int a) {
+  int unused = a; // expected-error {{A project shall not contain instances of non-volatile variables being given values that are never subsequently used. (MISRA C++ 2008 rule 0-1-6)}}
+  int y;
+  y = a + 1;
+  a = y;
+  y = 2; // expected-error {{A project shall not contain instances of non-volatile variables being given values that are never subsequently used. (MISRA C++ 2008 rule 0-1-6)}}
+  y = 3;
+  return y + a;
+}
+
+int g(int n) {
+  int sum = 0;
+  for (int i = 0; i < n; ++i) {
+    sum += i;
+  }
+  return sum;
+}
+
+int h(int n) {
+  int value = 0;
+  int *pointer = &value;
+  *pointer = n;
+  return value;
+}
+
+void k(int n) {
+  n++; // expected-error {{A project shall not contain instances of non-volatile variables being given values that are never subsequently used. (MISRA C++ 2008 rule 0-1-6)}}
+}
+
+struct Lock {
+  explicit Lock(int &mutex);
+  ~Lock();
+};
+
+void locked(int &mutex, int &counter) {
+  Lock lock(mutex); // Compliant, the constructor and destructor have effects
+  ++counter;
+}
@@ -0,0 +1,11 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 10-1-1 %s
+
+class A {};
+
+class B : public A {}; // Compliant
+
+class V1 : public virtual A {}; // expected-error {{Classes should not be derived from virtual bases. (MISRA C++ 2008 rule 10-1-1)}}
+
+class V2 : virtual public A {}; // expected-error {{Classes should not be derived from virtual bases. (MISRA C++ 2008 rule 10-1-1)}}
+
+class C : public V1, public V2 {}; // Compliant - A is not a direct base
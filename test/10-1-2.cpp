@@ -0,0 +1,15 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 10-1-2 %s
+
+class A {};
+
+class B1 : public virtual A {}; // Compliant - A is shared in C
+class B2 : public virtual A {}; // Compliant - A is shared in C
+class C : public B1, public B2 {};
+
+class D : public virtual A {}; // expected-error {{A base class shall only be declared virtual if it is used in a diamond hierarchy. (MISRA C++ 2008 rule 10-1-2)}}
+
+class M1 : public virtual A {}; // Compliant - A is shared in Bottom
+class Middle : public M1 {};
+class Bottom : public Middle, public B1 {};
+
+class E : public virtual D {}; // expected-error {{A base class shall only be declared virtual if it is used in a diamond hierarchy. (MISRA C++ 2008 rule 10-1-2)}}
@@ -0,0 +1,12 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 10-1-3 %s
+
+class A {};
+class B1 : public virtual A {};
+class B2 : public virtual A {};
+class B3 : public A {};
+
+class C : public B1, public B2, public B3 {}; // expected-error {{An accessible base class shall not be both virtual and non-virtual in the same hierarchy. (MISRA C++ 2008 rule 10-1-3)}}
+
+class D : public C {}; // Compliant - the bases are mixed in C already
+
+class E : public B1, public B2 {}; // Compliant
@@ -0,0 +1,46 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 10-2-1 %s
+
+class B1 {
+public:
+  int count;
+  void foo();
+};
+
+class B2 {
+public:
+  int count;
+  void foo();
+};
+
+class D : public B1, public B2 {}; // expected-error {{All accessible entity names within a multiple inheritance hierarchy should be unique. (MISRA C++ 2008 rule 10-2-1)}}
+
+class P1 {
+public:
+  int first;
+
+private:
+  int hidden;
+};
+
+class P2 {
+public:
+  int second;
+
+private:
+  int hidden;
+};
+
+class E : public P1, public P2 {}; // Compliant - hidden is private
+
+class Single : public B1 {
+public:
+  int count; // Compliant - no multiple inheritance
+};
+
+class Base {
+public:
+  int shared;
+};
+class L : public virtual Base {};
+class R : public virtual Base {};
+class Joined : public L, public R {}; // Compliant - one declaration of shared
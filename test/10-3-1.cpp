@@ -0,0 +1,27 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 10-3-1 %s
+
+class A {
+public:
+  virtual void f1() = 0;
+  virtual void f2() = 0;
+  virtual void f3() {}
+  virtual void f4() = 0;
+  virtual ~A();
+};
+
+class B : public A {
+public:
+  virtual void f1() {} // Compliant - A::f1 is pure
+  virtual void f2() {} // Compliant - A::f2 is pure
+  virtual void f3() {} // expected-error {{There shall be no more than one definition of each virtual function on each path through the inheritance hierarchy. (MISRA C++ 2008 rule 10-3-1)}}
+  virtual void f4() = 0;
+  virtual ~B(); // Compliant - destructors are exempt
+};
+
+class C : public B {};
+
+class D : public C {
+public:
+  virtual void f1() {} // expected-error {{There shall be no more than one definition of each virtual function on each path through the inheritance hierarchy. (MISRA C++ 2008 rule 10-3-1)}}
+  virtual void f4() {} // Compliant - f4 is pure in B and A
+};
@@ -25,3 +25,15 @@ B2::~B2() {} // No virtual specifier required here
 class B3 : public A {
   // ~B3();               // Compliant - implicit destructor is OK, even when virtual
 };
+
+class B4 : public A {
+public:
+  void badMethod();          // expected-error {{Each overriding virtual function shall be declared with the virtual keyword. (MISRA C++ 2008 rule 10-3-2)}}
+  void goodMethod();         // expected-error {{Each overriding virtual function shall be declared with the virtual keyword. (MISRA C++ 2008 rule 10-3-2)}}
+  virtual ~B4();
+};
+
+class D : public A {
+public:
+  ~D() {}                    // expected-error {{Each overriding virtual function shall be declared with the virtual keyword. (MISRA C++ 2008 rule 10-3-2)}}
+};
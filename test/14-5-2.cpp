@@ -0,0 +1,17 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 14-5-2 %s
+
+class A {
+public:
+  template <typename T> A(const T &value); // expected-error {{A copy constructor shall be declared when there is a template constructor with a single parameter that is a generic parameter. (MISRA C++ 2008 rule 14-5-2)}}
+};
+
+class B {
+public:
+  B(const B &other);
+  template <typename T> B(const T &value); // Compliant
+};
+
+class C {
+public:
+  template <typename T> C(T first, T second); // Compliant - two parameters
+};
@@ -0,0 +1,12 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 14-5-3 %s
+
+class A {
+public:
+  template <typename T> A &operator=(const T &value); // expected-error {{A copy assignment operator shall be declared when there is a template assignment operator with a parameter that is a generic parameter. (MISRA C++ 2008 rule 14-5-3)}}
+};
+
+class B {
+public:
+  B &operator=(const B &other);
+  template <typename T> B &operator=(const T &value); // Compliant
+};
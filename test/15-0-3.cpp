@@ -0,0 +1,65 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 15-0-3 %s
+// RUN: %clang -fsyntax-only -DJUMP_INTO_TRY -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 15-0-3 %s
+
+void compliant(int n) {
+  try {
+    if (n > 0) {
+      goto done;
+    }
+    switch (n) {
+    case 0:
+      ++n;
+      break;
+    default:
+      break;
+    }
+  } catch (...) {
+    if (n > 0) {
+      goto handled;
+    }
+    ++n;
+  handled:
+    ++n;
+  }
+done:
+  switch (n) {
+  case 0:
+    try {
+      ++n;
+    } catch (...) {
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+// Jumping into a try block or a handler is ill-formed, compilers reject it
+// on their own.
+#ifdef JUMP_INTO_TRY
+void gotoIntoTry(int n) {
+  if (n > 0) {
+    goto inside; // expected-error {{cannot jump from this goto statement to its label}} expected-error {{Control shall not be transferred into a try or catch block using a goto or a switch statement. (MISRA C++ 2008 rule 15-0-3)}}
+  }
+  try { // expected-note {{jump bypasses initialization of try block}}
+  inside:
+    ++n;
+  } catch (...) {
+  }
+}
+
+void switchIntoHandler(int n) {
+  switch (n) {
+  case 0:
+    try {
+      ++n;
+    } catch (...) { // expected-note {{jump bypasses initialization of catch block}}
+    case 1: // expected-error {{cannot jump from switch statement to this case label}} expected-error {{Control shall not be transferred into a try or catch block using a goto or a switch statement. (MISRA C++ 2008 rule 15-0-3)}}
+      ++n;
+    }
+    break;
+  default:
+    break;
+  }
+}
+#endif
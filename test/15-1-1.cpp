@@ -0,0 +1,40 @@
+// RUN: %clang -fsyntax-only -std=c++11 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 15-1-1 %s
+
+struct Error {
+  Error() {}
+  explicit Error(int code) : code(code) {}
+  int code = 0;
+};
+
+int parseCode(const char *text) {
+  if (text == nullptr) {
+    throw Error();
+  }
+  return *text - '0';
+}
+
+int getDefaultCode() noexcept { return 1; }
+
+struct FragileError {
+  FragileError() { throw Error(); }
+};
+
+void reportParsed(const char *text) {
+  throw Error(parseCode(text)); // expected-error {{The assignment-expression of a throw statement shall not itself cause an exception to be thrown. (MISRA C++ 2008 rule 15-1-1)}}
+}
+
+void reportFragile() {
+  throw FragileError(); // expected-error {{The assignment-expression of a throw statement shall not itself cause an exception to be thrown. (MISRA C++ 2008 rule 15-1-1)}}
+}
+
+void reportDefault() {
+  throw Error(getDefaultCode()); // Compliant
+}
+
+void reportAgain(const char *text) {
+  try {
+    parseCode(text);
+  } catch (const Error &) {
+    throw; // Compliant
+  }
+}
@@ -0,0 +1,30 @@
+// RUN: %clang -fsyntax-only -std=c++11 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 15-3-4 %s
+
+struct ConfigError {};
+struct IoError {};
+struct ParseError : IoError {};
+
+void loadConfig(bool valid) {
+  if (!valid) {
+    throw ConfigError(); // expected-error {{Each exception explicitly thrown in the code shall have a handler of a compatible type in all call paths that could lead to that point. (MISRA C++ 2008 rule 15-3-4)}}
+  }
+}
+
+void readFile(bool valid) {
+  if (!valid) {
+    throw ParseError(); // Compliant, caught as IoError
+  }
+}
+
+void start(bool valid) {
+  try {
+    readFile(valid);
+  } catch (const IoError &) {
+  }
+  loadConfig(valid);
+}
+
+int main(int argc, char **) {
+  start(argc > 1);
+  return 0;
+}
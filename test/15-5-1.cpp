@@ -63,3 +63,43 @@ public:
 void fun() {
   A a;
 }
+
+void mayFail() { throw std::runtime_error(""); }
+
+class E {
+public:
+  ~E() {
+    mayFail(); // expected-error {{A class destructor shall not exit with an exception. (MISRA C++ 2008 rule 15-5-1)}}
+  }
+};
+
+class F {
+public:
+  // The handler covers the try block only.
+  ~F() {
+    try {
+      mayFail();
+    } catch (const std::exception &ex) {
+    }
+    throw std::logic_error(""); // expected-error {{A class destructor shall not exit with an exception. (MISRA C++ 2008 rule 15-5-1)}}
+  }
+};
+
+class G {
+public:
+  // The handler of a function-try-block rethrows at its end.
+  ~G() try {
+    mayFail(); // expected-error {{A class destructor shall not exit with an exception. (MISRA C++ 2008 rule 15-5-1)}}
+  } catch (const std::exception &ex) {
+  }
+};
+
+class H {
+public:
+  ~H() {
+    try {
+      mayFail();
+    } catch (...) { // Compliant
+    }
+  }
+};
@@ -0,0 +1,35 @@
+// RUN: %clang -fsyntax-only -std=c++11 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 15-5-2 %s
+
+struct Base {};
+struct Derived : Base {};
+struct Other {};
+
+void throwsDerived() throw(Base) {
+  throw Derived(); // Compliant
+}
+
+void throwsOther() throw(Base) {
+  throw Other(); // expected-error {{the function shall only be capable of throwing exceptions of the indicated type(s). (MISRA C++ 2008 rule 15-5-2)}}
+}
+
+void mayThrowOther(bool fail) {
+  if (fail) {
+    throw Other();
+  }
+}
+
+void callsOther(bool fail) throw(Base, int) {
+  mayThrowOther(fail); // expected-error {{the function shall only be capable of throwing exceptions of the indicated type(s). (MISRA C++ 2008 rule 15-5-2)}}
+}
+
+void handlesOther(bool fail) throw() {
+  try {
+    mayThrowOther(fail);
+  } catch (const Other &) {
+  }
+}
+
+void throwsPointer() throw(const Base *) {
+  static Derived derived;
+  throw &derived; // Compliant
+}
@@ -0,0 +1,26 @@
+// RUN: %clang -fsyntax-only -std=c++11 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 15-5-3 %s
+
+struct Failure {};
+
+void mayFail(bool fail) {
+  if (fail) {
+    throw Failure();
+  }
+}
+
+void mustNotFail(bool fail) noexcept {
+  mayFail(fail); // expected-error {{The terminate() function shall not be called implicitly. (MISRA C++ 2008 rule 15-5-3)}}
+}
+
+void handlesFailure(bool fail) noexcept {
+  try {
+    mayFail(fail);
+  } catch (const Failure &) {
+  }
+}
+
+void oldStyle() throw() {
+  throw Failure(); // expected-error {{The terminate() function shall not be called implicitly. (MISRA C++ 2008 rule 15-5-3)}}
+}
+
+void mayThrow(bool fail) { mayFail(fail); }
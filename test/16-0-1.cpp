@@ -0,0 +1,10 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-0-1 %s
+// Comments and other directives may precede the includes.
+#define BEFORE_INCLUDES 1
+#include <cstddef>
+
+namespace {
+int afterIncludes;
+}
+
+#include <climits> // expected-error {{#include directives in a file shall only be preceded by other preprocessor directives or comments. (MISRA C++ 2008 rule 16-0-1)}}
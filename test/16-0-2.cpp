@@ -0,0 +1,21 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-0-2 %s
+#define GLOBAL 1
+
+namespace N {
+#define IN_NAMESPACE 1 // expected-error {{Macros shall only be #define’d or #undef’d in the global namespace. (MISRA C++ 2008 rule 16-0-2)}}
+}
+
+extern "C" {
+#define IN_LINKAGE_SPECIFICATION 1
+}
+
+struct S {
+#define IN_CLASS 1 // expected-error {{Macros shall only be #define’d or #undef’d in the global namespace. (MISRA C++ 2008 rule 16-0-2)}}
+  int member;
+};
+
+void f() {
+#undef GLOBAL // expected-error {{Macros shall only be #define’d or #undef’d in the global namespace. (MISRA C++ 2008 rule 16-0-2)}}
+}
+
+#undef IN_NAMESPACE
@@ -0,0 +1,3 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-0-3 %s
+#define TEMPORARY 1
+#undef TEMPORARY // expected-error {{#undef shall not be used. (MISRA C++ 2008 rule 16-0-3)}}
@@ -0,0 +1,5 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-0-4 %s
+#define OBJECT_LIKE 1
+#define FUNCTION_LIKE(x) (x)       // expected-error {{Function-like macros shall not be defined. (MISRA C++ 2008 rule 16-0-4)}}
+#define NO_PARAMETERS() 1          // expected-error {{Function-like macros shall not be defined. (MISRA C++ 2008 rule 16-0-4)}}
+#define PARENTHESIZED_BODY (1 + 2)
@@ -0,0 +1,10 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-0-6 %s
+#define SQUARE(x) ((x) * (x))
+#define STRINGIFY(x) #x
+#define CONCAT(a, b) a##b
+#define VARIADIC(...) call(__VA_ARGS__)
+#define CALL(f, x) (f)((x))
+
+#define ADD(a, b) a + (b)        // expected-error {{In the definition of a function-like macro, each instance of a parameter shall be enclosed in parentheses, unless it is used as the operand of # or ## . (MISRA C++ 2008 rule 16-0-6)}}
+#define SUBTRACT(a, b) (a) - b   // expected-error {{In the definition of a function-like macro, each instance of a parameter shall be enclosed in parentheses, unless it is used as the operand of # or ## . (MISRA C++ 2008 rule 16-0-6)}}
+#define PASS(f, x) (f)(x, 1)     // expected-error {{In the definition of a function-like macro, each instance of a parameter shall be enclosed in parentheses, unless it is used as the operand of # or ## . (MISRA C++ 2008 rule 16-0-6)}}
@@ -0,0 +1,19 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-0-7 %s
+#define ENABLED 1
+#define VERSION(major) ((major) * 100)
+
+#if ENABLED && VERSION(ENABLED) > 50
+#endif
+
+#if defined(UNDEFINED_A) || defined UNDEFINED_B
+#endif
+
+#if __has_include(<cstddef>) && true
+#endif
+
+#if UNDEFINED_C // expected-error {{Undefined macro identifiers shall not be used in #if or #elif preprocessor directives, except as operands to the defined operator. (MISRA C++ 2008 rule 16-0-7)}}
+#elif ENABLED || UNDEFINED_D // expected-error {{Undefined macro identifiers shall not be used in #if or #elif preprocessor directives, except as operands to the defined operator. (MISRA C++ 2008 rule 16-0-7)}}
+#endif
+
+#ifdef UNDEFINED_E
+#endif
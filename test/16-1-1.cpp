@@ -0,0 +1,9 @@
+// RUN: %clang -fsyntax-only -Wno-expansion-to-defined -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-1-1 %s
+#define ENABLED 1
+#define IS_ENABLED defined(ENABLED)
+
+#if defined(ENABLED) && defined ENABLED
+#endif
+
+#if IS_ENABLED // expected-error {{The defined preprocessor operator shall only be used in one of the two standard forms. (MISRA C++ 2008 rule 16-1-1)}}
+#endif
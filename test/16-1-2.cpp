@@ -0,0 +1,14 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-1-2 %s
+// expected-no-diagnostics
+// Directives spread over several files do not compile, so only the compliant
+// forms can be tested.
+#include <cstddef>
+
+#if defined(NDEBUG)
+#elif 1
+#else
+#endif
+
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+#endif
@@ -0,0 +1,10 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-2-2 %s
+#ifndef INCLUDE_GUARD
+#define INCLUDE_GUARD
+#define STORAGE static
+#define QUALIFIERS const volatile
+#define PI 3.14                           // expected-error {{C++ macros shall only be used for: include guards, type qualifiers, or storage class specifiers. (MISRA C++ 2008 rule 16-2-2)}}
+#define MAX(a, b) ((a) > (b) ? (a) : (b)) // expected-error {{C++ macros shall only be used for: include guards, type qualifiers, or storage class specifiers. (MISRA C++ 2008 rule 16-2-2)}}
+#define STATEMENT do { } while (false)    // expected-error {{C++ macros shall only be used for: include guards, type qualifiers, or storage class specifiers. (MISRA C++ 2008 rule 16-2-2)}}
+#undef PI
+#endif
@@ -0,0 +1,7 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-2-3 %s
+#include "Inputs/guarded.h"
+#include "Inputs/pragma-once.h" // expected-error {{Include guards shall be provided. (MISRA C++ 2008 rule 16-2-3)}}
+#include "Inputs/unguarded.h" // expected-error {{Include guards shall be provided. (MISRA C++ 2008 rule 16-2-3)}}
+#include "Inputs/unguarded.h"
+#include "Inputs/guarded.h"
+#include <cstddef>
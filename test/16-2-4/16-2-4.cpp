@@ -0,0 +1,4 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-2-4 %s
+#include "Inputs/plain.h"
+#include "Inputs/it's.h"     // expected-error {{The ' , " , /* or // characters shall not occur in a header file name. (MISRA C++ 2008 rule 16-2-4)}}
+#include "Inputs//plain.h"   // expected-error {{The ' , " , /* or // characters shall not occur in a header file name. (MISRA C++ 2008 rule 16-2-4)}}
@@ -0,0 +1,6 @@
+#ifndef APOSTROPHE_H
+#define APOSTROPHE_H
+
+int apostrophe();
+
+#endif
@@ -0,0 +1,6 @@
+#ifndef PLAIN_H
+#define PLAIN_H
+
+int plain();
+
+#endif
@@ -0,0 +1,3 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-2-5 %s
+#include "Inputs/plain.h"
+#include "Inputs/back\slash.h" // expected-error {{The \ character should not occur in a header file name. (MISRA C++ 2008 rule 16-2-5)}}
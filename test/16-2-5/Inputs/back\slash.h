@@ -0,0 +1,6 @@
+#ifndef BACKSLASH_H
+#define BACKSLASH_H
+
+int backslash();
+
+#endif
@@ -0,0 +1,5 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 16-2-6 %s
+#include <cstddef> // Comments may follow the header name.
+#define HEADER <climits>
+#include HEADER
+#include <cstdint> int // expected-warning {{extra tokens at end of #include directive}} expected-error {{The #include directive shall be followed by either a <filename> or "filename" sequence. (MISRA C++ 2008 rule 16-2-6)}}
@@ -83,3 +83,13 @@ void func() {
   sInt.templateMethod<short>();
   sInt.templateMethod<int>();
 }
+
+// Only identifiers of the same scope are compared.
+int kValue;
+namespace other {
+// Compliant with ::kValue, but not with other::kvaIue.
+int kva1ue; // expected-note {{Typographically too close to 'kvaIue'}}
+}
+namespace other {
+int kvaIue; // expected-error {{Different identifiers shall be typographically unambiguous. (MISRA C++ 2008 rule 2-10-1)}}
+}
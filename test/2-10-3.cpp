@@ -0,0 +1,26 @@
+// RUN: %clang -fsyntax-only -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-10-3 %s
+
+namespace NS1 {
+typedef int TYPE; // expected-note {{Previous occurence of identifier 'TYPE'}}
+}
+
+namespace NS2 {
+float TYPE; // expected-error {{A typedef name (including qualification, if any) shall be a unique identifier. (MISRA C++ 2008 rule 2-10-3)}}
+}
+
+void function() {
+  typedef unsigned char uint8; // expected-note {{Previous occurence of identifier 'uint8'}}
+  {
+    typedef unsigned char uint8; // expected-error {{A typedef name (including qualification, if any) shall be a unique identifier. (MISRA C++ 2008 rule 2-10-3)}}
+  }
+}
+
+// A typedef naming the class it is declared with is compliant.
+typedef struct Point {
+  int x;
+  int y;
+} Point;
+
+// Redeclarations name the same entity.
+typedef int Length;
+typedef int Length;
@@ -0,0 +1,23 @@
+// RUN: %clang -fsyntax-only -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-10-4 %s
+
+namespace NS1 {
+class Widget {}; // expected-note {{Previous occurence of identifier 'Widget'}}
+}
+
+namespace NS2 {
+int Widget; // expected-error {{A class, union or enum name (including qualification, if any) shall be a unique identifier. (MISRA C++ 2008 rule 2-10-4)}}
+}
+
+enum Colour { red, green }; // expected-note {{Previous occurence of identifier 'Colour'}}
+
+void paint() {
+  int Colour = red; // expected-error {{A class, union or enum name (including qualification, if any) shall be a unique identifier. (MISRA C++ 2008 rule 2-10-4)}}
+  Colour = green;
+}
+
+// Forward declarations name the same class.
+class Gadget;
+class Gadget {};
+class Gadget;
+
+void useGadget(Gadget *gadget);
@@ -0,0 +1,41 @@
+// RUN: %clang -fsyntax-only -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-10-5 %s
+
+namespace NS1 {
+static int global = 0; // expected-note {{Previous occurence of identifier 'global'}}
+}
+
+namespace NS2 {
+void fn() {
+  int global = 0; // expected-error {{The identifier name of a non-member object or function with static storage duration should not be reused. (MISRA C++ 2008 rule 2-10-5)}}
+  global = 1;
+}
+}
+
+int counter() {
+  static int count = 0; // expected-note {{Previous occurence of identifier 'count'}}
+  return ++count;
+}
+
+namespace NS3 {
+int count; // expected-error {{The identifier name of a non-member object or function with static storage duration should not be reused. (MISRA C++ 2008 rule 2-10-5)}}
+}
+
+namespace {
+void helper() {} // expected-note {{Previous occurence of identifier 'helper'}}
+}
+
+struct Worker {
+  void helper(); // expected-error {{The identifier name of a non-member object or function with static storage duration should not be reused. (MISRA C++ 2008 rule 2-10-5)}}
+};
+
+// Overloads of a static function are compliant.
+static void overloaded(int) {}
+static void overloaded(double) {}
+
+// Names with external linkage are not checked by this rule.
+int externalName;
+void externalFunction() {
+  int externalName = 0;
+  int externalFunction = externalName;
+  externalFunction = 1;
+}
@@ -0,0 +1,28 @@
+// RUN: %clang -fsyntax-only -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-10-6 %s
+
+struct stat { // expected-note {{Previous occurence of identifier 'stat'}}
+  int size;
+};
+
+int stat(const char *path); // expected-error {{If an identifier refers to a type, it shall not also refer to an object or a function in the same scope. (MISRA C++ 2008 rule 2-10-6)}}
+
+namespace NS {
+enum Mode { on, off }; // expected-note {{Previous occurence of identifier 'Mode'}}
+void Mode(int mode); // expected-error {{If an identifier refers to a type, it shall not also refer to an object or a function in the same scope. (MISRA C++ 2008 rule 2-10-6)}}
+}
+
+class Holder {
+  struct Node {}; // expected-note {{Previous occurence of identifier 'Node'}}
+  int Node; // expected-error {{If an identifier refers to a type, it shall not also refer to an object or a function in the same scope. (MISRA C++ 2008 rule 2-10-6)}}
+};
+
+// Compliant: the typedef names the class itself.
+typedef struct Point {
+  int x;
+} Point;
+
+// Compliant: different scopes.
+typedef int Size;
+namespace Other {
+int Size;
+}
@@ -0,0 +1,10 @@
+// RUN: %clang -fsyntax-only -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-13-1 %s
+
+char escape = '\e'; // expected-error {{Only those escape sequences that are defined in ISO/IEC 14882:2003 shall be used. (MISRA C++ 2008 rule 2-13-1)}}
+const char *parenthesis = "(\(\[)"; // expected-error {{Only those escape sequences that are defined in ISO/IEC 14882:2003 shall be used. (MISRA C++ 2008 rule 2-13-1)}}
+
+// Compliant
+const char *standard = "\a\b\f\n\r\t\v\\\?\'\"\x41\101\0";
+const wchar_t *universal = L"\u00e4";
+
+#define ESCAPE_MACRO "\e" // expected-error {{Only those escape sequences that are defined in ISO/IEC 14882:2003 shall be used. (MISRA C++ 2008 rule 2-13-1)}}
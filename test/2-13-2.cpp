@@ -0,0 +1,15 @@
+// RUN: %clang -fsyntax-only -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-13-2 %s
+
+int octal = 052; // expected-error {{Octal constants (other than zero) and octal escape sequences (other than "\0") shall not be used. (MISRA C++ 2008 rule 2-13-2)}}
+char octalEscape = '\101'; // expected-error {{Octal constants (other than zero) and octal escape sequences (other than "\0") shall not be used. (MISRA C++ 2008 rule 2-13-2)}}
+const char *octalString = "line\012"; // expected-error {{Octal constants (other than zero) and octal escape sequences (other than "\0") shall not be used. (MISRA C++ 2008 rule 2-13-2)}}
+#define OCTAL_MACRO 010 // expected-error {{Octal constants (other than zero) and octal escape sequences (other than "\0") shall not be used. (MISRA C++ 2008 rule 2-13-2)}}
+
+// Compliant
+int zero = 0;
+int octalZero = 00;
+int decimal = 52;
+int hexadecimal = 0x2A;
+double floating = 012.5;
+char nul = '\0';
+const char *hexString = "line\x0a";
@@ -0,0 +1,6 @@
+// RUN: %clang -fsyntax-only -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-3-1 %s
+
+const char *trigraph = "Question??!"; // expected-warning {{trigraph}} expected-error {{Trigraphs shall not be used. (MISRA C++ 2008 rule 2-3-1)}}
+
+// Compliant
+const char *questions = "Questions?? Answers!";
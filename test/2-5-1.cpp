@@ -0,0 +1,12 @@
+// RUN: %clang -fsyntax-only -ferror-limit=0 -trigraphs -Wno-trigraphs -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-5-1 %s
+
+int digraphArray<:2:> = {0, 1}; // expected-error 2 {{Digraphs should not be used. (MISRA C++ 2008 rule 2-5-1)}}
+
+void digraphFunction() <% // expected-error {{Digraphs should not be used. (MISRA C++ 2008 rule 2-5-1)}}
+%> // expected-error {{Digraphs should not be used. (MISRA C++ 2008 rule 2-5-1)}}
+
+%:define DIGRAPH_MACRO 1 // expected-error {{Digraphs should not be used. (MISRA C++ 2008 rule 2-5-1)}}
+
+// Compliant
+int array[2] = {0, 1};
+int trigraphArray??(2??) = ??<0, 1??>;
@@ -0,0 +1,11 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-7-1 %s
+
+/* A C-style comment. */
+/* Opening /* another one. */ // expected-warning {{'/*' within block comment}} expected-error {{The character sequence /* shall not be used within a C-style comment. (MISRA C++ 2008 rule 2-7-1)}}
+// A C++ comment may contain /* without harm.
+
+int value; /* A comment following code. */
+
+/*
+ * A comment spanning lines.
+ */
@@ -0,0 +1,16 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-7-2 %s
+
+/* Set the value to zero; see above. */
+/* Note: the loop { ... } gets unrolled by the compiler. */
+int value;
+
+void f() {
+  /* value = 1; */ // expected-error {{Sections of code shall not be "commented out" using C-style comments. (MISRA C++ 2008 rule 2-7-2)}}
+  // expected-error@+1 {{Sections of code shall not be "commented out" using C-style comments. (MISRA C++ 2008 rule 2-7-2)}}
+  /*
+  if (value > 0) {
+    return;
+  }
+  */
+  // value = 2;
+}
@@ -0,0 +1,16 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-7-3 %s
+
+// expected-error@+1 {{Sections of code should not be "commented out" using C++ comments. (MISRA C++ 2008 rule 2-7-3)}}
+// #include <vector>
+
+// Set the value to zero; see above.
+// Don't call f() before the value is set;
+/// \brief Returns the value.
+int value;
+
+int f() {
+  // expected-error@+1 {{Sections of code should not be "commented out" using C++ comments. (MISRA C++ 2008 rule 2-7-3)}}
+  // value = 1;
+  /* value = 2; */
+  return value; // The value is never negative.
+}
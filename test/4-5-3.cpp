@@ -79,3 +79,9 @@ void nonPlainCharUint8(uint8_t ch, int i) {
   --ch;
   int e = 0xAA & ch;
 }
+
+// Qualifiers do not make a plain char any less plain
+void constPlainChar(const char ch) {
+  int i = ch + 1;    // expected-error {{Expressions with type (plain) char and wchar_t shall not be used as operands to built-in operators other than the assignment operator = , the equality operators == and != , and the unary & operator. (MISRA C++ 2008 rule 4-5-3)}}
+  bool b = 'b' == ch; // Compliant
+}
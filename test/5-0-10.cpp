@@ -0,0 +1,12 @@
+// RUN: %clang -fsyntax-only -std=c++11 -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-10 %s
+
+#include <cstdint>
+
+void castBack(uint8_t port, uint16_t mode, uint32_t u32a) {
+  uint8_t r1 = (~port) >> 4;                     // expected-error {{If the bitwise operators ~ and << are applied to an operand with an underlying type of unsigned char or unsigned short, the result shall be immediately cast to the underlying type of the operand. (MISRA C++ 2008 rule 5-0-10)}}
+  uint8_t r2 = static_cast<uint8_t>(~port) >> 4; // Compliant
+  uint16_t r3 = static_cast<uint16_t>(mode << 2); // Compliant
+  uint16_t r4 = (mode << 2) >> 1;                // expected-error {{If the bitwise operators ~ and << are applied to an operand with an underlying type of unsigned char or unsigned short, the result shall be immediately cast to the underlying type of the operand. (MISRA C++ 2008 rule 5-0-10)}}
+  uint32_t r5 = static_cast<uint32_t>(~port);    // expected-error {{If the bitwise operators ~ and << are applied to an operand with an underlying type of unsigned char or unsigned short, the result shall be immediately cast to the underlying type of the operand. (MISRA C++ 2008 rule 5-0-10)}}
+  uint32_t r6 = ~u32a;                           // Compliant
+}
@@ -0,0 +1,14 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-15 %s
+
+void index(int *p, int i) {
+  int a[10];
+  a[i] = 0;       // Compliant
+  p[i] = 0;       // Compliant
+  int *q = &a[i]; // Compliant
+  q = a + 1;      // expected-error {{Array indexing shall be the only form of pointer arithmetic. (MISRA C++ 2008 rule 5-0-15)}}
+  q = q - 1;      // expected-error {{Array indexing shall be the only form of pointer arithmetic. (MISRA C++ 2008 rule 5-0-15)}}
+  ++p;            // expected-error {{Array indexing shall be the only form of pointer arithmetic. (MISRA C++ 2008 rule 5-0-15)}}
+  p--;            // expected-error {{Array indexing shall be the only form of pointer arithmetic. (MISRA C++ 2008 rule 5-0-15)}}
+  p += 2;         // expected-error {{Array indexing shall be the only form of pointer arithmetic. (MISRA C++ 2008 rule 5-0-15)}}
+  long d = q - p; // Compliant, see 5-0-17
+}
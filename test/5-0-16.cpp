@@ -0,0 +1,26 @@
+// RUN: %clang -fsyntax-only -Wno-array-bounds -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-16 %s
+
+void bounds(int i) {
+  int a[10];
+  int x;
+  int *p1 = a + 10;     // Compliant, the end of the array
+  int *p2 = a + 11;     // expected-error {{A pointer operand and any pointer resulting from pointer arithmetic using that operand shall both address elements of the same array. (MISRA C++ 2008 rule 5-0-16)}}
+  int *p3 = &a[2] + 8;  // Compliant
+  int *p4 = &a[2] - 3;  // expected-error {{A pointer operand and any pointer resulting from pointer arithmetic using that operand shall both address elements of the same array. (MISRA C++ 2008 rule 5-0-16)}}
+  int *p5 = &x + 1;     // Compliant
+  int *p6 = &x + 2;     // expected-error {{A pointer operand and any pointer resulting from pointer arithmetic using that operand shall both address elements of the same array. (MISRA C++ 2008 rule 5-0-16)}}
+  int *p7 = a + i;      // Compliant, not known
+  int *p8 = p1 + 5;     // Compliant, only the array of p1 is known
+  a[9] = 0;             // Compliant
+  int *p9 = &a[10];     // Compliant, the end of the array
+  a[10] = 0;            // expected-error {{A pointer operand and any pointer resulting from pointer arithmetic using that operand shall both address elements of the same array. (MISRA C++ 2008 rule 5-0-16)}}
+  a[12] = 0;            // expected-error {{A pointer operand and any pointer resulting from pointer arithmetic using that operand shall both address elements of the same array. (MISRA C++ 2008 rule 5-0-16)}}
+  a[-1] = 0;            // expected-error {{A pointer operand and any pointer resulting from pointer arithmetic using that operand shall both address elements of the same array. (MISRA C++ 2008 rule 5-0-16)}}
+}
+
+void matrix() {
+  int m[3][4];
+  m[2][3] = 0;          // Compliant
+  m[3][0] = 0;          // expected-error {{A pointer operand and any pointer resulting from pointer arithmetic using that operand shall both address elements of the same array. (MISRA C++ 2008 rule 5-0-16)}}
+  m[4][0] = 0;          // expected-error {{A pointer operand and any pointer resulting from pointer arithmetic using that operand shall both address elements of the same array. (MISRA C++ 2008 rule 5-0-16)}}
+}
@@ -0,0 +1,20 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-17 %s
+
+void difference(int *p, bool c) {
+  int a[10];
+  int b[10];
+  int *pa = &a[1];
+  int *pb = b;
+  long d1 = &a[5] - pa; // Compliant
+  long d2 = pb - pa;    // expected-error {{Subtraction between pointers shall only be applied to pointers that address elements of the same array. (MISRA C++ 2008 rule 5-0-17)}}
+  long d3 = b - a;      // expected-error {{Subtraction between pointers shall only be applied to pointers that address elements of the same array. (MISRA C++ 2008 rule 5-0-17)}}
+  long d4 = p - pa;     // Compliant, p may point into a
+  int *pc = pa;
+  pc = pc + 1;
+  long d5 = pc - a;     // Compliant, pc points into a
+  int *pd = c ? pa : pb;
+  long d6 = pd - a;     // Compliant, not known
+  int *pe = a;
+  pe = b;
+  long d7 = pe - a;     // Compliant, the analysis is flow-insensitive
+}
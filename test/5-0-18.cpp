@@ -0,0 +1,14 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-18 %s
+
+bool compare(int *p) {
+  int a[10];
+  int b[10];
+  int x;
+  int *pa = a;
+  bool r = pa < &a[3];  // Compliant
+  r = pa < b;           // expected-error {{> , >= , < , <= shall not be applied to objects of pointer type, except where they point to the same array. (MISRA C++ 2008 rule 5-0-18)}}
+  r = &x >= &a[0];      // expected-error {{> , >= , < , <= shall not be applied to objects of pointer type, except where they point to the same array. (MISRA C++ 2008 rule 5-0-18)}}
+  r = p > pa;           // Compliant, p may point into a
+  r = pa == b;          // Compliant, equality
+  return r;
+}
@@ -0,0 +1,12 @@
+// RUN: %clang -fsyntax-only -std=c++11 -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-20 %s
+
+#include <cstdint>
+
+void sameTypes(uint8_t u8a, uint16_t u16a, uint32_t u32a, uint32_t u32b) {
+  uint32_t r1 = u32a & u32b; // Compliant
+  uint32_t r2 = u32a | u16a; // expected-error {{Non-constant operands to a binary bitwise operator shall have the same underlying type. (MISRA C++ 2008 rule 5-0-20)}}
+  uint32_t r3 = u32a & 0xFFU; // Compliant, the operand is constant
+  uint16_t r4 = u16a ^ u8a;  // expected-error {{Non-constant operands to a binary bitwise operator shall have the same underlying type. (MISRA C++ 2008 rule 5-0-20)}}
+  uint8_t r5 = static_cast<uint8_t>(u8a ^ u8a); // Compliant
+  u32a |= u16a;              // expected-error {{Non-constant operands to a binary bitwise operator shall have the same underlying type. (MISRA C++ 2008 rule 5-0-20)}}
+}
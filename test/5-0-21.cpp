@@ -0,0 +1,14 @@
+// RUN: %clang -fsyntax-only -std=c++11 -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-21 %s
+
+#include <cstdint>
+
+void unsignedOperands(int32_t s32a, uint32_t u32a, uint8_t u8a) {
+  uint32_t r1 = u32a & 0xFFU; // Compliant
+  int32_t r2 = s32a & 0xFF;   // expected-error {{Bitwise operators shall only be applied to operands of unsigned underlying type. (MISRA C++ 2008 rule 5-0-21)}}
+  uint32_t r3 = u32a << 2U;   // Compliant
+  uint32_t r4 = u32a << 2;    // expected-error {{Bitwise operators shall only be applied to operands of unsigned underlying type. (MISRA C++ 2008 rule 5-0-21)}}
+  uint8_t r5 = static_cast<uint8_t>(~u8a); // Compliant, the underlying type is uint8_t
+  int32_t r6 = ~s32a;         // expected-error {{Bitwise operators shall only be applied to operands of unsigned underlying type. (MISRA C++ 2008 rule 5-0-21)}}
+  u32a |= 1U;                 // Compliant
+  u32a >>= 1;                 // expected-error {{Bitwise operators shall only be applied to operands of unsigned underlying type. (MISRA C++ 2008 rule 5-0-21)}}
+}
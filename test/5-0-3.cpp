@@ -0,0 +1,34 @@
+// RUN: %clang -fsyntax-only -std=c++11 -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-3 %s
+
+#include <cstdint>
+
+void takesUint32(uint32_t u32);
+void takesInt32(int32_t s32);
+
+void cvalues(uint8_t u8a, uint8_t u8b, uint16_t u16a, uint32_t u32a,
+             int32_t s32a, float f32a) {
+  uint8_t u8c = u8a + u8b;              // Compliant
+  uint32_t u32b = u8a + u8b;            // expected-error {{A cvalue expression shall not be implicitly converted to a different underlying type. (MISRA C++ 2008 rule 5-0-3)}}
+  uint32_t u32c = u32a + u8a;           // Compliant
+  uint32_t u32d = u32a + (u16a + u16a); // expected-error {{A cvalue expression shall not be implicitly converted to a different underlying type. (MISRA C++ 2008 rule 5-0-3)}}
+  uint32_t u32e = static_cast<uint32_t>(u16a) + u16a; // Compliant
+  float f32b = f32a * f32a;             // Compliant
+  double f64a = f32a * f32a;            // expected-error {{A cvalue expression shall not be implicitly converted to a different underlying type. (MISRA C++ 2008 rule 5-0-3)}}
+  int32_t s32b = s32a + 1;              // Compliant
+  uint32_t u32f = 1 + 2;                // Compliant
+  uint8_t u8d = static_cast<uint8_t>(u16a + u16a); // Compliant
+  takesUint32(u8a + u8b);               // expected-error {{A cvalue expression shall not be implicitly converted to a different underlying type. (MISRA C++ 2008 rule 5-0-3)}}
+}
+
+// The promoted sum has the type int32_t already, no cast converts it.
+void promotedSites(int8_t s8a, int8_t s8b, int32_t s32a) {
+  int32_t s32b = s8a + s8b;             // expected-error {{A cvalue expression shall not be implicitly converted to a different underlying type. (MISRA C++ 2008 rule 5-0-3)}}
+  s32a = s8a + s8b;                     // expected-error {{A cvalue expression shall not be implicitly converted to a different underlying type. (MISRA C++ 2008 rule 5-0-3)}}
+  takesInt32(s8a + s8b);                // expected-error {{A cvalue expression shall not be implicitly converted to a different underlying type. (MISRA C++ 2008 rule 5-0-3)}}
+  int32_t s32c = s32a + s8a;            // Compliant
+  int8_t s8c = s8a + s8b;               // Compliant
+}
+
+int32_t returnsSum(int8_t s8a, int8_t s8b) {
+  return s8a + s8b;                     // expected-error {{A cvalue expression shall not be implicitly converted to a different underlying type. (MISRA C++ 2008 rule 5-0-3)}}
+}
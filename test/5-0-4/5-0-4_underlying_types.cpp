@@ -0,0 +1,21 @@
+// RUN: %clang -fsyntax-only -std=c++11 -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-4 %s
+
+#include <cstdint>
+
+void signedness(uint8_t u8a, int8_t s8a, uint16_t u16a, uint32_t u32a,
+                int32_t s32a) {
+  int8_t s8b = u8a;           // expected-error {{An implicit integral conversion shall not change the signedness of the underlying type. (MISRA C++ 2008 rule 5-0-4)}}
+  uint32_t u32b = s32a;       // expected-error {{An implicit integral conversion shall not change the signedness of the underlying type. (MISRA C++ 2008 rule 5-0-4)}}
+  uint32_t u32c = s32a + u32a; // expected-error {{An implicit integral conversion shall not change the signedness of the underlying type. (MISRA C++ 2008 rule 5-0-4)}}
+  uint16_t u16b = u8a + u8a;  // Compliant, the underlying type is uint8_t
+  uint32_t u32d = u32a + u16a; // Compliant
+  uint32_t u32e = 5;          // Compliant, constants are checked by the compiler
+  bool b = u8a == s8a;        // Compliant, both operands are promoted
+  int32_t s32b = static_cast<int32_t>(u32a); // Compliant
+}
+
+enum UnsignedEnum { UNSIGNED_ENUM_ENTRY_1, UNSIGNED_ENUM_ENTRY_2 };
+
+bool unsignedEnum(UnsignedEnum ue) {
+  return ue == UNSIGNED_ENUM_ENTRY_2; // Compliant
+}
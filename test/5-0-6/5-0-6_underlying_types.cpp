@@ -0,0 +1,15 @@
+// RUN: %clang -fsyntax-only -std=c++11 -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-6 %s
+
+#include <cstdint>
+
+void sizes(uint8_t u8a, uint16_t u16a, uint32_t u32a, float f32a,
+           double f64a) {
+  uint8_t u8b = u16a;         // expected-error {{An implicit integral or floating-point conversion shall not reduce the size of the underlying type. (MISRA C++ 2008 rule 5-0-6)}}
+  uint16_t u16b = u8a + u8a;  // Compliant, the underlying type is uint8_t
+  uint16_t u16c = u32a;       // expected-error {{An implicit integral or floating-point conversion shall not reduce the size of the underlying type. (MISRA C++ 2008 rule 5-0-6)}}
+  uint8_t u8c = u16a + u16a;  // expected-error {{An implicit integral or floating-point conversion shall not reduce the size of the underlying type. (MISRA C++ 2008 rule 5-0-6)}}
+  float f32b = f64a;          // expected-error {{An implicit integral or floating-point conversion shall not reduce the size of the underlying type. (MISRA C++ 2008 rule 5-0-6)}}
+  double f64b = f32a;         // Compliant
+  uint8_t u8d = 1;            // Compliant, constants are checked by the compiler
+  uint8_t u8e = static_cast<uint8_t>(u16a); // Compliant
+}
@@ -0,0 +1,11 @@
+// RUN: %clang -fsyntax-only -std=c++11 -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-7 %s
+
+#include <cstdint>
+
+void floatingIntegral(float f32a, float f32b, int32_t s32a, int32_t s32b) {
+  int32_t s32c = static_cast<int32_t>(f32a);        // Compliant
+  int32_t s32d = static_cast<int32_t>(f32a + f32b); // expected-error {{There shall be no explicit floating-integral conversions of a cvalue expression. (MISRA C++ 2008 rule 5-0-7)}}
+  float f32c = static_cast<float>(s32a / s32b);     // expected-error {{There shall be no explicit floating-integral conversions of a cvalue expression. (MISRA C++ 2008 rule 5-0-7)}}
+  float f32d = static_cast<float>(s32a) / static_cast<float>(s32b); // Compliant
+  float f32e = static_cast<float>(f32a * f32b);     // Compliant
+}
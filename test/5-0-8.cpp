@@ -0,0 +1,11 @@
+// RUN: %clang -fsyntax-only -std=c++11 -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-8 %s
+
+#include <cstdint>
+
+void widening(uint16_t u16a, uint16_t u16b, float f32a, float f32b) {
+  uint32_t u32a = static_cast<uint32_t>(u16a + u16b); // expected-error {{An explicit integral or floating-point conversion shall not increase the size of the underlying type of a cvalue expression. (MISRA C++ 2008 rule 5-0-8)}}
+  uint16_t u16c = static_cast<uint16_t>(u16a + u16b); // Compliant
+  uint32_t u32b = static_cast<uint32_t>(u16a) + u16b; // Compliant
+  double f64a = static_cast<double>(f32a * f32b);     // expected-error {{An explicit integral or floating-point conversion shall not increase the size of the underlying type of a cvalue expression. (MISRA C++ 2008 rule 5-0-8)}}
+  double f64b = static_cast<double>(f32a) * f32b;     // Compliant
+}
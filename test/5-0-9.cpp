@@ -0,0 +1,10 @@
+// RUN: %clang -fsyntax-only -std=c++11 -ferror-limit=0 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-0-9 %s
+
+#include <cstdint>
+
+void signedness(uint8_t u8a, uint8_t u8b, uint32_t u32a, uint32_t u32b) {
+  int32_t s32a = static_cast<int32_t>(u32a + u32b); // expected-error {{An explicit integral conversion shall not change the signedness of the underlying type of a cvalue expression. (MISRA C++ 2008 rule 5-0-9)}}
+  uint8_t u8c = static_cast<uint8_t>(u8a + u8b);    // Compliant
+  int8_t s8a = static_cast<int8_t>(u8a + u8b);      // expected-error {{An explicit integral conversion shall not change the signedness of the underlying type of a cvalue expression. (MISRA C++ 2008 rule 5-0-9)}}
+  int32_t s32b = static_cast<int32_t>(u32a);        // Compliant
+}
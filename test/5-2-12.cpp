@@ -0,0 +1,23 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 5-2-12 %s
+
+void takesPointer(const int *p);
+void takesArray(const int (&a)[10]);
+
+struct S {
+  int m[10];
+  explicit S(const int *p);
+  void f();
+};
+
+void S::f() {
+  takesPointer(m);      // expected-error {{An identifier with array type passed as a function argument shall not decay to a pointer. (MISRA C++ 2008 rule 5-2-12)}}
+}
+
+void decay() {
+  int a[10];
+  takesPointer(a);      // expected-error {{An identifier with array type passed as a function argument shall not decay to a pointer. (MISRA C++ 2008 rule 5-2-12)}}
+  takesPointer((a));    // expected-error {{An identifier with array type passed as a function argument shall not decay to a pointer. (MISRA C++ 2008 rule 5-2-12)}}
+  takesPointer(&a[0]);  // Compliant
+  takesArray(a);        // Compliant
+  S s(a);               // expected-error {{An identifier with array type passed as a function argument shall not decay to a pointer. (MISRA C++ 2008 rule 5-2-12)}}
+}
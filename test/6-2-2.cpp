@@ -86,3 +86,24 @@ void compliant(float a, float b, float c) {
   if ((a < (5 + 2)) || (a > (5 + 1))) {
   }
 }
+
+struct FloatHolder {
+  float value;
+  float values[2];
+};
+float *getFloats();
+
+// Regression tests for expressions which used to trigger assertions. Those
+// values can not be proven to be the same on both sides.
+void unsupportedFloatSources(FloatHolder h, float a, float b) {
+  if ((a < h.value) || (a > h.value)) {
+  }
+  if ((a < h.values[0]) || (a > h.values[0])) {
+  }
+  if ((a < getFloats()[0]) || (a > getFloats()[0])) {
+  }
+  if ((a < getFloat()) || (a > getFloat())) {
+  }
+  if ((a < (b + 1.0F)) || (a > (b + 1.0F))) {
+  }
+}
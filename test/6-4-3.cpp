@@ -0,0 +1,48 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-4-3 %s
+
+void compliant(int x) {
+  switch (x) {
+  case 0:
+    break;
+  default:
+    break;
+  }
+}
+
+void leadingStatement(int x) {
+  switch (x) { // expected-error {{A switch statement shall be a well-formed switch statement. (MISRA C++ 2008 rule 6-4-3)}}
+    x = 2;
+  case 0:
+    break;
+  default:
+    break;
+  }
+}
+
+void noDefault(int x) {
+  switch (x) { // expected-error {{A switch statement shall be a well-formed switch statement. (MISRA C++ 2008 rule 6-4-3)}}
+  case 0:
+    break;
+  }
+}
+
+enum Color { Red, Green, Blue };
+
+void allEnumerators(Color color) {
+  switch (color) { // Compliant, every enumerator is listed
+  case Red:
+  case Green:
+    break;
+  case Blue:
+    break;
+  }
+}
+
+void missingEnumerator(Color color) {
+  switch (color) { // expected-error {{A switch statement shall be a well-formed switch statement. (MISRA C++ 2008 rule 6-4-3)}} expected-warning {{enumeration value 'Blue' not handled in switch}}
+  case Red:
+    break;
+  case Green:
+    break;
+  }
+}
@@ -0,0 +1,34 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-4-4 %s
+
+void compliant(int x) {
+  switch (x) {
+  case 0:
+    break;
+  default:
+    break;
+  }
+}
+
+void nestedInCompound(int x) {
+  switch (x) {
+  case 0: {
+  case 1: // expected-error {{A switch-label shall only be used when the most closely-enclosing compound statement is the body of a switch statement. (MISRA C++ 2008 rule 6-4-4)}}
+    break;
+  }
+  default:
+    break;
+  }
+}
+
+void nestedInIf(int x, bool b) {
+  switch (x) {
+  case 0:
+    if (b) {
+    case 1: // expected-error {{A switch-label shall only be used when the most closely-enclosing compound statement is the body of a switch statement. (MISRA C++ 2008 rule 6-4-4)}}
+      ++x;
+    }
+    break;
+  default:
+    break;
+  }
+}
@@ -0,0 +1,40 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-4-5 %s
+
+void compliant(int x) {
+  switch (x) {
+  case 0:
+  case 1:
+    ++x;
+    break;
+  case 2: {
+    ++x;
+    break;
+  }
+  case 3:
+    throw x;
+  default:
+    break;
+  }
+}
+
+void fallThrough(int x) {
+  switch (x) {
+  case 0: // expected-error {{switch-clause. (MISRA C++ 2008 rule 6-4-5)}}
+    ++x;
+  case 1:
+    break;
+  default: // expected-error {{switch-clause. (MISRA C++ 2008 rule 6-4-5)}}
+    ++x;
+  }
+}
+
+void conditionalBreak(int x, bool b) {
+  switch (x) {
+  case 0: // expected-error {{switch-clause. (MISRA C++ 2008 rule 6-4-5)}}
+    if (b) {
+      break;
+    }
+  default:
+    break;
+  }
+}
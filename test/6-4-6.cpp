@@ -0,0 +1,47 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-4-6 %s
+
+void compliant(int x) {
+  switch (x) {
+  case 0:
+    break;
+  default:
+    break;
+  }
+}
+
+void defaultFirst(int x) {
+  switch (x) { // expected-error {{The final clause of a switch statement shall be the default-clause. (MISRA C++ 2008 rule 6-4-6)}}
+  default:
+    break;
+  case 0:
+    break;
+  }
+}
+
+void noDefault(int x) {
+  switch (x) { // expected-error {{The final clause of a switch statement shall be the default-clause. (MISRA C++ 2008 rule 6-4-6)}}
+  case 0:
+    break;
+  }
+}
+
+enum Color { Red, Green, Blue };
+
+void allEnumerators(Color color) {
+  switch (color) { // Compliant, every enumerator is listed
+  case Red:
+  case Green:
+    break;
+  case Blue:
+    break;
+  }
+}
+
+void missingEnumerator(Color color) {
+  switch (color) { // expected-error {{The final clause of a switch statement shall be the default-clause. (MISRA C++ 2008 rule 6-4-6)}} expected-warning {{enumeration value 'Blue' not handled in switch}}
+  case Red:
+    break;
+  case Green:
+    break;
+  }
+}
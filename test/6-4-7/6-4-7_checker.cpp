@@ -0,0 +1,28 @@
+// RUN: %clang -fsyntax-only -Wno-switch-bool -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-4-7 %s
+
+void compliant(int x) {
+  switch (x) {
+  case 0:
+    break;
+  default:
+    break;
+  }
+}
+
+void boolean(bool b) {
+  switch (b) { // expected-error {{The condition of a switch statement shall not have bool type. (MISRA C++ 2008 rule 6-4-7)}}
+  case false:
+    break;
+  default:
+    break;
+  }
+}
+
+void comparison(int x) {
+  switch (x == 0) { // expected-error {{The condition of a switch statement shall not have bool type. (MISRA C++ 2008 rule 6-4-7)}}
+  case true:
+    break;
+  default:
+    break;
+  }
+}
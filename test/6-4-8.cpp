@@ -0,0 +1,17 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-4-8 %s
+
+void compliant(int x) {
+  switch (x) {
+  case 0:
+    break;
+  default:
+    break;
+  }
+}
+
+void onlyDefault(int x) {
+  switch (x) { // expected-error {{Every switch statement shall have at least one case-clause. (MISRA C++ 2008 rule 6-4-8)}}
+  default:
+    break;
+  }
+}
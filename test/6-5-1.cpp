@@ -0,0 +1,23 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-5-1 %s
+
+void compliant(int n) {
+  for (int i = 0; i < n; ++i) {
+  }
+}
+
+void noCounter(int n) {
+  int i = 0;
+  for (; i < n;) { // expected-error {{A for loop shall contain a single loop-counter which shall not have floating type. (MISRA C++ 2008 rule 6-5-1)}}
+    ++i;
+  }
+}
+
+void floatingCounter() {
+  for (float f = 0.0f; f < 1.0f; f += 0.1f) { // expected-error {{A for loop shall contain a single loop-counter which shall not have floating type. (MISRA C++ 2008 rule 6-5-1)}}
+  }
+}
+
+void twoCounters(int n) {
+  for (int i = 0, j = n; i < j; ++i, --j) { // expected-error {{A for loop shall contain a single loop-counter which shall not have floating type. (MISRA C++ 2008 rule 6-5-1)}}
+  }
+}
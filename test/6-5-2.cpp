@@ -0,0 +1,18 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-5-2 %s
+
+void compliant(int n) {
+  for (int i = 0; i != n; ++i) {
+  }
+  for (int i = 0; i < n; i += 2) {
+  }
+}
+
+void stepped(int n) {
+  for (int i = 0; i != n; i += 2) { // expected-error {{If loop-counter is not modified by -- or ++ , then, within condition, the loop-counter shall only be used as an operand to <= , < , > or >= . (MISRA C++ 2008 rule 6-5-2)}}
+  }
+}
+
+void steppedWithLimit(int n) {
+  for (int i = 0; (i < n) && (i != 7); i += 2) { // expected-error {{If loop-counter is not modified by -- or ++ , then, within condition, the loop-counter shall only be used as an operand to <= , < , > or >= . (MISRA C++ 2008 rule 6-5-2)}}
+  }
+}
@@ -0,0 +1,29 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-5-3 %s
+
+void compliant(int n) {
+  for (int i = 0; i < n; ++i) {
+    int j = i;
+    ++j;
+  }
+}
+
+void modifiedInStatement(int n) {
+  for (int i = 0; i < n; ++i) {
+    if (i == 3) {
+      i += 2; // expected-error {{The loop-counter shall not be modified within condition or statement. (MISRA C++ 2008 rule 6-5-3)}}
+    }
+  }
+}
+
+void modifiedInCondition(int n) {
+  for (int i = 0; i++ < n; ++i) { // expected-error {{The loop-counter shall not be modified within condition or statement. (MISRA C++ 2008 rule 6-5-3)}}
+  }
+}
+
+void modifiedInInnerLoop(int n) {
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      i = j; // expected-error {{The loop-counter shall not be modified within condition or statement. (MISRA C++ 2008 rule 6-5-3)}}
+    }
+  }
+}
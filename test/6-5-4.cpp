@@ -0,0 +1,29 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-5-4 %s
+
+int nextStep();
+
+void compliant(int n, int step) {
+  for (int i = 0; i < n; i += step) {
+  }
+  for (int i = n; i > 0; i -= 2) {
+  }
+}
+
+void multiplied(int n) {
+  for (int i = 1; i < n; i *= 2) { // expected-error {{The loop-counter shall be modified by one of: -- , ++ , -=n , or +=n ; where n remains constant for the duration of the loop. (MISRA C++ 2008 rule 6-5-4)}}
+  }
+}
+
+void assigned(int n) {
+  for (int i = 0; i < n; i = i + 1) { // expected-error {{The loop-counter shall be modified by one of: -- , ++ , -=n , or +=n ; where n remains constant for the duration of the loop. (MISRA C++ 2008 rule 6-5-4)}}
+  }
+}
+
+void variableStep(int n) {
+  int step = 1;
+  for (int i = 0; i < n; i += step) { // expected-error {{The loop-counter shall be modified by one of: -- , ++ , -=n , or +=n ; where n remains constant for the duration of the loop. (MISRA C++ 2008 rule 6-5-4)}}
+    ++step;
+  }
+  for (int i = 0; i < n; i += nextStep()) { // expected-error {{The loop-counter shall be modified by one of: -- , ++ , -=n , or +=n ; where n remains constant for the duration of the loop. (MISRA C++ 2008 rule 6-5-4)}}
+  }
+}
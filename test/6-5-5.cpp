@@ -0,0 +1,22 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-5-5 %s
+
+bool isDone(int i);
+
+void compliant(int n) {
+  bool done = false;
+  for (int i = 0; (i < n) && !done; ++i) {
+    done = isDone(i);
+  }
+}
+
+void modifiedInCondition(int n) {
+  bool done = false;
+  for (int i = 0; (i < n) && !(done = isDone(i)); ++i) { // expected-error {{A loop-control-variable other than the loop-counter shall not be modified within condition or expression. (MISRA C++ 2008 rule 6-5-5)}}
+  }
+}
+
+void modifiedInExpression(int n) {
+  int limit = n;
+  for (int i = 0; (i < n) && (limit != 0); ++i, --limit) { // expected-error {{A loop-control-variable other than the loop-counter shall not be modified within condition or expression. (MISRA C++ 2008 rule 6-5-5)}}
+  }
+}
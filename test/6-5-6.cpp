@@ -0,0 +1,15 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-5-6 %s
+
+void compliant(int n) {
+  bool found = false;
+  for (int i = 0; (i < n) && !found; ++i) {
+    found = (i == 3);
+  }
+}
+
+void counted(int n) {
+  int remaining = 3;
+  for (int i = 0; (i < n) && (remaining > 0); ++i) {
+    --remaining; // expected-error {{A loop-control-variable other than the loop-counter which is modified in statement shall have type bool. (MISRA C++ 2008 rule 6-5-6)}}
+  }
+}
@@ -0,0 +1,36 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-6-1 %s
+
+void compliant(int n) {
+  if (n > 0) {
+    goto done;
+  }
+  {
+    if (n < 0) {
+      goto inner;
+    }
+    ++n;
+  inner:
+    ++n;
+  }
+done:
+  return;
+}
+
+void intoBlock(int n) {
+  if (n > 0) {
+    goto inside; // expected-error {{Any label referenced by a goto statement shall be declared in the same block, or in a block enclosing the goto statement. (MISRA C++ 2008 rule 6-6-1)}}
+  }
+  {
+  inside:
+    ++n;
+  }
+}
+
+void intoSibling(int n) {
+  if (n > 0) {
+    goto other; // expected-error {{Any label referenced by a goto statement shall be declared in the same block, or in a block enclosing the goto statement. (MISRA C++ 2008 rule 6-6-1)}}
+  } else {
+  other:
+    ++n;
+  }
+}
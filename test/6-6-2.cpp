@@ -0,0 +1,27 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-6-2 %s
+
+void compliant(int n) {
+  if (n > 0) {
+    goto done;
+  }
+  ++n;
+done:
+  return;
+}
+
+void backwards(int n) {
+again:
+  --n;
+  if (n > 0) {
+    goto again; // expected-error {{The goto statement shall jump to a label declared later in the same function body. (MISRA C++ 2008 rule 6-6-2)}}
+  }
+}
+
+void nested(int n) {
+  for (int i = 0; i < n; ++i) {
+  retry:
+    if (i == n) {
+      goto retry; // expected-error {{The goto statement shall jump to a label declared later in the same function body. (MISRA C++ 2008 rule 6-6-2)}}
+    }
+  }
+}
@@ -0,0 +1,46 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-6-3 -std=c++11 %s
+
+void compliant(int n) {
+  for (int i = 0; i < n; ++i) {
+    if (i == 2) {
+      continue;
+    }
+  }
+}
+
+void inWhile(int n) {
+  while (n > 0) {
+    --n;
+    if (n == 2) {
+      continue; // expected-error {{The continue statement shall only be used within a well-formed for loop. (MISRA C++ 2008 rule 6-6-3)}}
+    }
+  }
+}
+
+void inIllFormedFor(int n) {
+  for (int i = 0; i < n; ++i) {
+    if (i == 2) {
+      ++i;
+      continue; // expected-error {{The continue statement shall only be used within a well-formed for loop. (MISRA C++ 2008 rule 6-6-3)}}
+    }
+  }
+}
+
+void inRangeFor(const int (&values)[3]) {
+  for (int value : values) {
+    if (value == 0) {
+      continue;
+    }
+  }
+}
+
+void inForWithinWhile(int n) {
+  while (n > 0) {
+    --n;
+    for (int i = 0; i < n; ++i) {
+      if (i == 2) {
+        continue;
+      }
+    }
+  }
+}
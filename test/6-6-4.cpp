@@ -0,0 +1,58 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-6-4 %s
+
+void compliant(int n) {
+  for (int i = 0; i < n; ++i) {
+    if (i == 3) {
+      break;
+    }
+    switch (i) {
+    case 1:
+      break;
+    default:
+      break;
+    }
+    for (int j = 0; j < i; ++j) {
+      if (j == 2) {
+        break;
+      }
+    }
+  }
+}
+
+void twoBreaks(int n) {
+  for (int i = 0; i < n; ++i) {
+    if (i == 3) {
+      break;
+    }
+    if (i == 5) {
+      break; // expected-error {{For any iteration statement there shall be no more than one break or goto statement used for loop termination. (MISRA C++ 2008 rule 6-6-4)}}
+    }
+  }
+}
+
+void breakAndGoto(int n) {
+  while (n > 0) {
+    if (n == 3) {
+      break;
+    }
+    if (n == 5) {
+      goto done; // expected-error {{For any iteration statement there shall be no more than one break or goto statement used for loop termination. (MISRA C++ 2008 rule 6-6-4)}}
+    }
+    --n;
+  }
+done:
+  return;
+}
+
+void gotoWithinLoop(int n) {
+  do {
+    if (n == 3) {
+      goto next;
+    }
+    --n;
+  next:
+    if (n == 1) {
+      break;
+    }
+  } while (n > 0);
+}
@@ -0,0 +1,41 @@
+// RUN: %clang -fsyntax-only -std=c++11 -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 6-6-5 %s
+
+int compliant(int n) {
+  int result = 0;
+  if (n > 0) {
+    result = n;
+  }
+  return result;
+}
+
+void withoutReturn(int &n) { ++n; }
+
+void trailingReturn(int &n) {
+  ++n;
+  return;
+}
+
+int earlyReturn(int n) {
+  if (n < 0) {
+    return 0; // expected-error {{A function shall have a single point of exit at the end of the function. (MISRA C++ 2008 rule 6-6-5)}}
+  }
+  return n;
+}
+
+int returnInBranches(int n) {
+  if (n < 0) {
+    return 0; // expected-error {{A function shall have a single point of exit at the end of the function. (MISRA C++ 2008 rule 6-6-5)}}
+  } else {
+    return n; // expected-error {{A function shall have a single point of exit at the end of the function. (MISRA C++ 2008 rule 6-6-5)}}
+  }
+}
+
+int lambda(int n) {
+  auto sign = [](int value) {
+    if (value < 0) {
+      return -1; // expected-error {{A function shall have a single point of exit at the end of the function. (MISRA C++ 2008 rule 6-6-5)}}
+    }
+    return 1;
+  };
+  return sign(n);
+}
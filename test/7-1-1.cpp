@@ -0,0 +1,55 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 7-1-1 %s
+
+void modify(int &value);
+void read(const int &value);
+void modifyAll(int *values);
+void readAll(const int *values);
+
+int compliant(const int a, int b, int *const p) {
+  int sum = 0;
+  sum += a;
+  b = 2;
+  *p = sum;
+  int counter = 0;
+  ++counter;
+  int taken = 0;
+  int *const address = &taken;
+  int bound = 0;
+  modify(bound);
+  const int fixed = 3;
+  return sum + b + counter + *address + fixed;
+}
+
+int nonCompliant(int a, // expected-error {{A variable which is not modified shall be const qualified. (MISRA C++ 2008 rule 7-1-1)}}
+                 int *p) { // expected-error {{A variable which is not modified shall be const qualified. (MISRA C++ 2008 rule 7-1-1)}}
+  int i = 0; // expected-error {{A variable which is not modified shall be const qualified. (MISRA C++ 2008 rule 7-1-1)}}
+  *p = a;
+  read(i);
+  return i;
+}
+
+class Counter {
+public:
+  Counter() : count(0) {}
+  void increment() { ++count; }
+  int get() const { return count; }
+
+private:
+  int count;
+};
+
+int objects() {
+  Counter modified;
+  modified.increment();
+  Counter unmodified; // expected-error {{A variable which is not modified shall be const qualified. (MISRA C++ 2008 rule 7-1-1)}}
+  return modified.get() + unmodified.get();
+}
+
+void arrays() {
+  int written[2] = {0, 1};
+  written[0] = 1;
+  int decayed[2] = {0, 1};
+  modifyAll(decayed);
+  int unmodified[2] = {0, 1}; // expected-error {{A variable which is not modified shall be const qualified. (MISRA C++ 2008 rule 7-1-1)}}
+  readAll(unmodified);
+}
@@ -0,0 +1,41 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 7-1-2 %s
+
+void modify(int &value);
+void read(const int &value);
+
+struct Point {
+  int x;
+  int y;
+};
+
+void compliant(int *out, int &ref, const int *in, const Point &point,
+               Point *moved) {
+  *out = *in;
+  ref = point.x;
+  moved->y = 0;
+}
+
+void forwarded(int *out, int &ref) {
+  modify(*out);
+  modify(ref);
+}
+
+int *escaping(int *p) { return p; }
+
+class Holder {
+public:
+  explicit Holder(int &value) : value(value) {}
+
+private:
+  int &value;
+};
+
+void nonCompliant(int *in,      // expected-error {{A pointer or reference parameter in a function shall be declared as pointer to const or reference to const if the corresponding object is not modified. (MISRA C++ 2008 rule 7-1-2)}}
+                  Point &point, // expected-error {{A pointer or reference parameter in a function shall be declared as pointer to const or reference to const if the corresponding object is not modified. (MISRA C++ 2008 rule 7-1-2)}}
+                  Point *moved) { // expected-error {{A pointer or reference parameter in a function shall be declared as pointer to const or reference to const if the corresponding object is not modified. (MISRA C++ 2008 rule 7-1-2)}}
+  read(*in);
+  read(point.x);
+  read(moved->x);
+}
+
+int main(int argc, char *argv[]) { return argc; }
@@ -0,0 +1,53 @@
+// RUN: %clang -fsyntax-only -Wno-return-stack-address -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 7-5-1 %s
+
+int *global;
+
+int *localAddress() {
+  int x = 0;
+  return &x;      // expected-error {{A function shall not return a reference or a pointer to an automatic variable (including parameters), defined within the function. (MISRA C++ 2008 rule 7-5-1)}}
+}
+
+int &localReference() {
+  int x = 0;
+  return x;       // expected-error {{A function shall not return a reference or a pointer to an automatic variable (including parameters), defined within the function. (MISRA C++ 2008 rule 7-5-1)}}
+}
+
+int *parameterAddress(int p) {
+  return &p;      // expected-error {{A function shall not return a reference or a pointer to an automatic variable (including parameters), defined within the function. (MISRA C++ 2008 rule 7-5-1)}}
+}
+
+int &throughReference() {
+  int x = 0;
+  int &r = x;
+  return r;       // expected-error {{A function shall not return a reference or a pointer to an automatic variable (including parameters), defined within the function. (MISRA C++ 2008 rule 7-5-1)}}
+}
+
+int *copy(int *p) {
+  return p;       // Compliant
+}
+
+int *throughCall() {
+  int x = 0;
+  return copy(&x); // expected-error {{A function shall not return a reference or a pointer to an automatic variable (including parameters), defined within the function. (MISRA C++ 2008 rule 7-5-1)}}
+}
+
+int *throughVariable(bool c) {
+  int a[4];
+  int *p = global;
+  if (c) {
+    p = a;
+  }
+  return p;       // expected-error {{A function shall not return a reference or a pointer to an automatic variable (including parameters), defined within the function. (MISRA C++ 2008 rule 7-5-1)}}
+}
+
+int *staticAddress() {
+  static int s;
+  return &s;      // Compliant
+}
+
+struct S {
+  int m;
+  int *member() {
+    return &m;    // Compliant
+  }
+};
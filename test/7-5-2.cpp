@@ -0,0 +1,83 @@
+// RUN: %clang -fsyntax-only -Wno-dangling-field -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 7-5-2 %s
+
+int *global;
+
+struct Holder {
+  int *p;
+  explicit Holder(int x) : p(&x) {} // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+  void set() {
+    int x = 0;
+    p = &x;       // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+  }
+};
+
+void store() {
+  int x = 0;
+  global = &x;    // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+}
+
+void nested(bool b) {
+  int *p = 0;
+  if (b) {
+    int c = 6;
+    p = &c;       // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+  }
+}
+
+void loopVariable() {
+  int *p;
+  for (int i = 0; i < 2; ++i) {
+    p = &i;       // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+  }
+}
+
+void conditionVariable(int *q) {
+  int *p = 0;
+  if (int *r = q) {
+    p = r;        // Compliant, r holds no local address
+  }
+  while (int c = 0) {
+    p = &c;       // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+  }
+}
+
+void swapThroughTemporary() {
+  int x = 0;
+  int *p = &x;
+  int *q = 0;
+  int *t = p;
+  p = q;
+  q = t;
+  global = p;     // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+  global = q;     // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+}
+
+void sameBlock() {
+  int c = 0;
+  int *p;
+  p = &c;         // Compliant
+}
+
+void out(int **result) {
+  int x = 0;
+  *result = &x;   // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+}
+
+void outReference(int *&result) {
+  int x = 0;
+  result = &x;    // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+}
+
+void keep(int *p) {
+  global = p;     // Compliant, the caller is checked
+}
+
+void keepLocal() {
+  int x = 0;
+  keep(&x);       // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+}
+
+void staticInit() {
+  int x = 0;
+  static int *s = &x; // expected-error {{The address of an object with automatic storage shall not be assigned to another object that may persist after the first object has ceased to exist. (MISRA C++ 2008 rule 7-5-2)}}
+}
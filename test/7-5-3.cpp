@@ -0,0 +1,25 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 7-5-3 %s
+
+int &identity(int &x) {
+  return x;       // expected-error {{A function shall not return a reference or a pointer to a parameter that is passed by reference or const reference. (MISRA C++ 2008 rule 7-5-3)}}
+}
+
+const int &pick(const int &a, const int &b, bool c) {
+  return c ? a : b; // expected-error {{A function shall not return a reference or a pointer to a parameter that is passed by reference or const reference. (MISRA C++ 2008 rule 7-5-3)}}
+}
+
+int *addressOf(int &x) {
+  return &x;      // expected-error {{A function shall not return a reference or a pointer to a parameter that is passed by reference or const reference. (MISRA C++ 2008 rule 7-5-3)}}
+}
+
+int &throughCall(int &x) {
+  return identity(x); // expected-error {{A function shall not return a reference or a pointer to a parameter that is passed by reference or const reference. (MISRA C++ 2008 rule 7-5-3)}}
+}
+
+int *fromPointer(int *p) {
+  return p;       // Compliant
+}
+
+int &element(int *p) {
+  return p[0];    // Compliant
+}
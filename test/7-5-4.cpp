@@ -0,0 +1,50 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 7-5-4 %s
+
+int factorial(int n) {
+  return n <= 1 ? 1 : n * factorial(n - 1); // expected-error {{Functions should not call themselves, either directly or indirectly. (MISRA C++ 2008 rule 7-5-4)}}
+}
+
+bool isOdd(unsigned n);
+
+bool isEven(unsigned n) {
+  return n == 0 ? true : isOdd(n - 1); // expected-error {{Functions should not call themselves, either directly or indirectly. (MISRA C++ 2008 rule 7-5-4)}}
+}
+
+bool isOdd(unsigned n) {
+  return n == 0 ? false : isEven(n - 1); // expected-note {{Call of 'isEven' continuing the recursion}}
+}
+
+int square(int n) { return n * n; }
+
+int sumOfSquares(int n) {
+  int sum = 0;
+  for (int i = 1; i <= n; ++i) {
+    sum += square(i);
+  }
+  return sum;
+}
+
+struct Node {
+  virtual ~Node() {}
+  virtual int depth() const { return 0; }
+};
+
+struct Branch : Node {
+  Node *child = nullptr;
+  // The call may be dispatched to this very function.
+  virtual int depth() const override {
+    return child ? 1 + child->depth() : 1; // expected-error {{Functions should not call themselves, either directly or indirectly. (MISRA C++ 2008 rule 7-5-4)}}
+  }
+};
+
+struct Base {
+  virtual ~Base() {}
+  virtual void print() {}
+};
+
+struct Derived : Base {
+  // A qualified call is not dispatched, it does not recurse.
+  virtual void print() override { Base::print(); }
+};
+
+void printAll(Base &base) { base.print(); }
@@ -0,0 +1,28 @@
+// RUN: %clang -fsyntax-only -Wno-uninitialized -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 8-5-1 %s
+
+void init(int &value);
+
+int f(int c) {
+  int x;
+  int y = x; // expected-error {{All variables shall have a defined value before they are used. (MISRA C++ 2008 rule 8-5-1)}}
+  int z;
+  if (c > 0) {
+    z = 1;
+  }
+  y += z; // expected-error {{All variables shall have a defined value before they are used. (MISRA C++ 2008 rule 8-5-1)}}
+  int w;
+  w = 2;
+  int v;
+  init(v);
+  return v + w + y;
+}
+
+int g(int n) {
+  int result;
+  if (n > 0) {
+    result = 1;
+  } else {
+    result = -1;
+  }
+  return result;
+}
@@ -0,0 +1,31 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang 9-3-3 %s
+
+class Account {
+public:
+  Account() : balance(0), audits(0) {}
+  void deposit(int amount) { balance += amount; }
+  int getBalance() const { return balance; }
+  void audit() const { ++audits; }
+  static int zero() { return 0; }
+  Account &self() { return *this; }
+  int callsDeposit() {
+    deposit(1);
+    return balance;
+  }
+  virtual int id() { return 1; }
+  void reset();
+
+  int peek() { return balance; } // expected-error {{If a member function can be made static then it shall be made static, otherwise if it can be made const then it shall be made const. (MISRA C++ 2008 rule 9-3-3)}}
+  int twice(int value) { return 2 * value; } // expected-error {{If a member function can be made static then it shall be made static, otherwise if it can be made const then it shall be made const. (MISRA C++ 2008 rule 9-3-3)}}
+  int fee() const { return 1; } // expected-error {{If a member function can be made static then it shall be made static, otherwise if it can be made const then it shall be made const. (MISRA C++ 2008 rule 9-3-3)}}
+  bool operator==(const Account &other) { return balance == other.balance; } // expected-error {{If a member function can be made static then it shall be made static, otherwise if it can be made const then it shall be made const. (MISRA C++ 2008 rule 9-3-3)}}
+  int outOfLine(); // expected-error {{If a member function can be made static then it shall be made static, otherwise if it can be made const then it shall be made const. (MISRA C++ 2008 rule 9-3-3)}}
+
+private:
+  int balance;
+  mutable int audits;
+};
+
+void Account::reset() { balance = 0; }
+
+int Account::outOfLine() { return balance; }
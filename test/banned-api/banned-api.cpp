@@ -0,0 +1,28 @@
+// RUN: %clang -fsyntax-only -Xclang -verify -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang --banned-api=%S/Inputs/banned-api.txt -Xclang -plugin-arg-misra.cpp.2008 -Xclang 18-0-3,18-0-5 %s
+// RUN: %llvmtoolsdir/not %clang -fsyntax-only -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang --banned-api=%S/Inputs/unknown-rule.txt -Xclang -plugin-arg-misra.cpp.2008 -Xclang 18-0-3 %s 2>&1 | %llvmtoolsdir/FileCheck --check-prefix=UNKNOWN-RULE %s
+// UNKNOWN-RULE: unknown-rule.txt:3: rule 5-0-3 does not ban functions or macros
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#define LEGACY_COPY(dst, src) std::strncpy(dst, src, 8)
+
+void useProjectBans(char out[8]) {
+  FILE *pipe = popen("ls", "r"); // expected-error {{The library functions abort, exit, getenv and system from library <cstdlib> shall not be used. (MISRA C++ 2008 rule 18-0-3)}}
+  char *copy = strdup("copy"); // expected-error {{The unbounded functions of library <cstring> shall not be used. (MISRA C++ 2008 rule 18-0-5)}}
+  LEGACY_COPY(out, "legacy"); // expected-error {{The unbounded functions of library <cstring> shall not be used. (MISRA C++ 2008 rule 18-0-5)}}
+}
+
+void useMisraBans() {
+  abort(); // expected-error {{The library functions abort, exit, getenv and system from library <cstdlib> shall not be used. (MISRA C++ 2008 rule 18-0-3)}}
+}
+
+struct Process {
+  int exit;
+  int system();
+};
+
+int useNames(Process &process) {
+  int popen = process.exit;
+  return popen + process.system();
+}
@@ -2,6 +2,9 @@
 
 // CHECK: Available plugin parameters:
 // CHECK-NEXT: [--help] - show this text
+// CHECK-NEXT: [--banned-api=FILE] - additionally report the functions and macros listed in FILE
 // CHECK-NEXT: [--exclude-path=PATH] - do not check files matching PATH
+// CHECK-NEXT: [--print-stats] - print checker statistics for each translation unit
+// CHECK-NEXT: [--project-data=DIR] - write the data needed by the project wide rules to DIR
 // CHECK-NEXT: [all|-all|--all] - report all rule violations as error/warning/remark
 // CHECK-NEXT: [RULE|-RULE|--RULE] - report rule RULE violations as error/warning/remark
@@ -0,0 +1,17 @@
+// RUN: %clang -cc1 -fsyntax-only -load %llvmshlibdir/misracpp2008%pluginext -plugin misra.cpp.2008 -plugin-arg-misra.cpp.2008 --print-stats -plugin-arg-misra.cpp.2008 2-10-1,5-8-1,6-2-1,16-3-1 %s 2>&1 | %llvmtoolsdir/FileCheck %s
+
+int compliantVariable;
+
+void compliantFunction(int parameter) {
+  int localVariable = parameter;
+  localVariable = 2;
+  localVariable = parameter << 2;
+}
+
+// CHECK: Checker arena usage for '{{.*}}print-stats.cpp':
+// CHECK-DAG: 2-10-1: {{[0-9]+}} bytes
+// CHECK-DAG: 5-8-1: {{[0-9]+}} bytes
+// CHECK-DAG: 6-2-1: {{[0-9]+}} bytes
+// CHECK-DAG: 16-3-1 (preprocessor): {{[0-9]+}} bytes
+// CHECK: total: {{[0-9]+}} bytes
+// CHECK: Constant evaluations: {{[0-9]+}} lookups, {{[0-9]+}} hits ({{[0-9]+}}%), {{[0-9]+}} constants
@@ -0,0 +1,5 @@
+// Second translation unit of identifier-reuse.cpp.
+
+namespace other {
+void sharedName();
+}
@@ -0,0 +1,7 @@
+void parseValue(const char *text);
+
+void parseList(const char *text) {
+  while (*text != ']') {
+    parseValue(text++);
+  }
+}
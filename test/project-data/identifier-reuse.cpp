@@ -0,0 +1,15 @@
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: %clang -fsyntax-only -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang --project-data=%t -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-10-5 %s
+// RUN: %clang -fsyntax-only -x c++ -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang --project-data=%t -Xclang -plugin-arg-misra.cpp.2008 -Xclang 2-10-5 %S/Inputs/identifier-reuse-other.hpp
+// RUN: %llvmtoolsdir/not %llvmtoolsdir/misracpp2008-merge %t > %t.out
+// RUN: %llvmtoolsdir/FileCheck %s < %t.out
+
+// Each translation unit is fine on its own, the reuse is only found when
+// merging the data of both.
+static int sharedName = 0;
+
+int getSharedName() { return sharedName; }
+
+// CHECK: identifier-reuse.cpp:9:12: warning: The identifier name of a non-member object or function with static storage duration should not be reused. (MISRA C++ 2008 rule 2-10-5)
+// CHECK-NEXT: identifier-reuse-other.hpp:4:6: note: Previous occurence of identifier 'sharedName'
+// CHECK-NOT: warning
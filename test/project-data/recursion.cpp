@@ -0,0 +1,19 @@
+// RUN: rm -rf %t && mkdir -p %t
+// RUN: %clang -fsyntax-only -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang --project-data=%t -Xclang -plugin-arg-misra.cpp.2008 -Xclang 7-5-4 %s
+// RUN: %clang -fsyntax-only -x c++ -Xclang -load -Xclang %llvmshlibdir/misracpp2008%pluginext -Xclang -plugin -Xclang misra.cpp.2008 -Xclang -plugin-arg-misra.cpp.2008 -Xclang --project-data=%t -Xclang -plugin-arg-misra.cpp.2008 -Xclang 7-5-4 %S/Inputs/recursion-other.hpp
+// RUN: %llvmtoolsdir/not %llvmtoolsdir/misracpp2008-merge %t > %t.out
+// RUN: %llvmtoolsdir/FileCheck %s < %t.out
+
+// Each translation unit is fine on its own, the recursion is only found when
+// merging the data of both.
+void parseList(const char *text);
+
+void parseValue(const char *text) {
+  if (*text == '[') {
+    parseList(text + 1);
+  }
+}
+
+// CHECK: recursion-other.hpp:5:5: warning: Functions should not call themselves, either directly or indirectly. (MISRA C++ 2008 rule 7-5-4)
+// CHECK-NEXT: recursion.cpp:13:5: note: Call of 'parseList' continuing the recursion
+// CHECK-NOT: warning